@@ -17,4 +17,15 @@ CpuSampleProvider::CpuSampleProvider(
     :
     RawSampleCollectorBase<RawCpuSample>("CpuSampleProvider", valueTypeProvider.GetOrRegister(CpuTimeProvider::SampleTypeDefinitions), rawSampleTransformer, ringBuffer, metricsRegistry)
 {
+}
+
+CpuSampleProvider::CpuSampleProvider(
+    SampleValueTypeProvider& valueTypeProvider,
+    RawSampleTransformer* rawSampleTransformer,
+    std::vector<RingBuffer*> ringBuffers,
+    MetricsRegistry& metricsRegistry
+    )
+    :
+    RawSampleCollectorBase<RawCpuSample>("CpuSampleProvider", valueTypeProvider.GetOrRegister(CpuTimeProvider::SampleTypeDefinitions), rawSampleTransformer, std::move(ringBuffers), metricsRegistry)
+{
 }
\ No newline at end of file
@@ -25,4 +25,11 @@ public:
         RawSampleTransformer* rawSampleTransformer,
         RingBuffer* ringBuffer,
         MetricsRegistry& metricsRegistry);
+
+    // one ring buffer per CPU
+    CpuSampleProvider(
+        SampleValueTypeProvider& valueTypeProvider,
+        RawSampleTransformer* rawSampleTransformer,
+        std::vector<RingBuffer*> ringBuffers,
+        MetricsRegistry& metricsRegistry);
 };
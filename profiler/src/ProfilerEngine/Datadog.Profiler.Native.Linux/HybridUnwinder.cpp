@@ -4,6 +4,7 @@
 #include "HybridUnwinder.h"
 
 #include "Callstack.h"
+#include "LibrariesInfoCache.h"
 #include "ManagedCodeCache.h"
 
 #include "UnwindingRecorder.h"
@@ -13,11 +14,13 @@
 #define UNW_LOCAL_ONLY
 #include <libunwind.h>
 
-#ifndef ARM64
-#error "HybridUnwinder is only supported on aarch64"
-#endif
-
+#if defined(ARM64)
 #define UNW_REG_FP UNW_AARCH64_X29
+#elif defined(AMD64)
+#define UNW_REG_FP UNW_X86_64_RBP
+#else
+#error "HybridUnwinder is only supported on aarch64 and x86_64"
+#endif
 
 static inline bool IsValidFp(uintptr_t fp, uintptr_t prevFp,
                              uintptr_t stackBase, uintptr_t stackEnd)
@@ -29,18 +32,25 @@ static inline bool IsValidFp(uintptr_t fp, uintptr_t prevFp,
         return false;
 
     // Ensure the full frame record [fp, fp+16) lies within the stack.
+    // The layout is the same on arm64 (x29/lr) and x86_64 (rbp/return address).
     if (fp < stackBase || fp + 2 * sizeof(void*) > stackEnd)
         return false;
 
-    // Stack grows down on arm64: FP chain must grow toward higher addresses.
+    // Stack grows down on arm64 and x86_64: FP chain must grow toward higher addresses.
     if (prevFp != 0 && fp <= prevFp)
         return false;
 
     return true;
 }
 
-HybridUnwinder::HybridUnwinder(ManagedCodeCache* managedCodeCache) :
-    _codeCache(managedCodeCache)
+HybridUnwinder::HybridUnwinder(ManagedCodeCache* managedCodeCache, bool useUnwindTables) :
+    _codeCache(managedCodeCache),
+#ifdef AMD64
+    _useUnwindTables(useUnwindTables)
+#else
+    // the precompiled unwind tables only exist for x86_64
+    _useUnwindTables(false)
+#endif
 {
 }
 
@@ -92,7 +102,7 @@ bool HybridUnwinder::UnwindNativeFrames(UnwindCursor* cursor, Callstack& callsta
         {
             unw_word_t sp = 0;
             unw_word_t nativeFp = 0;
-            unw_get_reg(&cursor->cursor, UNW_AARCH64_SP, &sp);
+            unw_get_reg(&cursor->cursor, UNW_REG_SP, &sp);
             unw_get_reg(&cursor->cursor, UNW_REG_FP, &nativeFp);
             recorder->Record(EventType::NativeFrame, ip, nativeFp, sp);
         }
@@ -104,6 +114,7 @@ bool HybridUnwinder::UnwindNativeFrames(UnwindCursor* cursor, Callstack& callsta
         }
 
         auto stepResult = unw_step(&cursor->cursor);
+#ifdef ARM64
         unw_cursor_snapshot_t snapshot;
         unw_get_cursor_snapshot(&cursor->cursor, &snapshot);
         bool unSafeStep = stepResult <= 0 || snapshot.step_method == UNW_STEP_FALLBACK_LR_NO_PROC_INFO;
@@ -112,13 +123,25 @@ bool HybridUnwinder::UnwindNativeFrames(UnwindCursor* cursor, Callstack& callsta
         {
             recorder->Record(EventType::LibunwindStep, stepResult, snapshot);
         }
+#else
+        // On x86_64, libunwind falls back to the rbp chain when there is no unwind info.
+        // This is what we would do ourselves, so only a failed step is unsafe.
+        bool unSafeStep = stepResult <= 0;
+
+        if (recorder)
+        {
+            recorder->Record(EventType::LibunwindStep, stepResult);
+        }
+#endif
 
         if (unSafeStep)
         {
+#ifdef ARM64
             if (stepResult > 0)
             {
                 stepResult = -UNW_STEP_FALLBACK_LR_NO_PROC_INFO;
             }
+#endif
 
             if (recorder)
             {
@@ -131,6 +154,93 @@ bool HybridUnwinder::UnwindNativeFrames(UnwindCursor* cursor, Callstack& callsta
     return true;
 }
 
+HybridUnwinder::TableWalkResult HybridUnwinder::UnwindNativeFramesWithTables(
+    std::uintptr_t& ip, std::uintptr_t& sp, std::uintptr_t& fp,
+    Callstack& callstack, UnwindingRecorder* recorder,
+    std::uintptr_t stackBase, std::uintptr_t stackEnd) const
+{
+#ifdef AMD64
+    // The first ip is where the thread was interrupted. The next ones are return addresses
+    // which may point right after the last instruction of the caller: look up ip - 1 instead.
+    bool isReturnAddress = false;
+    while (true)
+    {
+        if (ip == 0)
+        {
+            if (recorder)
+            {
+                recorder->RecordFinish(static_cast<std::int32_t>(callstack.Size()), FinishReason::Success);
+            }
+            return TableWalkResult::Finished;
+        }
+
+        auto isManaged = _codeCache->IsManaged(ip);
+        if (!isManaged.has_value())
+        {
+            callstack.Add(FrameStore::UnknownFrameTypeIP);
+            if (recorder)
+            {
+                recorder->RecordFinish(static_cast<std::int32_t>(callstack.Size()), FinishReason::FailedIsManaged);
+            }
+            return TableWalkResult::Finished;
+        }
+
+        if (isManaged.value())
+        {
+            if (recorder)
+            {
+                recorder->Record(EventType::ManagedTransition, ip, fp);
+            }
+            return TableWalkResult::ManagedCodeReached;
+        }
+
+        UnwindRow row;
+        if (!LibrariesInfoCache::FindUnwindRow(isReturnAddress ? ip - 1 : ip, row))
+        {
+            return TableWalkResult::Fallback;
+        }
+
+        auto cfa = (row.cfaRegister == CfaRegister::Sp ? sp : fp) + row.cfaOffset;
+
+        // The return address (and the saved frame pointer) are read from the stack:
+        // let libunwind deal with anything that does not look like a frame of this thread
+        if (cfa <= sp || cfa > stackEnd || cfa - sizeof(void*) < stackBase)
+        {
+            return TableWalkResult::Fallback;
+        }
+        auto savedFp = cfa + row.fpOffset;
+        if (row.fpOffset != 0 && (savedFp < sp || savedFp + sizeof(void*) > stackEnd))
+        {
+            return TableWalkResult::Fallback;
+        }
+
+        if (recorder)
+        {
+            recorder->Record(EventType::NativeFrame, ip, fp, sp);
+        }
+
+        if (!callstack.Add(ip))
+        {
+            if (recorder)
+            {
+                recorder->RecordFinish(static_cast<std::int32_t>(callstack.Size()), FinishReason::BufferFull);
+            }
+            return TableWalkResult::Finished;
+        }
+
+        if (row.fpOffset != 0)
+        {
+            fp = *reinterpret_cast<std::uintptr_t*>(savedFp);
+        }
+        ip = *reinterpret_cast<std::uintptr_t*>(cfa - sizeof(void*));
+        sp = cfa;
+        isReturnAddress = true;
+    }
+#else
+    return TableWalkResult::Fallback;
+#endif
+}
+
 void HybridUnwinder::UnwindManagedFrames(UnwindCursor* cursor, Callstack& callstack,
     UnwindingRecorder* recorder,
     std::uintptr_t stackBase, std::uintptr_t stackEnd) const
@@ -145,6 +255,19 @@ void HybridUnwinder::UnwindManagedFrames(UnwindCursor* cursor, Callstack& callst
         return;
     }
 
+    unw_word_t fp = 0;
+    if (auto result = unw_get_reg(&cursor->cursor, UNW_REG_FP, &fp); result != 0)
+    {
+        fp = 0;
+    }
+
+    UnwindManagedFrames(ip, fp, callstack, recorder, stackBase, stackEnd);
+}
+
+void HybridUnwinder::UnwindManagedFrames(std::uintptr_t ip, std::uintptr_t fp, Callstack& callstack,
+    UnwindingRecorder* recorder,
+    std::uintptr_t stackBase, std::uintptr_t stackEnd) const
+{
     if (!callstack.Add(ip))
     {
         if (recorder)
@@ -154,12 +277,11 @@ void HybridUnwinder::UnwindManagedFrames(UnwindCursor* cursor, Callstack& callst
         return;
     }
 
-    unw_word_t fp = 0;
-    if (auto result = unw_get_reg(&cursor->cursor, UNW_REG_FP, &fp); result != 0 || !IsValidFp(fp, 0, stackBase, stackEnd))
+    if (!IsValidFp(fp, 0, stackBase, stackEnd))
     {
         if (recorder)
         {
-            recorder->RecordFinish(static_cast<std::int32_t>(result), FinishReason::InvalidFp);
+            recorder->RecordFinish(0, FinishReason::InvalidFp);
         }
         return;
     }
@@ -279,13 +401,53 @@ std::int32_t HybridUnwinder::Unwind(void* ctx, Callstack& callstack,
         context = &localContext;
     }
 
+#ifdef AMD64
+    unw_context_t fallbackContext;
+    if (_useUnwindTables)
+    {
+        // === Phase 0: Walk native frames with the precompiled unwind tables ===
+        auto& registers = context->uc_mcontext.gregs;
+        std::uintptr_t ip = registers[REG_RIP];
+        std::uintptr_t sp = registers[REG_RSP];
+        std::uintptr_t fp = registers[REG_RBP];
+
+        auto result = UnwindNativeFramesWithTables(ip, sp, fp, callstack, recorder, stackBase, stackEnd);
+        if (result == TableWalkResult::Finished)
+        {
+            return callstack.Size();
+        }
+
+        if (result == TableWalkResult::ManagedCodeReached)
+        {
+            UnwindManagedFrames(ip, fp, callstack, recorder, stackBase, stackEnd);
+            return callstack.Size();
+        }
+
+        if (sp != static_cast<std::uintptr_t>(registers[REG_RSP]))
+        {
+            // libunwind takes over from the first frame not covered by the tables.
+            // It is not the interrupted frame anymore: ip is a return address.
+            fallbackContext = *context;
+            fallbackContext.uc_mcontext.gregs[REG_RIP] = ip;
+            fallbackContext.uc_mcontext.gregs[REG_RSP] = sp;
+            fallbackContext.uc_mcontext.gregs[REG_RBP] = fp;
+            context = &fallbackContext;
+            flag = static_cast<unw_init_local2_flags_t>(0);
+        }
+    }
+#endif
+
     UnwindCursor unwindCursor{};
     auto initResult = unw_init_local2(&unwindCursor.cursor, context, flag);
     if (recorder)
     {
+#ifdef ARM64
         unw_cursor_snapshot_t snapshot= {0};
         unw_get_cursor_snapshot(&unwindCursor.cursor, &snapshot);
         recorder->Record(EventType::InitCursor, initResult, snapshot);
+#else
+        recorder->Record(EventType::InitCursor, initResult);
+#endif
     }
     if (initResult != 0)
     {
@@ -307,6 +469,9 @@ std::int32_t HybridUnwinder::Unwind(void* ctx, Callstack& callstack,
     // === Phase 2: Walk managed frames using the FP chain ===
     // The .NET JIT on arm64 always emits a frame record [prev_fp, saved_lr] for
     // every managed method, so FP chaining is reliable once we enter managed code.
+    // On x86_64, the JIT also sets up rbp for every method that is not a leaf, so the
+    // rbp chain [prev_rbp, return address] gives the managed callers: a method that
+    // omits the frame pointer simply does not appear in the chain.
 
     UnwindManagedFrames(&unwindCursor, callstack, recorder, stackBase, stackEnd);
 
@@ -14,7 +14,9 @@ class UnwindCursor;
 class HybridUnwinder: public IUnwinder
 {
 public:
-    HybridUnwinder(ManagedCodeCache* managedCodeCache);
+    // useUnwindTables: on x86_64, walk native frames with the unwind tables precompiled
+    // by LibrariesInfoCache and only use libunwind for the frames they do not cover
+    HybridUnwinder(ManagedCodeCache* managedCodeCache, bool useUnwindTables = false);
     ~HybridUnwinder() override = default;
 
     std::int32_t Unwind(void* ctx, Callstack& callstack,
@@ -22,9 +24,22 @@ public:
                         UnwindingRecorder* recorder = nullptr) const override;
 
 private:
+    enum class TableWalkResult
+    {
+        Finished,
+        ManagedCodeReached,
+        Fallback,
+    };
+
     bool UnwindNativeFrames(UnwindCursor* cursor, Callstack& callstack, UnwindingRecorder* recorder) const;
+    TableWalkResult UnwindNativeFramesWithTables(std::uintptr_t& ip, std::uintptr_t& sp, std::uintptr_t& fp,
+                        Callstack& callstack, UnwindingRecorder* recorder,
+                        std::uintptr_t stackBase, std::uintptr_t stackEnd) const;
     void UnwindManagedFrames(UnwindCursor* cursor, Callstack& callstack, UnwindingRecorder* recorder,
                         std::uintptr_t stackBase, std::uintptr_t stackEnd) const;
+    void UnwindManagedFrames(std::uintptr_t ip, std::uintptr_t fp, Callstack& callstack, UnwindingRecorder* recorder,
+                        std::uintptr_t stackBase, std::uintptr_t stackEnd) const;
 
     ManagedCodeCache* _codeCache;
+    bool _useUnwindTables;
 };
@@ -3,6 +3,7 @@
 
 #include "LibrariesInfoCache.h"
 
+#include "CounterMetric.h"
 #include "IConfiguration.h"
 #include "Log.h"
 #include "MeanMaxMetric.h"
@@ -150,6 +151,13 @@ LibrariesInfoCache::LibrariesInfoCache(IConfiguration* configuration, shared::pm
     _symbols{_wrappersAllocator},
     _newRegions{_wrappersAllocator},
     _newSymbols{_wrappersAllocator},
+#endif
+#ifdef AMD64
+    _isUnwindTablesEnabled{configuration->IsUnwindTablesEnabled()},
+    _unwindRegions{_wrappersAllocator},
+    _unwindRows{_wrappersAllocator},
+    _newUnwindRegions{_wrappersAllocator},
+    _newUnwindRows{_wrappersAllocator},
 #endif
     _stopRequested{false},
     _event(true),
@@ -159,6 +167,14 @@ LibrariesInfoCache::LibrariesInfoCache(IConfiguration* configuration, shared::pm
     {
         _tracker->RegisterMetrics(metricsRegistry);
     }
+
+#ifdef AMD64
+    if (_isUnwindTablesEnabled)
+    {
+        _unwindTableHitsMetric = metricsRegistry.GetOrRegister<CounterMetric>("dotnet_libs_cache_unwind_table_hits");
+        _unwindTableMissesMetric = metricsRegistry.GetOrRegister<CounterMetric>("dotnet_libs_cache_unwind_table_misses");
+    }
+#endif
 }
 
 LibrariesInfoCache::~LibrariesInfoCache() = default;
@@ -259,6 +275,10 @@ bool LibrariesInfoCache::StopImpl()
     _moduleRegions.clear();
     _symbols.clear();
 #endif
+#ifdef AMD64
+    _unwindRegions.clear();
+    _unwindRows.clear();
+#endif
 
     return true;
 }
@@ -351,6 +371,14 @@ void LibrariesInfoCache::UpdateCache()
     _newSymbols.clear();
     BuildSymbolCache(_newCache, _newRegions, _newSymbols);
 #endif
+#ifdef AMD64
+    if (_isUnwindTablesEnabled)
+    {
+        _newUnwindRegions.clear();
+        _newUnwindRows.clear();
+        BuildUnwindTables(_newCache, _newUnwindRegions, _newUnwindRows);
+    }
+#endif
 
     std::chrono::steady_clock::time_point lockStart;
     if (_tracker)
@@ -363,6 +391,10 @@ void LibrariesInfoCache::UpdateCache()
 #ifdef ARM64
         _moduleRegions.swap(_newRegions);
         _symbols.swap(_newSymbols);
+#endif
+#ifdef AMD64
+        _unwindRegions.swap(_newUnwindRegions);
+        _unwindRows.swap(_newUnwindRows);
 #endif
         if (_tracker)
         {
@@ -384,6 +416,10 @@ void LibrariesInfoCache::UpdateCache()
     _newRegions.clear();
     _newSymbols.clear();
 #endif
+#ifdef AMD64
+    _newUnwindRegions.clear();
+    _newUnwindRows.clear();
+#endif
 
     if (_tracker)
     {
@@ -617,6 +653,81 @@ int LibrariesInfoCache::GetProcNameImpl(unw_addr_space_t /*as*/, unw_word_t ip,
 }
 #endif
 
+#ifdef AMD64
+void LibrariesInfoCache::BuildUnwindTables(
+    std::vector<DlPhdrInfoWrapper, shared::pmr::polymorphic_allocator<DlPhdrInfoWrapper>>& phdrCache,
+    std::vector<UnwindTableRegion, shared::pmr::polymorphic_allocator<UnwindTableRegion>>& outRegions,
+    UnwindTableBuilder::RowsVector& outRows)
+{
+    // The rows of a library only depend on its load address: reuse the current tables
+    // for the libraries that are still loaded instead of parsing their .eh_frame again.
+    // (no lock needed: only this worker thread modifies the current tables, which are sorted by address)
+    for (auto& wrapper : phdrCache)
+    {
+        auto [info, size] = wrapper.Get();
+
+        auto const* existing = UnwindTableBuilder::FindSameLibrary(_unwindRegions.data(), _unwindRegions.size(), info);
+
+        UnwindTableRegion region{};
+        if (existing != nullptr)
+        {
+            region = *existing;
+            region.rowOffset = static_cast<std::uint32_t>(outRows.size());
+            auto first = _unwindRows.begin() + existing->rowOffset;
+            outRows.insert(outRows.end(), first, first + existing->rowCount);
+        }
+        else if (!UnwindTableBuilder::Build(info, outRows, region))
+        {
+            continue;
+        }
+
+        outRegions.push_back(region);
+    }
+
+    std::sort(outRegions.begin(), outRegions.end(),
+              [](UnwindTableRegion const& a, UnwindTableRegion const& b) { return a.addrLow < b.addrLow; });
+
+    Log::Debug("LibrariesInfoCache: Unwind tables built with ", outRegions.size(),
+               " modules and ", outRows.size(), " rows.");
+}
+
+bool LibrariesInfoCache::FindUnwindRow(std::uintptr_t ip, UnwindRow& row)
+{
+    auto* instance = s_instance.load(std::memory_order_acquire);
+    if (instance == nullptr || !instance->_isUnwindTablesEnabled)
+    {
+        return false;
+    }
+    return instance->FindUnwindRowImpl(ip, row);
+}
+
+bool LibrariesInfoCache::FindUnwindRowImpl(std::uintptr_t ip, UnwindRow& row)
+{
+    std::shared_lock lock(_cacheLock);
+
+    auto regionIt = std::upper_bound(
+        _unwindRegions.begin(), _unwindRegions.end(), ip,
+        [](std::uintptr_t addr, UnwindTableRegion const& region) { return addr < region.addrLow; });
+
+    UnwindRow const* found = nullptr;
+    if (regionIt != _unwindRegions.begin())
+    {
+        --regionIt;
+        found = UnwindTableBuilder::Find(*regionIt, _unwindRows.data(), ip);
+    }
+
+    if (found == nullptr)
+    {
+        _unwindTableMissesMetric->Incr();
+        return false;
+    }
+
+    _unwindTableHitsMetric->Incr();
+    row = *found;
+    return true;
+}
+#endif
+
 int LibrariesInfoCache::DlIteratePhdr(unw_iterate_phdr_callback_t callback, void* data)
 {
     auto* instance = s_instance.load(std::memory_order_acquire);
@@ -9,6 +9,9 @@
 
 #include "AutoResetEvent.h"
 #include "ServiceBase.h"
+#ifdef AMD64
+#include "UnwindTable.h"
+#endif
 
 #include "shared/src/native-src/dd_memory_resource.hpp"
 
@@ -36,6 +39,7 @@ struct ModuleRegion
 };
 #endif
 
+class CounterMetric;
 class IConfiguration;
 class MetricsRegistry;
 struct FootprintTracker;
@@ -54,6 +58,12 @@ public:
 
     const char* GetName() final override;
 
+#ifdef AMD64
+    // Called from the signal handler: look for the precompiled unwind rule of ip.
+    // Returns false if ip is not covered by the tables (the caller falls back to libunwind).
+    static bool FindUnwindRow(std::uintptr_t ip, UnwindRow& row);
+#endif
+
 protected:
     bool StartImpl() final override;
     bool StopImpl() final override;
@@ -91,6 +101,12 @@ private:
     int GetProcNameImpl(unw_addr_space_t as, unw_word_t ip,
                         char* buf, size_t buf_len,
                         unw_word_t* offp, void* arg);
+#endif
+#ifdef AMD64
+    void BuildUnwindTables(std::vector<DlPhdrInfoWrapper, shared::pmr::polymorphic_allocator<DlPhdrInfoWrapper>>& phdrCache,
+                           std::vector<UnwindTableRegion, shared::pmr::polymorphic_allocator<UnwindTableRegion>>& outRegions,
+                           UnwindTableBuilder::RowsVector& outRows);
+    bool FindUnwindRowImpl(std::uintptr_t ip, UnwindRow& row);
 #endif
     int DlIteratePhdrImpl(unw_iterate_phdr_callback_t callback, void* data);
     void Work(std::shared_ptr<AutoResetEvent> startEvent);
@@ -120,6 +136,16 @@ private:
     GetProcNameFn _originalGetProcName = nullptr;
 #endif
 
+#ifdef AMD64
+    bool _isUnwindTablesEnabled;
+    std::vector<UnwindTableRegion, shared::pmr::polymorphic_allocator<UnwindTableRegion>> _unwindRegions;
+    UnwindTableBuilder::RowsVector _unwindRows;
+    std::vector<UnwindTableRegion, shared::pmr::polymorphic_allocator<UnwindTableRegion>> _newUnwindRegions;
+    UnwindTableBuilder::RowsVector _newUnwindRows;
+    std::shared_ptr<CounterMetric> _unwindTableHitsMetric;
+    std::shared_ptr<CounterMetric> _unwindTableMissesMetric;
+#endif
+
     std::thread _worker;
     std::atomic<bool> _stopRequested;
     AutoResetEvent _event;
@@ -3,14 +3,19 @@
 
 #include "LinuxStackFramesCollector.h"
 
+#include <algorithm>
 #include <cassert>
 #include <chrono>
 #include <errno.h>
 #include <iomanip>
 // No need to add UNW_LOCAL_ONLY here, we do not call unw_backtraceXX here.
 #include <libunwind.h>
+#include <linux/futex.h>
 #include <mutex>
+#include <sys/syscall.h>
+#include <thread>
 #include <ucontext.h>
+#include <unistd.h>
 #include <unordered_map>
 
 #include "CallstackProvider.h"
@@ -28,6 +33,8 @@ using namespace std::chrono_literals;
 
 std::mutex LinuxStackFramesCollector::s_stackWalkInProgressMutex;
 std::atomic<LinuxStackFramesCollector*> LinuxStackFramesCollector::s_pInstanceCurrentlyStackWalking = nullptr;
+std::atomic<std::uint32_t> LinuxStackFramesCollector::s_batchState = 0;
+std::atomic<LinuxStackFramesCollector::BatchedStackWalk*> LinuxStackFramesCollector::s_pCurrentBatch = nullptr;
 
 LinuxStackFramesCollector::LinuxStackFramesCollector(
     ProfilerSignalManager* signalManager,
@@ -41,7 +48,9 @@ LinuxStackFramesCollector::LinuxStackFramesCollector(
     _processId{OpSysTools::GetProcId()},
     _signalManager{signalManager},
     _errorStatistics{},
-    _pUnwinder{pUnwinder}
+    _pUnwinder{pUnwinder},
+    _pBatch{nullptr},
+    _pRetiredBatch{nullptr}
 {
     if (_signalManager != nullptr)
     {
@@ -182,6 +191,253 @@ StackSnapshotResultBuffer* LinuxStackFramesCollector::CollectStackSampleImplemen
     return GetStackSnapshotResult();
 }
 
+bool LinuxStackFramesCollector::CollectStackSamples(std::vector<StackSampleRequest>& requests)
+{
+    if (_signalManager == nullptr || !_signalManager->IsHandlerInPlace())
+    {
+        return false;
+    }
+
+    if (requests.empty())
+    {
+        return true;
+    }
+
+    // Exclude the one-thread-at-a-time collection
+    std::unique_lock<std::mutex> stackWalkInProgressLock(s_stackWalkInProgressMutex);
+
+    // A signal handler of a previous batch is still running: the next batch can't be published
+    // before it leaves so the threads are not sampled this time.
+    if (!WaitForBatchHandlersToLeave(100ms))
+    {
+        for (auto& request : requests)
+        {
+            request.ErrorCode = E_ABORT;
+            UpdateErrorStats(request.ErrorCode);
+        }
+
+        Log::Debug("LinuxStackFramesCollector::CollectStackSamples: batch of ", requests.size(), " threads skipped",
+                   " (", s_batchState.load() & ~BatchOpenFlag, " signal handlers of a previous batch in flight).");
+        return true;
+    }
+    _pRetiredBatch.reset();
+
+    // Everything that allocates must be done before signaling the threads
+    if (_pBatch == nullptr || _pBatch->Capacity < requests.size())
+    {
+        _pBatch = std::make_unique<BatchedStackWalk>(this, requests.size());
+    }
+
+    auto& batch = *_pBatch;
+    batch.Reset(requests, _callstackProvider);
+    s_pCurrentBatch = &batch;
+    s_batchState.fetch_or(BatchOpenFlag);
+
+    for (std::size_t i = 0; i < batch.Size; i++)
+    {
+        auto& slot = batch.Slots[i];
+        const auto threadId = static_cast<::pid_t>(slot.ThreadInfo->GetOsThreadId());
+
+        _samplingRequest->Incr();
+        if (_signalManager->SendSignal(threadId) == -1)
+        {
+            // make sure a late handler won't touch this slot
+            bool expected = false;
+            if (slot.Claimed.compare_exchange_strong(expected, true))
+            {
+                slot.ErrorCode = E_FAIL;
+                slot.IsCompleted = true;
+                NotifyBatchedStackWalkCompleted(batch);
+            }
+        }
+    }
+
+    auto isCompleted = WaitForBatchedStackWalks(2s);
+
+    // Stop accepting new handlers and wait for the ones in flight before
+    // handing the callstacks back to the caller.
+    s_batchState.fetch_and(~BatchOpenFlag);
+    auto haveHandlersLeft = WaitForBatchHandlersToLeave(100ms);
+
+    if (!isCompleted && !_signalManager->CheckSignalHandler())
+    {
+        Log::Info("Profiler signal handler was replaced but we failed or stopped at restoring it. We won't be able to collect callstacks.");
+    }
+
+    // As for the one-thread-at-a-time collection, a thread that did not walk its callstack in time
+    // (or after the StackSamplerLoopManager requested to abort the collection) is given up on.
+    // A signal handler called later finds the batch closed: only a handler still running
+    // prevents the batch from being reused. It is retired until the handler leaves.
+    auto isRetired = !haveHandlersLeft;
+
+    for (std::size_t i = 0; i < batch.Size; i++)
+    {
+        auto& request = requests[i];
+        auto& slot = batch.Slots[i];
+        if (slot.IsCompleted)
+        {
+            request.Stack = std::move(slot.Stack);
+            request.LocalRootSpanId = slot.LocalRootSpanId;
+            request.SpanId = slot.SpanId;
+            request.ErrorCode = slot.ErrorCode;
+        }
+        else
+        {
+            request.ErrorCode = E_ABORT;
+        }
+
+        if (request.ErrorCode < 0)
+        {
+            UpdateErrorStats(request.ErrorCode);
+        }
+
+        if (!isRetired)
+        {
+            slot.ThreadInfo.reset();
+        }
+    }
+
+    if (!isCompleted)
+    {
+        Log::Debug("LinuxStackFramesCollector::CollectStackSamples: batch of ", batch.Size, " threads abandoned",
+                   " (", batch.PendingCount.load(), " pending, ", s_batchState.load() & ~BatchOpenFlag, " signal handlers in flight).");
+    }
+
+    if (isRetired)
+    {
+        _pRetiredBatch = std::move(_pBatch);
+    }
+
+    return true;
+}
+
+bool LinuxStackFramesCollector::WaitForBatchedStackWalks(std::chrono::milliseconds timeout)
+{
+    auto& batch = *_pBatch;
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (true)
+    {
+        auto pendingCount = batch.PendingCount.load();
+        if (pendingCount == 0)
+        {
+            return true;
+        }
+
+        auto now = std::chrono::steady_clock::now();
+        if (now >= deadline || IsCurrentCollectionAbortRequested())
+        {
+            return false;
+        }
+
+        // wake up regularly to check if the StackSamplerLoopManager requested to abort the collection
+        auto remaining = (std::min)(std::chrono::duration_cast<std::chrono::nanoseconds>(deadline - now), std::chrono::nanoseconds(10ms));
+        struct timespec ts;
+        ts.tv_sec = remaining.count() / 1'000'000'000;
+        ts.tv_nsec = remaining.count() % 1'000'000'000;
+
+        // returns immediately if the counter changed in between
+        syscall(SYS_futex, reinterpret_cast<std::int32_t*>(&batch.PendingCount), FUTEX_WAIT_PRIVATE, pendingCount, &ts, nullptr, 0);
+    }
+}
+
+bool LinuxStackFramesCollector::WaitForBatchHandlersToLeave(std::chrono::milliseconds timeout)
+{
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    while ((s_batchState.load() & ~BatchOpenFlag) != 0)
+    {
+        if (std::chrono::steady_clock::now() >= deadline || IsCurrentCollectionAbortRequested())
+        {
+            return false;
+        }
+
+        std::this_thread::yield();
+    }
+
+    return true;
+}
+
+void LinuxStackFramesCollector::NotifyBatchedStackWalkCompleted(BatchedStackWalk& batch)
+{
+    // async-signal-safe: atomic decrement + futex syscall only
+    if (batch.PendingCount.fetch_sub(1) == 1)
+    {
+        syscall(SYS_futex, reinterpret_cast<std::int32_t*>(&batch.PendingCount), FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+    }
+}
+
+LinuxStackFramesCollector::BatchedStackWalk::BatchedStackWalk(LinuxStackFramesCollector* collector, std::size_t capacity) :
+    Collector{collector},
+    Capacity{capacity},
+    Slots{std::make_unique<Slot[]>(capacity)},
+    Size{0},
+    Index{nullptr},
+    IndexMask{0},
+    PendingCount{0}
+{
+    // keep the index at most half full so that the probing sequences stay short
+    std::size_t indexCapacity = 2;
+    while (indexCapacity < 2 * capacity)
+    {
+        indexCapacity *= 2;
+    }
+
+    Index = std::make_unique<IndexEntry[]>(indexCapacity);
+    IndexMask = indexCapacity - 1;
+}
+
+static std::size_t GetThreadIdHash(pid_t threadId)
+{
+    return static_cast<std::size_t>((static_cast<std::uint64_t>(threadId) * 0x9E3779B97F4A7C15ull) >> 32);
+}
+
+void LinuxStackFramesCollector::BatchedStackWalk::Reset(std::vector<StackSampleRequest> const& requests, CallstackProvider* callstackProvider)
+{
+    std::fill_n(Index.get(), IndexMask + 1, IndexEntry{0, 0});
+
+    for (std::size_t i = 0; i < requests.size(); i++)
+    {
+        auto& slot = Slots[i];
+        slot.ThreadInfo = requests[i].ThreadInfo;
+        slot.Stack = callstackProvider->Get();
+        slot.LocalRootSpanId = 0;
+        slot.SpanId = 0;
+        slot.ErrorCode = E_ABORT;
+        slot.IsCompleted = false;
+        slot.Claimed = false;
+
+        const auto threadId = static_cast<pid_t>(slot.ThreadInfo->GetOsThreadId());
+        auto position = GetThreadIdHash(threadId) & IndexMask;
+        while (Index[position].ThreadId != 0)
+        {
+            position = (position + 1) & IndexMask;
+        }
+        Index[position] = {threadId, static_cast<std::int32_t>(i)};
+    }
+
+    Size = requests.size();
+    PendingCount = static_cast<std::int32_t>(requests.size());
+}
+
+LinuxStackFramesCollector::BatchedStackWalk::Slot* LinuxStackFramesCollector::BatchedStackWalk::FindSlot(pid_t threadId) const
+{
+    auto position = GetThreadIdHash(threadId) & IndexMask;
+    while (true)
+    {
+        auto const& entry = Index[position];
+        if (entry.ThreadId == threadId)
+        {
+            return &Slots[entry.Slot];
+        }
+
+        if (entry.ThreadId == 0)
+        {
+            return nullptr;
+        }
+
+        position = (position + 1) & IndexMask;
+    }
+}
+
 void LinuxStackFramesCollector::NotifyStackWalkCompleted(std::int32_t resultErrorCode)
 {
     _lastStackWalkErrorCode = resultErrorCode;
@@ -280,6 +536,74 @@ bool LinuxStackFramesCollector::CanCollect(int32_t threadId, siginfo_t* info, vo
     return true;
 }
 
+bool LinuxStackFramesCollector::CollectBatchedCallStackCurrentThread(BatchedStackWalk& batch, siginfo_t* info, void* context)
+{
+    if (info->si_pid != _processId)
+    {
+        _discardMetrics->Incr<DiscardReason::ExternalSignal>();
+        return false;
+    }
+
+    auto* slot = batch.FindSlot(OpSysTools::GetThreadId());
+    if (slot == nullptr)
+    {
+        _discardMetrics->Incr<DiscardReason::WrongManagedThread>();
+        return false;
+    }
+
+    // the request could have been already handled (another signal) or abandoned
+    bool expected = false;
+    if (!slot->Claimed.compare_exchange_strong(expected, true))
+    {
+        return false;
+    }
+
+    slot->ThreadInfo->MarkAsInterrupted();
+
+    // This is a workaround to prevent libunwind from unwinding 2 signal frames and potentially crashing.
+    if (IsInSigSegvHandler(context))
+    {
+        _discardMetrics->Incr<DiscardReason::InSegvHandler>();
+        slot->ErrorCode = E_ABORT;
+    }
+    else
+    {
+        slot->ErrorCode = CollectBatchedStack(*slot, context);
+    }
+
+    slot->IsCompleted = true;
+    NotifyBatchedStackWalkCompleted(batch);
+    return true;
+}
+
+std::int32_t LinuxStackFramesCollector::CollectBatchedStack(BatchedStackWalk::Slot& slot, void* ctx)
+{
+    if (dd_inside_wrapped_functions != nullptr && dd_inside_wrapped_functions() != 0)
+    {
+        _discardMetrics->Incr<DiscardReason::InsideWrappedFunction>();
+        return E_ABORT;
+    }
+
+    try
+    {
+        std::tie(slot.LocalRootSpanId, slot.SpanId) = GetTraceContext(slot.ThreadInfo.get());
+
+        auto [stackBase, stackEnd] = slot.ThreadInfo->GetStackBounds();
+        auto count = _pUnwinder->Unwind(ctx, slot.Stack, stackBase, stackEnd, nullptr);
+        if (count == 0)
+        {
+            _discardMetrics->Incr<DiscardReason::EmptyBacktrace>();
+            return E_FAIL;
+        }
+
+        return S_OK;
+    }
+    catch (...)
+    {
+        return E_ABORT;
+    }
+}
+
 void LinuxStackFramesCollector::MarkAsInterrupted()
 {
     auto* currentThreadInfo = _pCurrentCollectionThreadInfo;
@@ -297,6 +621,23 @@ bool LinuxStackFramesCollector::CollectStackSampleSignalHandler(int signal, sigi
 
     bool success = false;
 
+    // batched collection: no lock, each thread unwinds into its own slot
+    // Entering the batch and checking that it is still open is a single CAS: the sampler thread
+    // does not publish another batch nor free this one while a handler is counted.
+    auto batchState = s_batchState.load();
+    while ((batchState & BatchOpenFlag) != 0)
+    {
+        if (s_batchState.compare_exchange_weak(batchState, batchState + 1))
+        {
+            BatchedStackWalk* pBatch = s_pCurrentBatch;
+            success = pBatch->Collector->CollectBatchedCallStackCurrentThread(*pBatch, info, context);
+            s_batchState.fetch_sub(1);
+
+            errno = oldErrno;
+            return success;
+        }
+    }
+
     LinuxStackFramesCollector* pCollector = s_pInstanceCurrentlyStackWalking;
 
     if (pCollector != nullptr)
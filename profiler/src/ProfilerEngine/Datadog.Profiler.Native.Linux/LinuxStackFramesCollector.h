@@ -13,11 +13,13 @@
 #include "StackFramesCollectorBase.h"
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <memory>
 #include <mutex>
 #include <signal.h>
 #include <unordered_map>
+#include <vector>
 
 class IManagedThreadList;
 class ProfilerSignalManager;
@@ -41,6 +43,17 @@ public:
     LinuxStackFramesCollector(LinuxStackFramesCollector const&) = delete;
     LinuxStackFramesCollector& operator=(LinuxStackFramesCollector const&) = delete;
 
+    // Signals all the requested threads at once: each signal handler unwinds into the
+    // callstack of its own request and the sampler thread waits for a single completion counter.
+    bool CollectStackSamples(std::vector<StackSampleRequest>& requests) override;
+
+#ifdef DD_TEST
+    bool HasRetiredBatchForTests() const
+    {
+        return _pRetiredBatch != nullptr;
+    }
+#endif
+
 protected:
     // Linux collector is different from Windows:
     // There is no notion to Suspend/Resume a thread and to have an external thread walk the suspended thread.
@@ -72,6 +85,50 @@ private:
     std::int32_t CollectStack(void* ctx);
     void MarkAsInterrupted();
 
+    // State of a batched collection shared with the signal handlers of its threads.
+    // Everything is allocated by the sampler thread before signaling the threads.
+    struct BatchedStackWalk
+    {
+        struct Slot
+        {
+            std::shared_ptr<ManagedThreadInfo> ThreadInfo;
+            Callstack Stack;
+            std::uint64_t LocalRootSpanId = 0;
+            std::uint64_t SpanId = 0;
+            std::int32_t ErrorCode = 0;
+            // the request could be handled by the signal handler or abandoned by the sampler thread
+            std::atomic<bool> Claimed{false};
+            // set once the callstack is written
+            std::atomic<bool> IsCompleted{false};
+        };
+
+        struct IndexEntry
+        {
+            pid_t ThreadId; // 0 for an empty entry
+            std::int32_t Slot;
+        };
+
+        BatchedStackWalk(LinuxStackFramesCollector* collector, std::size_t capacity);
+        void Reset(std::vector<StackSampleRequest> const& requests, CallstackProvider* callstackProvider);
+        // async-signal-safe: open addressing lookup in the index built by Reset
+        Slot* FindSlot(pid_t threadId) const;
+
+        LinuxStackFramesCollector* const Collector;
+        std::size_t const Capacity;
+        std::unique_ptr<Slot[]> Slots;
+        std::size_t Size;
+        std::unique_ptr<IndexEntry[]> Index;
+        std::size_t IndexMask;
+        // also used as a futex: the sampler thread waits for it to reach 0
+        std::atomic<std::int32_t> PendingCount;
+    };
+
+    bool CollectBatchedCallStackCurrentThread(BatchedStackWalk& batch, siginfo_t* info, void* ctx);
+    std::int32_t CollectBatchedStack(BatchedStackWalk::Slot& slot, void* ctx);
+    static void NotifyBatchedStackWalkCompleted(BatchedStackWalk& batch);
+    bool WaitForBatchedStackWalks(std::chrono::milliseconds timeout);
+    bool WaitForBatchHandlersToLeave(std::chrono::milliseconds timeout);
+
     std::int32_t _lastStackWalkErrorCode;
     std::condition_variable _stackWalkInProgressWaiter;
     // since we wait for a specific amount of time, if a call to notify_one
@@ -90,6 +147,15 @@ private:
 
     static std::atomic<LinuxStackFramesCollector*> s_pInstanceCurrentlyStackWalking;
 
+    // batched collection: the signal handlers enter the current batch with a single CAS on s_batchState
+    // (number of handlers in flight + open flag). A batch that is still used by a late signal handler is
+    // retired and freed by the next collection once all handlers have left.
+    static constexpr std::uint32_t BatchOpenFlag = 1u << 31;
+    static std::atomic<std::uint32_t> s_batchState;
+    static std::atomic<BatchedStackWalk*> s_pCurrentBatch;
+    std::unique_ptr<BatchedStackWalk> _pBatch;
+    std::unique_ptr<BatchedStackWalk> _pRetiredBatch;
+
     std::int32_t CollectCallStackCurrentThread(void* ctx);
 
     ErrorStatistics _errorStatistics;
@@ -26,9 +26,10 @@
 #include "ScopeFinalizer.h"
 
 #include "IUnwinder.h"
-#ifdef ARM64
+#if defined(ARM64) || defined(AMD64)
 #include "HybridUnwinder.h"
-#else
+#endif
+#ifndef ARM64
 #include "Backtrace2Unwinder.h"
 #endif
 #include "IConfiguration.h"
@@ -36,9 +37,11 @@
 #include "LinuxStackFramesCollector.h"
 #include "LinuxThreadInfo.h"
 #include "Log.h"
+#include "ManagedThreadInfo.h"
 #include "OpSysTools.h"
 #include "ProfilerSignalManager.h"
 #include "StackFramesCollectorBase.h"
+#include "ThreadStatFile.h"
 #include "shared/src/native-src/loader.h"
 
 class CallstackProvider;
@@ -53,13 +56,25 @@ static auto ticks_per_second = sysconf(_SC_CLK_TCK);
 
 static IUnwinder* s_pUnwinder = nullptr;
 
-void InitializeUnwinder(ManagedCodeCache* managedCodeCache)
+std::unique_ptr<IUnwinder> CreateUnwinder(ManagedCodeCache* managedCodeCache, IConfiguration const* pConfiguration)
 {
-#ifdef ARM64
-    static auto unwinder = std::make_unique<HybridUnwinder>(managedCodeCache);
+#if defined(ARM64)
+    return std::make_unique<HybridUnwinder>(managedCodeCache);
 #else
-    static auto unwinder = std::make_unique<Backtrace2Unwinder>();
+#if defined(AMD64)
+    // the hybrid unwinder needs the managed code cache to know when to switch to the rbp chain
+    if (managedCodeCache != nullptr)
+    {
+        return std::make_unique<HybridUnwinder>(managedCodeCache, pConfiguration->IsUnwindTablesEnabled());
+    }
 #endif
+    return std::make_unique<Backtrace2Unwinder>();
+#endif
+}
+
+void InitializeUnwinder(ManagedCodeCache* managedCodeCache, IConfiguration const* pConfiguration)
+{
+    static auto unwinder = CreateUnwinder(managedCodeCache, pConfiguration);
     s_pUnwinder = unwinder.get();
 }
 
@@ -111,34 +126,27 @@ std::unique_ptr<StackFramesCollectorBase> CreateNewStackFramesCollectorInstance(
 //    if (clock_gettime(clockid, &cpu_time)) { ... }
 //
 
-bool BuildThreadStatPath(pid_t tid, char* statPath, int capacity)
+bool ParseCpuInfo(char const* line, bool& isRunning, uint64_t& cpuTime)
 {
-    strncpy(statPath, "/proc/self/task/", 16);
-    int base = 1000000000;
-
-    // Adjust the base
-    while (base > tid)
-    {
-        base /= 10;
-    }
-
-    int offset = 16;
-    // Write each number to the string
-    while (base > 0 && offset < 64)
+    char state = ' ';
+    int32_t userTime = 0;
+    int32_t kernelTime = 0;
+    bool success = OpSysTools::ParseThreadInfo(line, state, userTime, kernelTime);
+    if (!success)
     {
-        statPath[offset++] = (tid / base) + '0';
-        tid %= base;
-        base /= 10;
-    }
+        static bool firstError = true;
+        // log the first error to be able to analyze unexpected string format
+        if (firstError)
+        {
+            firstError = false;
+            Log::Info("Unexpected line format in thread stat file: ", line);
+        }
 
-    // check in case of misusage
-    if (offset >= capacity || offset + 5 >= capacity)
-    {
         return false;
     }
 
-    strncpy(statPath + offset, "/stat", 5);
-
+    cpuTime = ((userTime + kernelTime) * 1000) / ticks_per_second;
+    isRunning = (state == 'R') || (state == 'D') || (state == 'W');
     return true;
 }
 
@@ -146,7 +154,7 @@ bool GetCpuInfo(pid_t tid, bool& isRunning, uint64_t& cpuTime)
 {
     char statPath[64] = {0};
 
-    if (!BuildThreadStatPath(tid, statPath, 64))
+    if (!ThreadStatFile::BuildPath(tid, statPath, 64))
     {
         return false;
     }
@@ -170,26 +178,7 @@ bool GetCpuInfo(pid_t tid, bool& isRunning, uint64_t& cpuTime)
         return false;
     }
 
-    char state = ' ';
-    int32_t userTime = 0;
-    int32_t kernelTime = 0;
-    bool success = OpSysTools::ParseThreadInfo(line, state, userTime, kernelTime);
-    if (!success)
-    {
-        static bool firstError = true;
-        // log the first error to be able to analyze unexpected string format
-        if (firstError)
-        {
-            firstError = false;
-            Log::Info("Unexpected line format in ", statPath, ": ", line);
-        }
-
-        return false;
-    }
-
-    cpuTime = ((userTime + kernelTime) * 1000) / ticks_per_second;
-    isRunning = (state == 'R') || (state == 'D') || (state == 'W');
-    return true;
+    return ParseCpuInfo(line, isRunning, cpuTime);
 }
 
 std::chrono::milliseconds GetThreadCpuTime(IThreadInfo* pThreadInfo)
@@ -205,11 +194,21 @@ std::chrono::milliseconds GetThreadCpuTime(IThreadInfo* pThreadInfo)
 }
 
 //    isRunning,        cpu time          , failed 
-std::tuple<bool, std::chrono::milliseconds, bool> IsRunning(IThreadInfo* pThreadInfo)
+std::tuple<bool, std::chrono::milliseconds, bool> IsRunning(ManagedThreadInfo* pThreadInfo)
 {
+    // called for each managed thread on each cpu profiling iteration: the stat file is kept opened
+    // in the thread info instead of being opened/closed each time
+    char line[1024];
+    auto length = pThreadInfo->GetStatFile().Read(pThreadInfo->GetOsThreadId(), line, sizeof(line) - 1);
+    if (length <= 0)
+    {
+        return {false, 0ms, true};
+    }
+    line[length] = '\0';
+
     bool isRunning = false;
     uint64_t cpuTime = 0;
-    if (!GetCpuInfo(pThreadInfo->GetOsThreadId(), isRunning, cpuTime))
+    if (!ParseCpuInfo(line, isRunning, cpuTime))
     {
         return {false, 0ms, true};
     }
@@ -13,7 +13,10 @@
 #include "SampleValueTypeProvider.h"
 #include "RawSampleTransformer.h"
 
+#include <sched.h>
+
 #include <memory>
+#include <vector>
 
 template <typename TRawSample>
 class RawSampleCollectorBase : public ServiceBase,
@@ -98,10 +101,23 @@ public:
         RawSampleTransformer* rawSampleTransformer,
         RingBuffer* ringBuffer,
         MetricsRegistry& metricsRegistry) :
+        RawSampleCollectorBase(name, std::move(valueOffsets), rawSampleTransformer, std::vector<RingBuffer*>{ringBuffer}, metricsRegistry)
+    {
+    }
+
+    // When more than one ring buffer is given, each one is used as a per-CPU shard:
+    // the writer picks the shard of the CPU it is running on, so writers running on
+    // different CPUs do not compete for the same cursor (cache line).
+    RawSampleCollectorBase(
+        const char* name,
+        std::vector<SampleValueTypeProvider::Offset> valueOffsets,
+        RawSampleTransformer* rawSampleTransformer,
+        std::vector<RingBuffer*> ringBuffers,
+        MetricsRegistry& metricsRegistry) :
         ProviderBase(name),
         _valueOffsets{std::move(valueOffsets)},
         _rawSampleTransformer{rawSampleTransformer},
-        _collectedSamples{ringBuffer},
+        _collectedSamples{std::move(ringBuffers)},
         _failedReservationMetric{metricsRegistry.GetOrRegister<DiscardMetrics>("dotnet_raw_sample_failed_allocation")}
     {
     }
@@ -110,7 +126,7 @@ public:
 
     SampleHolder GetRawSample()
     {
-        return SampleHolder(_collectedSamples, _failedReservationMetric.get());
+        return SampleHolder(GetCurrentShard(), _failedReservationMetric.get());
     }
     
     const char* GetName() override
@@ -120,42 +136,107 @@ public:
 
     std::unique_ptr<SamplesEnumerator> GetSamples() override
     {
-        return std::make_unique<SamplesEnumeratorImpl>(std::move(_collectedSamples->GetReader()), _rawSampleTransformer, _valueOffsets);
+        std::vector<RingBuffer::Reader> readers;
+        readers.reserve(_collectedSamples.size());
+        for (auto* ringBuffer : _collectedSamples)
+        {
+            readers.push_back(ringBuffer->GetReader());
+        }
+
+        return std::make_unique<SamplesEnumeratorImpl>(std::move(readers), _rawSampleTransformer, _valueOffsets);
     }
 
 private:
+    // Called from the signal handler: sched_getcpu is served by the vDSO (or rseq)
+    // and does not take any lock.
+    RingBuffer* GetCurrentShard() const
+    {
+        auto nbShards = _collectedSamples.size();
+        if (nbShards == 1)
+        {
+            return _collectedSamples[0];
+        }
+
+        auto cpu = sched_getcpu();
+        if (cpu < 0)
+        {
+            cpu = 0;
+        }
+        return _collectedSamples[static_cast<std::size_t>(cpu) % nbShards];
+    }
+
+    // Merges the shards in timestamp order: each shard is already sorted
+    // so picking the oldest head at each step is enough.
     class SamplesEnumeratorImpl : public SamplesEnumerator
     {
     public:
-        SamplesEnumeratorImpl(RingBuffer::Reader&& reader,
+        SamplesEnumeratorImpl(std::vector<RingBuffer::Reader>&& readers,
                               RawSampleTransformer* rawSampleTransformer,
                               std::vector<SampleValueTypeProvider::Offset> const& valueOffsets) :
-            _reader{std::move(reader)},
+            _readers{std::move(readers)},
+            _heads(_readers.size()),
             _rawSampleTransformer{rawSampleTransformer},
             _valueOffsets{valueOffsets}
         {
+            // Samples stay valid until their Reader is destroyed, so we can peek
+            // at the head of each shard.
+            for (std::size_t i = 0; i < _readers.size(); i++)
+            {
+                _heads[i] = _readers[i].GetNext();
+            }
         }
 
         SamplesEnumeratorImpl(SamplesEnumeratorImpl const&) = delete;
         SamplesEnumeratorImpl& operator=(SamplesEnumeratorImpl const&) = delete;
         SamplesEnumeratorImpl(SamplesEnumeratorImpl&&) = delete;
         SamplesEnumeratorImpl& operator=(SamplesEnumeratorImpl&&) = delete;
-        ~SamplesEnumeratorImpl() override = default;
+        ~SamplesEnumeratorImpl() override
+        {
+            // release the samples we peeked at but that were not enumerated
+            for (auto const& head : _heads)
+            {
+                if (!head.empty())
+                {
+                    std::destroy_at(const_cast<TRawSample*>(reinterpret_cast<TRawSample const*>(head.data())));
+                }
+            }
+        }
 
         // Inherited via SamplesEnumerator
         std::size_t size() const override
         {
-            return _reader.AvailableSamples();
+            std::size_t size = 0;
+            for (auto const& reader : _readers)
+            {
+                size += reader.AvailableSamples();
+            }
+            return size;
         }
 
         bool MoveNext(std::shared_ptr<Sample>& sample) override
         {
-            ConstBuffer buffer = _reader.GetNext();
-            if (buffer.empty())
+            std::size_t current = _heads.size();
+            for (std::size_t i = 0; i < _heads.size(); i++)
+            {
+                if (_heads[i].empty())
+                {
+                    continue;
+                }
+
+                if (current == _heads.size() || GetTimestamp(_heads[i]) < GetTimestamp(_heads[current]))
+                {
+                    current = i;
+                }
+            }
+
+            if (current == _heads.size())
             {
                 return false;
             }
 
+            ConstBuffer buffer = _heads[current];
+            _heads[current] = _readers[current].GetNext();
+
             auto* rawSample = const_cast<TRawSample*>(
                 reinterpret_cast<TRawSample const*>(buffer.data()));
 
@@ -165,7 +246,13 @@ private:
         }
 
     private:
-        RingBuffer::Reader _reader;
+        static std::chrono::nanoseconds GetTimestamp(ConstBuffer const& buffer)
+        {
+            return reinterpret_cast<TRawSample const*>(buffer.data())->Timestamp;
+        }
+
+        std::vector<RingBuffer::Reader> _readers;
+        std::vector<ConstBuffer> _heads;
         RawSampleTransformer* _rawSampleTransformer;
         std::vector<SampleValueTypeProvider::Offset> const& _valueOffsets;
     };
@@ -182,6 +269,6 @@ private:
 
     std::vector<SampleValueTypeProvider::Offset> _valueOffsets;
     RawSampleTransformer* _rawSampleTransformer;
-    RingBuffer* _collectedSamples;
+    std::vector<RingBuffer*> _collectedSamples;
     std::shared_ptr<DiscardMetrics> _failedReservationMetric;
 };
\ No newline at end of file
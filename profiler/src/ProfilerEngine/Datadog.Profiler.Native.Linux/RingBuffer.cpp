@@ -5,13 +5,11 @@
 
 #include "Log.h"
 #include "OpSysTools.h"
-#include "SpinningMutex.hpp"
 
 #include <errno.h>
 #include <string.h>
 #include <unistd.h>
 #include <cassert>
-#include <mutex>
 #include <new>
 #include <ostream>
 #include <tuple>
@@ -37,7 +35,6 @@ public:
                                            // part read by reader but not yet reflected
                                            // to the writer
     std::size_t sample_size; // size of a sample, used to compute the number of samples
-    SpinningMutex* spinlock;
     int mapfd;
 };
 
@@ -48,7 +45,6 @@ struct RingBufferMetaDataPage
 {
     alignas(hardware_destructive_interference_size) uint64_t writer_pos = 0;
     alignas(hardware_destructive_interference_size) uint64_t reader_pos = 0;
-    alignas(hardware_destructive_interference_size) SpinningMutex spinlock;
 };
 
 std::size_t GetMetadataSize()
@@ -199,7 +195,6 @@ std::pair<RingBuffer::RingBufferUniquePtr, std::string> RingBuffer::Create(std::
     rb->reader_pos = &meta->reader_pos;
     rb->writer_pos = &meta->writer_pos;
     rb->intermediate_reader_pos = 0;
-    rb->spinlock = new (&meta->spinlock) SpinningMutex();
     rb->sample_size = sampleSize;
 
     return {std::move(rb), ""};
@@ -227,6 +222,7 @@ void RingBuffer::Reset()
     *_impl->writer_pos = 0;
     *_impl->reader_pos = 0;
     _impl->intermediate_reader_pos = 0;
+    memset(_impl->data, 0, _impl->data_size);
 }
 
 std::size_t RingBuffer::GetSize() const
@@ -237,13 +233,11 @@ std::size_t RingBuffer::GetSize() const
     }
     return _impl->data_size + _impl->meta_size;
 }
-
-SpinningMutex* RingBuffer::GetLock()
-{
-    return _impl->spinlock;
-}
 #endif // DD_TEST
 
+// A header equal to 0 means that a writer has claimed the slot (writer_pos moved past it)
+// but has not published the header yet. This relies on the reader zeroing the memory it
+// consumed before handing it back to the writers (see Reader::~Reader).
 struct BufferHeader
 {
     uint64_t size;
@@ -258,6 +252,10 @@ struct BufferHeader
     {
         return size & k_discard_bit;
     }
+    static bool is_published(uint64_t size)
+    {
+        return size != 0;
+    }
 
     [[nodiscard]] size_t get_size() const
     {
@@ -283,39 +281,49 @@ Buffer RingBuffer::Writer::Reserve(bool* timeout) const
     }
 
     auto* rb = _rb;
-    // \fixme{gleocadie} Not sure if spinlock is the best option here
-    std::unique_lock const lock{*rb->spinlock, ReserveTimeout};
-    if (!lock.owns_lock())
+
+    // Multiple writers (i.e. signal handlers running on different threads) compete for
+    // the same region: claim [writer_pos, writer_pos + n2) by moving the writer cursor
+    // with a CAS. No lock is taken, so a writer interrupted in the middle of a reservation
+    // does not prevent the others from making progress.
+    std::uint64_t writer_pos = __atomic_load_n(rb->writer_pos, __ATOMIC_RELAXED);
+    std::uint32_t attempts = 0;
+    while (true)
     {
-        // timeout on lock
-        if (timeout)
+        std::uint64_t const new_writer_pos = writer_pos + n2;
+
+        // Check that there is enough free space
+        // (acquire: synchronize with the reader that released (and zeroed) this region)
+        std::uint64_t head = __atomic_load_n(rb->reader_pos, __ATOMIC_ACQUIRE);
+        if (rb->mask < new_writer_pos - head)
         {
-            *timeout = true;
+            return {};
         }
-        return {};
-    }
-
-    // No need for atomic operation, since we hold the lock
-    std::uint64_t const writer_pos = *rb->writer_pos;
 
-    std::uint64_t const new_writer_pos = writer_pos + n2;
+        // On failure, writer_pos is updated with the current value of the cursor
+        if (__atomic_compare_exchange_n(rb->writer_pos, &writer_pos, new_writer_pos,
+                                        /*weak*/ true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+        {
+            break;
+        }
 
-    // Check that there is enough free space
-    std::uint64_t head = __atomic_load_n(_rb->reader_pos, __ATOMIC_ACQUIRE);
-    if (rb->mask < new_writer_pos - head)
-    {
-        return {};
+        if (++attempts >= MaxReserveAttempts) [[unlikely]]
+        {
+            if (timeout)
+            {
+                *timeout = true;
+            }
+            return {};
+        }
     }
 
     uint64_t const head_linear = writer_pos & rb->mask;
     auto* hdr =
         reinterpret_cast<BufferHeader*>(rb->data + head_linear);
 
-    // Mark the sample as reserved
-    hdr->size = size | BufferHeader::k_reserved_bit;
-
-    // Atomic operation required to synchronize with reader load_acquire
-    __atomic_store_n(rb->writer_pos, new_writer_pos, __ATOMIC_RELEASE);
+    // Mark the sample as reserved.
+    // Until this store is visible, the reader sees a zeroed header and stops there.
+    __atomic_store_n(&hdr->size, size | BufferHeader::k_reserved_bit, __ATOMIC_RELEASE);
 
     return {reinterpret_cast<std::byte*>(hdr + 1), size};
 }
@@ -355,6 +363,14 @@ RingBuffer::Reader::~Reader()
 {
     if (_rb && *_rb->reader_pos < _rb->intermediate_reader_pos)
     {
+        // Zero the consumed region before giving it back to the writers: a slot claimed
+        // by a writer must read as "not published" until the writer stores its header.
+        // Since the sample size is not necessarily a divisor of the buffer size, the next
+        // headers can land anywhere in this region, so it is cleared entirely.
+        // The double mapping makes [reader_pos, intermediate_reader_pos) contiguous.
+        auto const head = *_rb->reader_pos;
+        memset(_rb->data + (head & _rb->mask), 0, _rb->intermediate_reader_pos - head);
+
         __atomic_store_n(_rb->reader_pos, _rb->intermediate_reader_pos,
                          __ATOMIC_RELEASE);
     }
@@ -383,8 +399,8 @@ ConstBuffer RingBuffer::Reader::GetNext()
         auto* hdr = reinterpret_cast<BufferHeader*>(start);
         uint64_t const sz = __atomic_load_n(&hdr->size, __ATOMIC_ACQUIRE);
 
-        // Sample not committed yet, bail out
-        if (BufferHeader::is_reserved(sz)) [[unlikely]]
+        // Slot claimed but header not published or sample not committed yet, bail out
+        if (!BufferHeader::is_published(sz) || BufferHeader::is_reserved(sz)) [[unlikely]]
         {
             return {};
         }
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
@@ -18,8 +19,6 @@ using ConstBuffer = shared::span<const std::byte>;
 
 using namespace std::chrono_literals;
 
-class SpinningMutex;
-
 class RingBuffer
 {
 private:
@@ -46,6 +45,9 @@ public:
         Writer(Writer&&) = default;
         Writer& operator=(Writer&&) = default;
 
+        // Lock-free and async-signal-safe: concurrent writers race on the writer
+        // cursor with a CAS. If the cursor cannot be claimed after MaxReserveAttempts
+        // (heavy contention), an empty buffer is returned and *timeout is set to true.
         Buffer Reserve(bool* timeout = nullptr) const;
         void Commit(Buffer);
         void Discard(Buffer);
@@ -54,7 +56,7 @@ public:
         friend class RingBuffer;
         explicit Writer(RingBufferImpl* rb);
 
-        static constexpr std::chrono::milliseconds ReserveTimeout{100ms};
+        static constexpr std::uint32_t MaxReserveAttempts = 1024;
         RingBufferImpl* _rb;
     };
 
@@ -86,7 +88,6 @@ public:
 #ifdef DD_TEST
     void Reset();
     std::size_t GetSize() const;
-    SpinningMutex* GetLock();
 #endif // DD_TEST
 
 private:
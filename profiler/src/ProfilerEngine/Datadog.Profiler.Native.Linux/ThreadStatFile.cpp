@@ -0,0 +1,144 @@
+// Unless explicitly stated otherwise all files in this repository are licensed under the Apache 2 License.
+// This product includes software developed at Datadog (https://www.datadoghq.com/). Copyright 2025 Datadog, Inc.
+
+#include "ThreadStatFile.h"
+
+#include <algorithm>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
+std::atomic<int> ThreadStatFile::s_openedFiles{0};
+
+ThreadStatFile::ThreadStatFile() :
+    _tid{0},
+    _fd{-1}
+{
+}
+
+ThreadStatFile::~ThreadStatFile()
+{
+    Close();
+}
+
+int ThreadStatFile::GetMaxOpenedFiles()
+{
+    // keep most of the file descriptors available for the application
+    static int maxOpenedFiles = []() {
+        struct rlimit limit;
+        if (getrlimit(RLIMIT_NOFILE, &limit) != 0)
+        {
+            return 0;
+        }
+
+        if (limit.rlim_cur == RLIM_INFINITY)
+        {
+            return MaxOpenedFiles;
+        }
+
+        return static_cast<int>(std::min(limit.rlim_cur / 4, static_cast<rlim_t>(MaxOpenedFiles)));
+    }();
+
+    return maxOpenedFiles;
+}
+
+int ThreadStatFile::GetOpenedFilesCount()
+{
+    return s_openedFiles.load(std::memory_order_relaxed);
+}
+
+bool ThreadStatFile::BuildPath(pid_t tid, char* statPath, int capacity)
+{
+    strncpy(statPath, "/proc/self/task/", 16);
+    int base = 1000000000;
+
+    // Adjust the base
+    while (base > tid)
+    {
+        base /= 10;
+    }
+
+    int offset = 16;
+    // Write each number to the string
+    while (base > 0 && offset < 64)
+    {
+        statPath[offset++] = (tid / base) + '0';
+        tid %= base;
+        base /= 10;
+    }
+
+    // check in case of misusage
+    if (offset >= capacity || offset + 5 >= capacity)
+    {
+        return false;
+    }
+
+    strncpy(statPath + offset, "/stat", 5);
+
+    return true;
+}
+
+ssize_t ThreadStatFile::Read(pid_t tid, char* buffer, std::size_t size)
+{
+    if (_fd != -1)
+    {
+        if (_tid == tid)
+        {
+            // procfs regenerates the content when reading from the beginning of the file
+            auto length = pread(_fd, buffer, size, 0);
+            if (length > 0)
+            {
+                return length;
+            }
+        }
+
+        // the thread is dead or the managed thread is now running on another native thread
+        Close();
+    }
+
+    char statPath[64] = {0};
+    if (!BuildPath(tid, statPath, sizeof(statPath)))
+    {
+        return -1;
+    }
+
+    auto fd = open(statPath, O_RDONLY | O_CLOEXEC);
+    if (fd == -1)
+    {
+        return -1;
+    }
+
+    auto length = pread(fd, buffer, size, 0);
+    if (length <= 0)
+    {
+        close(fd);
+        return -1;
+    }
+
+    if (s_openedFiles.fetch_add(1, std::memory_order_relaxed) < GetMaxOpenedFiles())
+    {
+        _tid = tid;
+        _fd = fd;
+    }
+    else
+    {
+        s_openedFiles.fetch_sub(1, std::memory_order_relaxed);
+        close(fd);
+    }
+
+    return length;
+}
+
+void ThreadStatFile::Close()
+{
+    if (_fd == -1)
+    {
+        return;
+    }
+
+    close(_fd);
+    _fd = -1;
+    _tid = 0;
+    s_openedFiles.fetch_sub(1, std::memory_order_relaxed);
+}
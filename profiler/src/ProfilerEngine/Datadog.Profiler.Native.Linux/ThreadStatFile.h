@@ -0,0 +1,45 @@
+// Unless explicitly stated otherwise all files in this repository are licensed under the Apache 2 License.
+// This product includes software developed at Datadog (https://www.datadoghq.com/). Copyright 2025 Datadog, Inc.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <sys/types.h>
+
+// Keeps the /proc/self/task/<tid>/stat file of a thread opened so that its state and cpu usage
+// can be read with a single pread() instead of open/read/close each time the thread is sampled.
+// The number of files kept opened is capped for the whole process to avoid exhausting the
+// file descriptors of the application: beyond that, the file is opened for each read.
+class ThreadStatFile
+{
+public:
+    ThreadStatFile();
+    ~ThreadStatFile();
+
+    ThreadStatFile(ThreadStatFile const&) = delete;
+    ThreadStatFile& operator=(ThreadStatFile const&) = delete;
+
+    // Reads the stat file of the given thread into buffer and returns the number of bytes read
+    // or -1 if the thread does not exist anymore.
+    // If the thread id changes (or the previous thread died), the file is reopened.
+    ssize_t Read(pid_t tid, char* buffer, std::size_t size);
+
+    static bool BuildPath(pid_t tid, char* statPath, int capacity);
+
+    static int GetOpenedFilesCount();
+
+    // Only the most sampled threads need to keep their file opened: the other ones
+    // pay for an open/close when they are sampled.
+    static constexpr int MaxOpenedFiles = 256;
+
+private:
+    static int GetMaxOpenedFiles();
+    void Close();
+
+private:
+    static std::atomic<int> s_openedFiles;
+
+    pid_t _tid;
+    int _fd;
+};
@@ -0,0 +1,806 @@
+// Unless explicitly stated otherwise all files in this repository are licensed under the Apache 2 License.
+// This product includes software developed at Datadog (https://www.datadoghq.com/). Copyright 2025 Datadog, Inc.
+
+#include "UnwindTable.h"
+
+#include <algorithm>
+#include <cstring>
+#include <elf.h>
+#include <limits>
+#include <unordered_map>
+
+namespace {
+
+// x86_64 DWARF register numbers
+constexpr std::uint64_t DwarfRbp = 6;
+constexpr std::uint64_t DwarfRsp = 7;
+constexpr std::uint64_t DwarfRa = 16;
+
+// pointer encodings (DW_EH_PE_*)
+constexpr std::uint8_t PeOmit = 0xff;
+constexpr std::uint8_t PeAbsPtr = 0x00;
+constexpr std::uint8_t PeUleb128 = 0x01;
+constexpr std::uint8_t PeUdata2 = 0x02;
+constexpr std::uint8_t PeUdata4 = 0x03;
+constexpr std::uint8_t PeUdata8 = 0x04;
+constexpr std::uint8_t PeSleb128 = 0x09;
+constexpr std::uint8_t PeSdata2 = 0x0a;
+constexpr std::uint8_t PeSdata4 = 0x0b;
+constexpr std::uint8_t PeSdata8 = 0x0c;
+constexpr std::uint8_t PePcRel = 0x10;
+constexpr std::uint8_t PeDataRel = 0x30;
+constexpr std::uint8_t PeIndirect = 0x80;
+
+class Reader
+{
+public:
+    Reader(std::uint8_t const* begin, std::uint8_t const* end) :
+        _current{begin},
+        _end{end},
+        _ok{true}
+    {
+    }
+
+    bool Ok() const { return _ok; }
+    bool AtEnd() const { return _current >= _end; }
+    std::uint8_t const* Current() const { return _current; }
+
+    template <typename T>
+    T Read()
+    {
+        if (!_ok || static_cast<std::size_t>(_end - _current) < sizeof(T))
+        {
+            _ok = false;
+            return 0;
+        }
+
+        T value;
+        std::memcpy(&value, _current, sizeof(T));
+        _current += sizeof(T);
+        return value;
+    }
+
+    std::uint64_t ReadUleb128()
+    {
+        std::uint64_t value = 0;
+        unsigned shift = 0;
+        while (true)
+        {
+            auto b = Read<std::uint8_t>();
+            if (!_ok)
+            {
+                return 0;
+            }
+            if (shift < 64)
+            {
+                value |= static_cast<std::uint64_t>(b & 0x7f) << shift;
+            }
+            shift += 7;
+            if ((b & 0x80) == 0)
+            {
+                return value;
+            }
+        }
+    }
+
+    std::int64_t ReadSleb128()
+    {
+        std::int64_t value = 0;
+        unsigned shift = 0;
+        std::uint8_t b = 0;
+        do
+        {
+            b = Read<std::uint8_t>();
+            if (!_ok)
+            {
+                return 0;
+            }
+            if (shift < 64)
+            {
+                value |= static_cast<std::int64_t>(b & 0x7f) << shift;
+            }
+            shift += 7;
+        } while ((b & 0x80) != 0);
+
+        if (shift < 64 && (b & 0x40) != 0)
+        {
+            value |= -(static_cast<std::int64_t>(1) << shift);
+        }
+        return value;
+    }
+
+    // dataBase is only used for DW_EH_PE_datarel (.eh_frame_hdr)
+    std::uintptr_t ReadEncoded(std::uint8_t encoding, std::uintptr_t dataBase = 0)
+    {
+        if (encoding == PeOmit)
+        {
+            return 0;
+        }
+
+        auto fieldAddress = reinterpret_cast<std::uintptr_t>(_current);
+        std::uintptr_t value = 0;
+        switch (encoding & 0x0f)
+        {
+            case PeAbsPtr: value = Read<std::uint64_t>(); break;
+            case PeUleb128: value = ReadUleb128(); break;
+            case PeUdata2: value = Read<std::uint16_t>(); break;
+            case PeUdata4: value = Read<std::uint32_t>(); break;
+            case PeUdata8: value = Read<std::uint64_t>(); break;
+            case PeSleb128: value = static_cast<std::uintptr_t>(ReadSleb128()); break;
+            case PeSdata2: value = static_cast<std::uintptr_t>(static_cast<std::int64_t>(Read<std::int16_t>())); break;
+            case PeSdata4: value = static_cast<std::uintptr_t>(static_cast<std::int64_t>(Read<std::int32_t>())); break;
+            case PeSdata8: value = static_cast<std::uintptr_t>(Read<std::int64_t>()); break;
+            default: _ok = false; return 0;
+        }
+
+        switch (encoding & 0x70)
+        {
+            case 0: break;
+            case PePcRel: value += fieldAddress; break;
+            case PeDataRel: value += dataBase; break;
+            default: _ok = false; return 0;
+        }
+
+        // indirect pointers (personality routines) are only skipped: the value is never dereferenced
+        return value;
+    }
+
+    void Skip(std::uint64_t size)
+    {
+        if (!_ok || static_cast<std::uint64_t>(_end - _current) < size)
+        {
+            _ok = false;
+            return;
+        }
+        _current += size;
+    }
+
+private:
+    std::uint8_t const* _current;
+    std::uint8_t const* _end;
+    bool _ok;
+};
+
+enum class RegisterRule : std::uint8_t
+{
+    Same,
+    Offset,
+    Unsupported,
+};
+
+struct CfiState
+{
+    std::uint64_t cfaRegister = DwarfRsp;
+    std::int64_t cfaOffset = 8;
+    bool cfaIsExpression = false;
+
+    RegisterRule fpRule = RegisterRule::Same;
+    std::int64_t fpOffset = 0;
+
+    RegisterRule raRule = RegisterRule::Unsupported;
+    std::int64_t raOffset = 0;
+};
+
+struct Cie
+{
+    std::uint64_t codeAlignment = 1;
+    std::int64_t dataAlignment = 1;
+    std::uint64_t raRegister = DwarfRa;
+    std::uint8_t fdeEncoding = PeAbsPtr;
+    bool hasAugmentationData = false;
+    bool isSignalFrame = false;
+    std::uint8_t const* instructions = nullptr;
+    std::uint8_t const* instructionsEnd = nullptr;
+};
+
+struct PcRow
+{
+    std::uintptr_t pc;
+    UnwindRow row;
+};
+
+UnwindRow ToRow(CfiState const& state)
+{
+    UnwindRow row{};
+    row.cfaRegister = CfaRegister::Undefined;
+
+    if (state.cfaIsExpression ||
+        state.fpRule == RegisterRule::Unsupported ||
+        state.raRule != RegisterRule::Offset || state.raOffset != -8 ||
+        state.cfaOffset < 0 || state.cfaOffset > std::numeric_limits<std::int32_t>::max())
+    {
+        return row;
+    }
+
+    if (state.fpRule == RegisterRule::Offset)
+    {
+        // an offset of 0 would mean "unchanged" in the table
+        if (state.fpOffset == 0 ||
+            state.fpOffset < std::numeric_limits<std::int16_t>::min() ||
+            state.fpOffset > std::numeric_limits<std::int16_t>::max())
+        {
+            return row;
+        }
+        row.fpOffset = static_cast<std::int16_t>(state.fpOffset);
+    }
+
+    if (state.cfaRegister == DwarfRsp)
+    {
+        row.cfaRegister = CfaRegister::Sp;
+    }
+    else if (state.cfaRegister == DwarfRbp)
+    {
+        row.cfaRegister = CfaRegister::Fp;
+    }
+    else
+    {
+        return row;
+    }
+
+    row.cfaOffset = static_cast<std::int32_t>(state.cfaOffset);
+    return row;
+}
+
+bool SameRule(UnwindRow const& a, UnwindRow const& b)
+{
+    if (a.cfaRegister != b.cfaRegister)
+    {
+        return false;
+    }
+
+    return a.cfaRegister == CfaRegister::Undefined ||
+           (a.cfaOffset == b.cfaOffset && a.fpOffset == b.fpOffset);
+}
+
+bool ParseCie(std::uint8_t const* cieAddress, Cie& cie)
+{
+    Reader reader(cieAddress, cieAddress + 12);
+    std::uint64_t length = reader.Read<std::uint32_t>();
+    if (!reader.Ok() || length == 0 || length == 0xffffffff)
+    {
+        // 64-bit DWARF is not used in .eh_frame
+        return false;
+    }
+
+    auto* end = cieAddress + 4 + length;
+    reader = Reader(cieAddress + 4, end);
+    if (reader.Read<std::uint32_t>() != 0)
+    {
+        // not a CIE
+        return false;
+    }
+
+    auto version = reader.Read<std::uint8_t>();
+    if (version != 1 && version != 3)
+    {
+        return false;
+    }
+
+    auto* augmentation = reinterpret_cast<char const*>(reader.Current());
+    auto augmentationLength = strnlen(augmentation, end - reader.Current());
+    reader.Skip(augmentationLength + 1);
+
+    cie.codeAlignment = reader.ReadUleb128();
+    cie.dataAlignment = reader.ReadSleb128();
+    cie.raRegister = (version == 1) ? reader.Read<std::uint8_t>() : reader.ReadUleb128();
+
+    if (augmentationLength > 0 && augmentation[0] == 'z')
+    {
+        cie.hasAugmentationData = true;
+        auto dataLength = reader.ReadUleb128();
+        auto* dataEnd = reader.Current() + dataLength;
+
+        for (std::size_t i = 1; i < augmentationLength && reader.Ok(); i++)
+        {
+            switch (augmentation[i])
+            {
+                case 'R':
+                    cie.fdeEncoding = reader.Read<std::uint8_t>();
+                    break;
+                case 'L':
+                    reader.Read<std::uint8_t>();
+                    break;
+                case 'P':
+                {
+                    auto encoding = reader.Read<std::uint8_t>();
+                    reader.ReadEncoded(encoding & ~PeIndirect);
+                    break;
+                }
+                case 'S':
+                    cie.isSignalFrame = true;
+                    break;
+                default:
+                    // unknown augmentation: the data length tells us where the instructions start
+                    i = augmentationLength;
+                    break;
+            }
+        }
+
+        if (!reader.Ok() || dataEnd > end)
+        {
+            return false;
+        }
+        cie.instructions = dataEnd;
+    }
+    else if (augmentationLength != 0)
+    {
+        // without 'z', the layout of the augmentation data is unknown
+        return false;
+    }
+    else
+    {
+        cie.instructions = reader.Current();
+    }
+
+    cie.instructionsEnd = end;
+    return reader.Ok() && cie.raRegister == DwarfRa;
+}
+
+class CfiInterpreter
+{
+public:
+    CfiInterpreter(Cie const& cie, std::vector<PcRow>& rows) :
+        _cie{cie},
+        _rows{rows},
+        _stackDepth{0}
+    {
+    }
+
+    bool RunCie(CfiState& state)
+    {
+        std::uintptr_t location = 0;
+        return Run(_cie.instructions, _cie.instructionsEnd, state, state, location, std::numeric_limits<std::uintptr_t>::max(), false);
+    }
+
+    bool RunFde(std::uint8_t const* begin, std::uint8_t const* end, CfiState const& initialState,
+                std::uintptr_t pcBegin, std::uintptr_t pcEnd)
+    {
+        CfiState state = initialState;
+        std::uintptr_t location = pcBegin;
+        if (!Run(begin, end, state, initialState, location, pcEnd, true))
+        {
+            return false;
+        }
+
+        if (location < pcEnd)
+        {
+            _rows.push_back({location, ToRow(state)});
+        }
+        return true;
+    }
+
+private:
+    static constexpr std::size_t MaxStateStackDepth = 8;
+
+    void AdvanceTo(std::uintptr_t newLocation, CfiState const& state, std::uintptr_t& location, bool emitRows)
+    {
+        if (emitRows && newLocation > location)
+        {
+            _rows.push_back({location, ToRow(state)});
+        }
+        location = newLocation;
+    }
+
+    static void SetOffsetRule(CfiState& state, std::uint64_t reg, std::int64_t offset)
+    {
+        if (reg == DwarfRbp)
+        {
+            state.fpRule = RegisterRule::Offset;
+            state.fpOffset = offset;
+        }
+        else if (reg == DwarfRa)
+        {
+            state.raRule = RegisterRule::Offset;
+            state.raOffset = offset;
+        }
+    }
+
+    static void SetRule(CfiState& state, std::uint64_t reg, RegisterRule rule)
+    {
+        if (reg == DwarfRbp)
+        {
+            state.fpRule = rule;
+        }
+        else if (reg == DwarfRa)
+        {
+            state.raRule = rule;
+        }
+    }
+
+    static void RestoreRule(CfiState& state, CfiState const& initialState, std::uint64_t reg)
+    {
+        if (reg == DwarfRbp)
+        {
+            state.fpRule = initialState.fpRule;
+            state.fpOffset = initialState.fpOffset;
+        }
+        else if (reg == DwarfRa)
+        {
+            state.raRule = initialState.raRule;
+            state.raOffset = initialState.raOffset;
+        }
+    }
+
+    bool Run(std::uint8_t const* begin, std::uint8_t const* end,
+             CfiState& state, CfiState const& initialState,
+             std::uintptr_t& location, std::uintptr_t pcEnd, bool emitRows)
+    {
+        Reader reader(begin, end);
+        auto codeAlignment = _cie.codeAlignment;
+        auto dataAlignment = _cie.dataAlignment;
+
+        while (!reader.AtEnd() && reader.Ok() && location < pcEnd)
+        {
+            auto opcode = reader.Read<std::uint8_t>();
+            auto operand = opcode & 0x3f;
+
+            switch (opcode & 0xc0)
+            {
+                case 0x40: // DW_CFA_advance_loc
+                    AdvanceTo(location + operand * codeAlignment, state, location, emitRows);
+                    continue;
+                case 0x80: // DW_CFA_offset
+                    SetOffsetRule(state, operand, static_cast<std::int64_t>(reader.ReadUleb128()) * dataAlignment);
+                    continue;
+                case 0xc0: // DW_CFA_restore
+                    RestoreRule(state, initialState, operand);
+                    continue;
+                default:
+                    break;
+            }
+
+            switch (opcode)
+            {
+                case 0x00: // DW_CFA_nop
+                    break;
+                case 0x01: // DW_CFA_set_loc
+                    AdvanceTo(reader.ReadEncoded(_cie.fdeEncoding), state, location, emitRows);
+                    break;
+                case 0x02: // DW_CFA_advance_loc1
+                    AdvanceTo(location + reader.Read<std::uint8_t>() * codeAlignment, state, location, emitRows);
+                    break;
+                case 0x03: // DW_CFA_advance_loc2
+                    AdvanceTo(location + reader.Read<std::uint16_t>() * codeAlignment, state, location, emitRows);
+                    break;
+                case 0x04: // DW_CFA_advance_loc4
+                    AdvanceTo(location + reader.Read<std::uint32_t>() * codeAlignment, state, location, emitRows);
+                    break;
+                case 0x05: // DW_CFA_offset_extended
+                {
+                    auto reg = reader.ReadUleb128();
+                    SetOffsetRule(state, reg, static_cast<std::int64_t>(reader.ReadUleb128()) * dataAlignment);
+                    break;
+                }
+                case 0x06: // DW_CFA_restore_extended
+                    RestoreRule(state, initialState, reader.ReadUleb128());
+                    break;
+                case 0x07: // DW_CFA_undefined
+                    SetRule(state, reader.ReadUleb128(), RegisterRule::Unsupported);
+                    break;
+                case 0x08: // DW_CFA_same_value
+                    SetRule(state, reader.ReadUleb128(), RegisterRule::Same);
+                    break;
+                case 0x09: // DW_CFA_register
+                    SetRule(state, reader.ReadUleb128(), RegisterRule::Unsupported);
+                    reader.ReadUleb128();
+                    break;
+                case 0x0a: // DW_CFA_remember_state
+                    if (_stackDepth == MaxStateStackDepth)
+                    {
+                        return false;
+                    }
+                    _stateStack[_stackDepth++] = state;
+                    break;
+                case 0x0b: // DW_CFA_restore_state
+                    if (_stackDepth == 0)
+                    {
+                        return false;
+                    }
+                    state = _stateStack[--_stackDepth];
+                    break;
+                case 0x0c: // DW_CFA_def_cfa
+                    state.cfaRegister = reader.ReadUleb128();
+                    state.cfaOffset = static_cast<std::int64_t>(reader.ReadUleb128());
+                    state.cfaIsExpression = false;
+                    break;
+                case 0x0d: // DW_CFA_def_cfa_register
+                    state.cfaRegister = reader.ReadUleb128();
+                    state.cfaIsExpression = false;
+                    break;
+                case 0x0e: // DW_CFA_def_cfa_offset
+                    state.cfaOffset = static_cast<std::int64_t>(reader.ReadUleb128());
+                    break;
+                case 0x0f: // DW_CFA_def_cfa_expression
+                    state.cfaIsExpression = true;
+                    reader.Skip(reader.ReadUleb128());
+                    break;
+                case 0x10: // DW_CFA_expression
+                case 0x16: // DW_CFA_val_expression
+                    SetRule(state, reader.ReadUleb128(), RegisterRule::Unsupported);
+                    reader.Skip(reader.ReadUleb128());
+                    break;
+                case 0x11: // DW_CFA_offset_extended_sf
+                {
+                    auto reg = reader.ReadUleb128();
+                    SetOffsetRule(state, reg, reader.ReadSleb128() * dataAlignment);
+                    break;
+                }
+                case 0x12: // DW_CFA_def_cfa_sf
+                    state.cfaRegister = reader.ReadUleb128();
+                    state.cfaOffset = reader.ReadSleb128() * dataAlignment;
+                    state.cfaIsExpression = false;
+                    break;
+                case 0x13: // DW_CFA_def_cfa_offset_sf
+                    state.cfaOffset = reader.ReadSleb128() * dataAlignment;
+                    break;
+                case 0x14: // DW_CFA_val_offset
+                case 0x15: // DW_CFA_val_offset_sf
+                    SetRule(state, reader.ReadUleb128(), RegisterRule::Unsupported);
+                    reader.ReadUleb128();
+                    break;
+                case 0x2e: // DW_CFA_GNU_args_size
+                    reader.ReadUleb128();
+                    break;
+                case 0x2f: // DW_CFA_GNU_negative_offset_extended
+                {
+                    auto reg = reader.ReadUleb128();
+                    SetOffsetRule(state, reg, -static_cast<std::int64_t>(reader.ReadUleb128()) * dataAlignment);
+                    break;
+                }
+                default:
+                    return false;
+            }
+        }
+
+        return reader.Ok();
+    }
+
+    Cie const& _cie;
+    std::vector<PcRow>& _rows;
+    CfiState _stateStack[MaxStateStackDepth];
+    std::size_t _stackDepth;
+};
+
+bool ParseFde(std::uint8_t const* fdeAddress, std::unordered_map<std::uint8_t const*, Cie>& cies, std::vector<PcRow>& rows)
+{
+    Reader reader(fdeAddress, fdeAddress + 8);
+    std::uint64_t length = reader.Read<std::uint32_t>();
+    if (!reader.Ok() || length == 0 || length == 0xffffffff)
+    {
+        return false;
+    }
+
+    auto* end = fdeAddress + 4 + length;
+    reader = Reader(fdeAddress + 4, end);
+    auto* ciePointerField = reader.Current();
+    auto ciePointer = reader.Read<std::uint32_t>();
+    if (!reader.Ok() || ciePointer == 0)
+    {
+        return false;
+    }
+
+    auto* cieAddress = ciePointerField - ciePointer;
+    auto it = cies.find(cieAddress);
+    if (it == cies.end())
+    {
+        Cie cie;
+        if (!ParseCie(cieAddress, cie))
+        {
+            cie.instructions = nullptr;
+        }
+        it = cies.emplace(cieAddress, cie).first;
+    }
+    auto const& cie = it->second;
+
+    auto pcBegin = reader.ReadEncoded(cie.fdeEncoding);
+    auto pcRange = reader.ReadEncoded(cie.fdeEncoding & 0x0f);
+    if (!reader.Ok() || pcRange == 0)
+    {
+        return false;
+    }
+    auto pcEnd = pcBegin + pcRange;
+
+    if (cie.instructions == nullptr || cie.isSignalFrame)
+    {
+        // unsupported CIE or signal trampoline: let libunwind handle it
+        rows.push_back({pcBegin, UnwindRow{}});
+        rows.push_back({pcEnd, UnwindRow{}});
+        return true;
+    }
+
+    if (cie.hasAugmentationData)
+    {
+        reader.Skip(reader.ReadUleb128());
+    }
+    if (!reader.Ok())
+    {
+        return false;
+    }
+
+    auto firstRow = rows.size();
+    CfiInterpreter interpreter(cie, rows);
+    CfiState initialState;
+    if (!interpreter.RunCie(initialState) ||
+        !interpreter.RunFde(reader.Current(), end, initialState, pcBegin, pcEnd))
+    {
+        rows.resize(firstRow);
+        rows.push_back({pcBegin, UnwindRow{}});
+    }
+
+    // ends the last row of the function
+    rows.push_back({pcEnd, UnwindRow{}});
+    return true;
+}
+
+bool GetCodeRange(dl_phdr_info const* info, std::uintptr_t& segLow, std::uintptr_t& segHigh, ElfW(Phdr) const*& ehFrameHdr)
+{
+    segLow = 0;
+    segHigh = 0;
+    ehFrameHdr = nullptr;
+    for (int i = 0; i < info->dlpi_phnum; ++i)
+    {
+        auto const& phdr = info->dlpi_phdr[i];
+        if (phdr.p_type == PT_LOAD && (phdr.p_flags & PF_X))
+        {
+            std::uintptr_t low = info->dlpi_addr + phdr.p_vaddr;
+            std::uintptr_t high = low + phdr.p_memsz;
+            if (segHigh == 0 || low < segLow)
+                segLow = low;
+            if (segHigh == 0 || high > segHigh)
+                segHigh = high;
+        }
+        else if (phdr.p_type == PT_GNU_EH_FRAME)
+        {
+            ehFrameHdr = &phdr;
+        }
+    }
+
+    return ehFrameHdr != nullptr && segLow != segHigh;
+}
+
+} // anonymous namespace
+
+UnwindTableRegion const* UnwindTableBuilder::FindSameLibrary(UnwindTableRegion const* regions, std::size_t count, dl_phdr_info const* info)
+{
+    std::uintptr_t segLow;
+    std::uintptr_t segHigh;
+    ElfW(Phdr) const* ehFrameHdr;
+    if (!GetCodeRange(info, segLow, segHigh, ehFrameHdr))
+    {
+        return nullptr;
+    }
+
+    // the code ranges of the loaded libraries do not overlap: at most one region starts at segLow
+    auto* end = regions + count;
+    auto* region = std::lower_bound(regions, end, segLow,
+                                    [](UnwindTableRegion const& r, std::uintptr_t addr) { return r.addrLow < addr; });
+    if (region == end || region->addrLow != segLow || region->addrHigh != segHigh ||
+        region->ehFrameHdr != info->dlpi_addr + ehFrameHdr->p_vaddr)
+    {
+        return nullptr;
+    }
+
+    return region;
+}
+
+bool UnwindTableBuilder::Build(dl_phdr_info const* info, RowsVector& outRows, UnwindTableRegion& region)
+{
+    std::uintptr_t segLow;
+    std::uintptr_t segHigh;
+    ElfW(Phdr) const* ehFrameHdr;
+    if (!GetCodeRange(info, segLow, segHigh, ehFrameHdr))
+    {
+        return false;
+    }
+
+    // .eh_frame_hdr is mapped in memory: no need to read the file
+    auto* hdr = reinterpret_cast<std::uint8_t const*>(info->dlpi_addr + ehFrameHdr->p_vaddr);
+    auto hdrAddress = reinterpret_cast<std::uintptr_t>(hdr);
+    Reader reader(hdr, hdr + ehFrameHdr->p_memsz);
+
+    auto version = reader.Read<std::uint8_t>();
+    auto ehFramePtrEncoding = reader.Read<std::uint8_t>();
+    auto fdeCountEncoding = reader.Read<std::uint8_t>();
+    auto tableEncoding = reader.Read<std::uint8_t>();
+    reader.ReadEncoded(ehFramePtrEncoding, hdrAddress);
+    auto fdeCount = reader.ReadEncoded(fdeCountEncoding, hdrAddress);
+
+    // the binary search table is always made of (initial location, FDE address) datarel/sdata4 pairs
+    if (!reader.Ok() || version != 1 || tableEncoding != (PeDataRel | PeSdata4) || fdeCount == 0)
+    {
+        return false;
+    }
+
+    std::vector<PcRow> rows;
+    std::unordered_map<std::uint8_t const*, Cie> cies;
+    for (std::uintptr_t i = 0; i < fdeCount; i++)
+    {
+        reader.Read<std::int32_t>();
+        auto fdeAddress = hdrAddress + reader.Read<std::int32_t>();
+        if (!reader.Ok())
+        {
+            break;
+        }
+
+        ParseFde(reinterpret_cast<std::uint8_t const*>(fdeAddress), cies, rows);
+    }
+
+    if (rows.empty())
+    {
+        return false;
+    }
+
+    // for rows starting at the same pc, keep the defined one (the end of a function
+    // is often the start of the next one)
+    std::stable_sort(rows.begin(), rows.end(), [](PcRow const& a, PcRow const& b) {
+        if (a.pc != b.pc)
+        {
+            return a.pc < b.pc;
+        }
+        return a.row.cfaRegister != CfaRegister::Undefined && b.row.cfaRegister == CfaRegister::Undefined;
+    });
+
+    region.addrLow = segLow;
+    region.addrHigh = segHigh;
+    region.ehFrameHdr = hdrAddress;
+    region.rowOffset = static_cast<std::uint32_t>(outRows.size());
+
+    std::uint32_t inserted = 0;
+    std::uintptr_t previousPc = 0;
+    UnwindRow const* lastRow = nullptr;
+    for (auto& [pc, row] : rows)
+    {
+        if (pc < segLow || pc >= segHigh || pc - segLow > std::numeric_limits<std::uint32_t>::max())
+        {
+            continue;
+        }
+
+        if (pc == previousPc)
+        {
+            continue;
+        }
+        previousPc = pc;
+
+        // a row only ends with the next one: rows with the same rule can be merged
+        if (lastRow != nullptr && SameRule(*lastRow, row))
+        {
+            continue;
+        }
+
+        row.offset = static_cast<std::uint32_t>(pc - segLow);
+        outRows.push_back(row);
+        lastRow = &row;
+        inserted++;
+    }
+    region.rowCount = inserted;
+
+    return inserted != 0;
+}
+
+UnwindRow const* UnwindTableBuilder::Find(UnwindTableRegion const& region, UnwindRow const* rows, std::uintptr_t ip)
+{
+    if (ip < region.addrLow || ip >= region.addrHigh)
+    {
+        return nullptr;
+    }
+
+    auto offset = ip - region.addrLow;
+    auto* begin = rows + region.rowOffset;
+    auto* end = begin + region.rowCount;
+    auto* it = std::upper_bound(begin, end, offset, [](std::uintptr_t value, UnwindRow const& row) {
+        return value < row.offset;
+    });
+
+    if (it == begin)
+    {
+        return nullptr;
+    }
+
+    --it;
+    if (it->cfaRegister == CfaRegister::Undefined)
+    {
+        return nullptr;
+    }
+
+    return it;
+}
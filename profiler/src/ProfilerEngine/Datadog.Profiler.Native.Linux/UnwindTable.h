@@ -0,0 +1,64 @@
+// Unless explicitly stated otherwise all files in this repository are licensed under the Apache 2 License.
+// This product includes software developed at Datadog (https://www.datadoghq.com/). Copyright 2025 Datadog, Inc.
+
+#pragma once
+
+#include "shared/src/native-src/dd_memory_resource.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <link.h>
+#include <vector>
+
+// Precompiled form of the DWARF call frame information (.eh_frame) of a loaded library.
+// Instead of locating and interpreting the CFI of each frame while sampling (what libunwind does),
+// the CFI instructions are evaluated once when the library is loaded and turned into a sorted
+// pc -> rule table that can be binary searched from the signal handler.
+//
+// Only the rules needed to walk x86_64 frames are kept:
+//  - CFA = rsp/rbp + offset
+//  - the caller rbp is either unchanged or saved at CFA + offset
+//  - the return address is at CFA - 8
+// Any other rule (DWARF expressions, signal frames, ...) is stored as Undefined and the frame is
+// left to libunwind.
+
+enum class CfaRegister : std::uint8_t
+{
+    Undefined = 0,
+    Sp = 1,
+    Fp = 2,
+};
+
+struct UnwindRow
+{
+    std::uint32_t offset;    // start of the pc range covered by this row, relative to UnwindTableRegion::addrLow
+    CfaRegister cfaRegister;
+    std::int16_t fpOffset;   // caller frame pointer saved at CFA + fpOffset (0 means unchanged)
+    std::int32_t cfaOffset;
+};
+
+struct UnwindTableRegion
+{
+    std::uintptr_t addrLow;
+    std::uintptr_t addrHigh;
+    std::uintptr_t ehFrameHdr; // identifies the library when the cache is rebuilt
+    std::uint32_t rowOffset;
+    std::uint32_t rowCount;
+};
+
+class UnwindTableBuilder
+{
+public:
+    using RowsVector = std::vector<UnwindRow, shared::pmr::polymorphic_allocator<UnwindRow>>;
+
+    // Parse the .eh_frame of the given library (located with its PT_GNU_EH_FRAME segment) and
+    // append its rows. Returns false if the library has no usable unwind information.
+    static bool Build(dl_phdr_info const* info, RowsVector& rows, UnwindTableRegion& region);
+
+    // Returns the region built from the same library (its rows can be reused) or nullptr.
+    // The regions must be sorted by addrLow.
+    static UnwindTableRegion const* FindSameLibrary(UnwindTableRegion const* regions, std::size_t count, dl_phdr_info const* info);
+
+    // Returns the row that applies to ip in the given region or nullptr if ip is not covered
+    static UnwindRow const* Find(UnwindTableRegion const& region, UnwindRow const* rows, std::uintptr_t ip);
+};
@@ -10,6 +10,7 @@
 #include "IConfiguration.h"
 #include "IThreadInfo.h"
 #include "Log.h"
+#include "ManagedThreadInfo.h"
 #include "OpSysTools.h"
 #include "ScopeFinalizer.h"
 #include "ScopedHandle.h"
@@ -32,7 +33,7 @@ class CallstackProvider;
 
 namespace OsSpecificApi {
 
-void InitializeUnwinder(ManagedCodeCache*) {}
+void InitializeUnwinder(ManagedCodeCache*, IConfiguration const*) {}
 
 // if a system message was not found for the last error code the message will contain GetLastError between ()
 std::pair<DWORD, std::string> GetLastErrorMessage()
@@ -200,7 +201,7 @@ bool IsRunning(ULONG threadState)
 }
 
 //    isRunning,        cpu time          , failed 
-std::tuple<bool, std::chrono::milliseconds, bool> IsRunning(IThreadInfo* pThreadInfo)
+std::tuple<bool, std::chrono::milliseconds, bool> IsRunning(ManagedThreadInfo* pThreadInfo)
 {
     if (NtQueryInformationThread == nullptr)
     {
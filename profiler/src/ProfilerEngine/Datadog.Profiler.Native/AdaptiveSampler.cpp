@@ -15,14 +15,19 @@ void AdaptiveSampler::Counts::AddTest()
 
 bool AdaptiveSampler::Counts::AddSample(int64_t limit)
 {
-    int64_t previousValue;
+    auto previousValue = _sampleCount.load();
     int64_t newValue;
 
     do
     {
-        previousValue = _sampleCount.load();
-        newValue = std::min<int64_t>(previousValue + 1, limit);
-    } while (!_sampleCount.compare_exchange_strong(previousValue, newValue));
+        // the budget is exhausted: no need to write (and invalidate the cache line of the other threads)
+        if (previousValue >= limit)
+        {
+            return false;
+        }
+
+        newValue = previousValue + 1;
+    } while (!_sampleCount.compare_exchange_weak(previousValue, newValue));
 
     return newValue < limit;
 }
@@ -81,11 +86,6 @@ AdaptiveSampler::AdaptiveSampler(
 
     _countsRef = &_countsSlots[0];
 
-    // Initialize RNG
-    std::random_device rd;
-    _rng = std::mt19937(rd());
-    _distribution = std::uniform_real_distribution<>(0.0, 1.0);
-
     if (windowDuration != 0ms)
     {
         _timer.Start();
@@ -122,8 +122,12 @@ bool AdaptiveSampler::Drop()
 
 double AdaptiveSampler::NextDouble()
 {
-    std::lock_guard lock(_rngMutex);
-    return _distribution(_rng);
+    // Each thread has its own generator so that the sampling decisions are not serialized
+    // (the generators are shared by all the samplers used on a given thread)
+    thread_local std::mt19937 rng{std::random_device{}()};
+    thread_local std::uniform_real_distribution<> distribution{0.0, 1.0};
+
+    return distribution(rng);
 }
 
 double AdaptiveSampler::ComputeIntervalAlpha(int32_t lookback)
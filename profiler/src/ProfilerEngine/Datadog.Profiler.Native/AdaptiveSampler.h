@@ -20,8 +20,9 @@ class AdaptiveSampler
         int64_t TestCount();
 
     private:
-        std::atomic<int64_t> _testCount;
-        std::atomic<int64_t> _sampleCount;
+        // on different cache lines: all threads are testing but only a few are sampled
+        alignas(64) std::atomic<int64_t> _testCount;
+        alignas(64) std::atomic<int64_t> _sampleCount;
     };
 
     class State
@@ -70,12 +71,8 @@ private:
     std::mutex _callbackMutex;
     std::function<void()> _rollWindowCallback;
 
-    std::mutex _rngMutex;
-    std::uniform_real_distribution<> _distribution;
-    std::mt19937 _rng;
-
     static double ComputeIntervalAlpha(int32_t lookback);
 
-    double NextDouble();
+    static double NextDouble();
     int64_t CalculateBudgetEma(int64_t sampledCount);
 };
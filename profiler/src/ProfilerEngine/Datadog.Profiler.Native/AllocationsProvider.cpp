@@ -84,7 +84,8 @@ AllocationsProvider::AllocationsProvider(
     _sampleLimit(pConfiguration->AllocationSampleLimit()),
     _pConfiguration(pConfiguration),
     _callstackProvider{std::move(pool)},
-    _metricsRegistry{metricsRegistry}
+    _metricsRegistry{metricsRegistry},
+    _stackFramesCollectors{pCorProfilerInfo, pConfiguration, &_callstackProvider, metricsRegistry}
 {
     _allocationsCountMetric = metricsRegistry.GetOrRegister<CounterMetric>("dotnet_allocations");
     _allocationsSizeMetric = metricsRegistry.GetOrRegister<MeanMaxMetric>("dotnet_allocations_size");
@@ -122,8 +123,7 @@ void AllocationsProvider::OnAllocation(uint32_t allocationKind,
         return;
     }
 
-    const auto pStackFramesCollector = OsSpecificApi::CreateNewStackFramesCollectorInstance(
-        _pCorProfilerInfo, _pConfiguration, &_callstackProvider, _metricsRegistry);
+    const auto pStackFramesCollector = _stackFramesCollectors.Acquire();
     pStackFramesCollector->PrepareForNextCollection();
 
     uint32_t hrCollectStack = E_FAIL;
@@ -202,8 +202,7 @@ void AllocationsProvider::OnAllocationSampled(
         return;
     }
 
-    const auto pStackFramesCollector = OsSpecificApi::CreateNewStackFramesCollectorInstance(
-        _pCorProfilerInfo, _pConfiguration, &_callstackProvider, _metricsRegistry);
+    const auto pStackFramesCollector = _stackFramesCollectors.Acquire();
     pStackFramesCollector->PrepareForNextCollection();
 
     uint32_t hrCollectStack = E_FAIL;
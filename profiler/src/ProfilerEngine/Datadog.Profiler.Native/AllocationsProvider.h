@@ -12,6 +12,7 @@
 #include "MeanMaxMetric.h"
 #include "MetricsRegistry.h"
 #include "RawAllocationSample.h"
+#include "StackFramesCollectorPool.h"
 #include "SumMetric.h"
 
 #include "shared/src/native-src/dd_memory_resource.hpp"
@@ -111,4 +112,5 @@ private:
     std::shared_ptr<SumMetric> _totalAllocationsSizeMetric;
     CallstackProvider _callstackProvider;
     MetricsRegistry& _metricsRegistry;
+    StackFramesCollectorPool _stackFramesCollectors;
 };
@@ -95,6 +95,22 @@ void ClrEventsParser::ParseEvent(
     }
 }
 
+bool ClrEventsParser::CanBeParsedAsynchronously(INT64 keywords, DWORD id)
+{
+    // The GCBulkXXX listeners walk the objects of the heap: the GC must still be suspended
+    if (IsGcHeapDumpEvent(keywords))
+    {
+        return false;
+    }
+
+    // AllocationTick is received with the GC keyword
+    return (KEYWORD_GC == (keywords & KEYWORD_GC)) && (id != ::EVENT_ALLOCATION_TICK);
+}
+
+bool ClrEventsParser::IsGcHeapDumpEvent(INT64 keywords)
+{
+    return KEYWORD_GCHEAPDUMP == (keywords & KEYWORD_GCHEAPDUMP);
+}
 
 // TL;DR Deactivate the alignment check in the Undefined Behavior Sanitizers for the ParseGcEvent function
 // because events fields are not aligned in the bitstream sent by the CLR.
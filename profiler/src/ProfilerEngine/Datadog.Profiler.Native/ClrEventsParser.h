@@ -320,6 +320,12 @@ public:
 
     void Register(IGarbageCollectionsListener* pGarbageCollectionsListener);
 
+    // GC events only rely on their timestamp and can be parsed on another thread, unlike the
+    // allocation, contention and wait events that need the callstack of the current thread and
+    // the GC heap dump events that need the GC to be suspended
+    static bool CanBeParsedAsynchronously(INT64 keywords, DWORD id);
+    static bool IsGcHeapDumpEvent(INT64 keywords);
+
 private:
     void ParseGcEvent(std::chrono::nanoseconds timestamp, DWORD id, DWORD version, ULONG cbEventData, LPCBYTE pEventData);
     void ParseContentionEvent(DWORD id, DWORD version, ULONG cbEventData, LPCBYTE pEventData);
@@ -74,7 +74,12 @@ public:
 
     void Add(TRawSample&& sample) override
     {
-        _collectedSamples.Add(std::move(sample));
+        // in case of burst (exceptions storm, allocations spike...), wake up the samples collector
+        // instead of accumulating samples until the next collection
+        if (_collectedSamples.Add(std::move(sample)) == SamplesAvailableThreshold)
+        {
+            NotifySamplesAvailable();
+        }
     }
 
     std::unique_ptr<SamplesEnumerator> GetSamples() override
@@ -133,6 +133,7 @@ Configuration::Configuration()
     _heapSnapshotInterval = ExtractHeapSnapshotInterval();
     _heapSnapshotCheckInterval = ExtractHeapSnapshotCheckInterval();
     _heapSnapshotMemoryPressureThreshold = GetEnvironmentValue(EnvironmentVariables::HeapSnapshotMemoryPressureThreshold, 50);
+    _heapSnapshotTraversalWorkers = GetEnvironmentValue(EnvironmentVariables::HeapSnapshotTraversalWorkers, 0);
     _testHeapSnapshotInterval = ExtractTestHeapSnapshotInterval();
     _librariesInfoCacheStartTimeout = ExtractLibrariesInfoCacheStartTimeout();
     _heapHandleLimit = ExtractHeapHandleLimit();
@@ -146,6 +147,11 @@ Configuration::Configuration()
     _isMemoryFootprintEnabled = GetEnvironmentValue(EnvironmentVariables::MemoryFootprintEnabled, false);
 
     _referenceTreeFormat = ExtractReferenceTreeFormat();
+    _isPerCpuRingBuffersEnabled = GetEnvironmentValue(EnvironmentVariables::PerCpuRingBuffersEnabled, false);
+    _isBatchedWalltimeSamplingEnabled = GetEnvironmentValue(EnvironmentVariables::BatchedWalltimeSamplingEnabled, false);
+    _isFrameInterningEnabled = GetEnvironmentValue(EnvironmentVariables::FrameInterningEnabled, false);
+    _isUnwindTablesEnabled = GetEnvironmentValue(EnvironmentVariables::UnwindTablesEnabled, false);
+    _isAsyncEventsParsingEnabled = GetEnvironmentValue(EnvironmentVariables::AsyncEventsParsingEnabled, false);
 }
 
 fs::path Configuration::ExtractLogDirectory()
@@ -351,6 +357,31 @@ uint32_t Configuration::GetReferenceTreeFormat() const
     return _referenceTreeFormat;
 }
 
+bool Configuration::IsPerCpuRingBuffersEnabled() const
+{
+    return _isPerCpuRingBuffersEnabled;
+}
+
+bool Configuration::IsBatchedWalltimeSamplingEnabled() const
+{
+    return _isBatchedWalltimeSamplingEnabled;
+}
+
+bool Configuration::IsFrameInterningEnabled() const
+{
+    return _isFrameInterningEnabled;
+}
+
+bool Configuration::IsUnwindTablesEnabled() const
+{
+    return _isUnwindTablesEnabled;
+}
+
+bool Configuration::IsAsyncEventsParsingEnabled() const
+{
+    return _isAsyncEventsParsingEnabled;
+}
+
 bool Configuration::IsAllocationRecorderEnabled() const
 {
     return _isAllocationRecorderEnabled;
@@ -929,6 +960,11 @@ uint32_t Configuration::GetHeapSnapshotMemoryPressureThreshold() const
     return _heapSnapshotMemoryPressureThreshold;
 }
 
+uint32_t Configuration::GetHeapSnapshotTraversalWorkers() const
+{
+    return _heapSnapshotTraversalWorkers;
+}
+
 std::chrono::seconds Configuration::ExtractTestHeapSnapshotInterval() const
 {
     auto r = shared::GetEnvironmentValue(EnvironmentVariables::TestHeapSnapshotInterval);
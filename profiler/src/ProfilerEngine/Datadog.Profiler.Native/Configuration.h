@@ -89,12 +89,18 @@ public:
     std::chrono::minutes GetHeapSnapshotInterval() const override;
     std::chrono::milliseconds GetHeapSnapshotCheckInterval() const override;
     uint32_t GetHeapSnapshotMemoryPressureThreshold() const override;
+    uint32_t GetHeapSnapshotTraversalWorkers() const override;
     std::chrono::seconds GetTestHeapSnapshotInterval() const override;
     std::chrono::milliseconds GetLibrariesInfoCacheStartTimeout() const override;
     uint32_t GetHeapHandleLimit() const override;
     bool UseManagedCodeCache() const override;
     bool IsMemoryFootprintEnabled() const override;
     uint32_t GetReferenceTreeFormat() const override;
+    bool IsPerCpuRingBuffersEnabled() const override;
+    bool IsBatchedWalltimeSamplingEnabled() const override;
+    bool IsFrameInterningEnabled() const override;
+    bool IsUnwindTablesEnabled() const override;
+    bool IsAsyncEventsParsingEnabled() const override;
 
 private:
     static tags ExtractUserTags();
@@ -213,9 +219,15 @@ private:
     std::chrono::minutes _heapSnapshotInterval;
     std::chrono::milliseconds _heapSnapshotCheckInterval;
     uint32_t _heapSnapshotMemoryPressureThreshold; // in % of used memory
+    uint32_t _heapSnapshotTraversalWorkers; // 0 means that the roots are traversed by the thread receiving them
     std::chrono::seconds _testHeapSnapshotInterval;
     std::chrono::milliseconds _librariesInfoCacheStartTimeout;
     bool _useManagedCodeCache;
     bool _isMemoryFootprintEnabled;
     uint32_t _referenceTreeFormat;
+    bool _isPerCpuRingBuffersEnabled;
+    bool _isBatchedWalltimeSamplingEnabled;
+    bool _isFrameInterningEnabled;
+    bool _isUnwindTablesEnabled;
+    bool _isAsyncEventsParsingEnabled;
 };
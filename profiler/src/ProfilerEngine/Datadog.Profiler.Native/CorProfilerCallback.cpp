@@ -32,6 +32,7 @@
 #include "EnabledProfilers.h"
 #include "EnvironmentVariables.h"
 #include "EventPipeEventsManager.h"
+#include "EventPipeEventsQueue.h"
 #include "ExceptionsProvider.h"
 #include "FrameStore.h"
 #include "GCThreadsCpuProvider.h"
@@ -57,11 +58,7 @@
 #include "ThreadsCpuManager.h"
 #include "WallTimeProvider.h"
 #ifdef LINUX
-#ifdef ARM64
-#include "HybridUnwinder.h"
-#else
-#include "Backtrace2Unwinder.h"
-#endif
+#include "IUnwinder.h"
 #include "UnwindingRecorderFactory.h"
 #include "ProfilerSignalManager.h"
 #include "SystemCallsShield.h"
@@ -183,7 +180,9 @@ void CorProfilerCallback::InitializeServices()
     // Like the SystemCallsShield, this service must be started before any profiler.
     // For now we asked for a memory resource that will have maximum 100 blocks of 1KiB per block.
     // (before it uses the default memory resource a.k.a new/delete for allocation)
-    RegisterService<LibrariesInfoCache>(_pConfiguration.get(), _memoryResourceManager.GetSynchronizedPool(100, 1024), _metricsRegistry);
+    // When the unwind tables are precompiled, the upstream resource is mmap-based: the tables are larger than the pool blocks.
+    auto isUnwindTablesEnabled = _pConfiguration->IsUnwindTablesEnabled();
+    RegisterService<LibrariesInfoCache>(_pConfiguration.get(), _memoryResourceManager.GetSynchronizedPool(100, 1024, isUnwindTablesEnabled), _metricsRegistry);
 #endif
 
     _pFrameStore = std::make_unique<FrameStore>(
@@ -252,7 +251,8 @@ void CorProfilerCallback::InitializeServices()
     _rawSampleTransformer = std::make_unique<RawSampleTransformer>(
         _pFrameStore.get(),
         _pAppDomainStore.get(),
-        _pRuntimeIdStore);
+        _pRuntimeIdStore,
+        _metricsRegistry);
 
     if (_pConfiguration->IsThreadLifetimeEnabled())
     {
@@ -291,10 +291,28 @@ void CorProfilerCallback::InitializeServices()
             // Reason:
             // We know that profiling interval is at most every 1 ms.
             // So, cpuAllocated will have to be over 37 trillion to have a value that cannot be represented by a std::size_t
-            std::size_t rbSize = std::ceil(nbSamplesCollectorTick * cpuAllocated * RawSampleCollectorBase<RawCpuSample>::SampleSize);
-            Log::Info("RingBuffer size estimate (bytes): ", rbSize);
-            _pCpuProfilerRb = std::make_unique<RingBuffer>(rbSize, CpuSampleProvider::SampleSize);
-            _pCpuSampleProvider = RegisterService<CpuSampleProvider>(valueTypeProvider, _rawSampleTransformer.get(), _pCpuProfilerRb.get(), _metricsRegistry);
+            if (_pConfiguration->IsPerCpuRingBuffersEnabled())
+            {
+                // One ring buffer per CPU: a CPU cannot generate more than one sample per profiling interval
+                auto nbCpus = std::max(OsSpecificApi::GetProcessorCount(), 1);
+                std::size_t rbSize = nbSamplesCollectorTick * RawSampleCollectorBase<RawCpuSample>::SampleSize;
+                Log::Info("Per-CPU RingBuffer size estimate (bytes): ", rbSize, " x ", nbCpus, " CPUs");
+
+                std::vector<RingBuffer*> ringBuffers;
+                for (auto i = 0; i < nbCpus; i++)
+                {
+                    _cpuProfilerRbs.push_back(std::make_unique<RingBuffer>(rbSize, CpuSampleProvider::SampleSize));
+                    ringBuffers.push_back(_cpuProfilerRbs.back().get());
+                }
+                _pCpuSampleProvider = RegisterService<CpuSampleProvider>(valueTypeProvider, _rawSampleTransformer.get(), std::move(ringBuffers), _metricsRegistry);
+            }
+            else
+            {
+                std::size_t rbSize = std::ceil(nbSamplesCollectorTick * cpuAllocated * RawSampleCollectorBase<RawCpuSample>::SampleSize);
+                Log::Info("RingBuffer size estimate (bytes): ", rbSize);
+                _cpuProfilerRbs.push_back(std::make_unique<RingBuffer>(rbSize, CpuSampleProvider::SampleSize));
+                _pCpuSampleProvider = RegisterService<CpuSampleProvider>(valueTypeProvider, _rawSampleTransformer.get(), _cpuProfilerRbs.back().get(), _metricsRegistry);
+            }
         }
 #else // WINDOWS
         _pCpuTimeProvider = RegisterService<CpuTimeProvider>(
@@ -471,6 +489,13 @@ void CorProfilerCallback::InitializeServices()
 
         IGCDumpListener* pGCDumpListener = _pHeapSnapshotManager;
 
+        // registered after the providers so that it is stopped before them
+        EventPipeEventsQueue* pEventsQueue = nullptr;
+        if (_pConfiguration->IsAsyncEventsParsingEnabled())
+        {
+            pEventsQueue = RegisterService<EventPipeEventsQueue>(EventPipeEventsQueue::DefaultCapacity, _metricsRegistry);
+        }
+
         // TODO: add new CLR events-based providers to the event parser
         _pEventPipeEventsManager = std::make_unique<EventPipeEventsManager>(
             _pCorProfilerInfoEvents,
@@ -479,7 +504,8 @@ void CorProfilerCallback::InitializeServices()
             _pStopTheWorldProvider,
             _pNetworkProvider,
             _pConfiguration.get(),
-            pGCDumpListener
+            pGCDumpListener,
+            pEventsQueue
         );
 
         if (_pGarbageCollectionProvider != nullptr)
@@ -643,11 +669,7 @@ void CorProfilerCallback::InitializeServices()
 #ifdef LINUX
     if (_pConfiguration->IsCpuProfilingEnabled() && _pConfiguration->GetCpuProfilerType() == CpuProfilerType::TimerCreate)
     {
-#ifdef ARM64
-        _pUnwinder = std::make_unique<HybridUnwinder>(_managedCodeCache.get());
-#else
-        _pUnwinder = std::make_unique<Backtrace2Unwinder>();
-#endif
+        _pUnwinder = OsSpecificApi::CreateUnwinder(_managedCodeCache.get(), _pConfiguration.get());
         // Other alternative in case of crash-at-shutdown, do not register it as a service
         // we will have to start it by hand (already stopped by hand)
         _pCpuProfiler = std::make_unique<TimerCreateCpuProfiler>(
@@ -710,7 +732,8 @@ void CorProfilerCallback::InitializeServices()
         _pConfiguration.get(),
         _pThreadsCpuManager,
         _pExporter.get(),
-        _metricsSender.get());
+        _metricsSender.get(),
+        _metricsRegistry);
 
     if (_pConfiguration->IsThreadLifetimeEnabled())
     {
@@ -1581,7 +1604,7 @@ HRESULT STDMETHODCALLTYPE CorProfilerCallback::Initialize(IUnknown* corProfilerI
         }
     }
 
-    OsSpecificApi::InitializeUnwinder(_managedCodeCache.get());
+    OsSpecificApi::InitializeUnwinder(_managedCodeCache.get(), _pConfiguration.get());
 
     // create services without starting them
     InitializeServices();
@@ -1604,6 +1627,12 @@ HRESULT STDMETHODCALLTYPE CorProfilerCallback::Initialize(IUnknown* corProfilerI
         eventMask |= COR_PRF_MONITOR_MODULE_LOADS | COR_PRF_MONITOR_CLASS_LOADS;
     }
 
+    if (_pConfiguration->IsDebugInfoEnabled())
+    {
+        // the pdb files are loaded in the background when the modules are loaded
+        eventMask |= COR_PRF_MONITOR_MODULE_LOADS;
+    }
+
     if (_pConfiguration->IsHeapSnapshotEnabled())
     {
         // CoreLibModuleProvider is fed from ModuleLoadFinished and InlineVTCache needs it
@@ -2090,6 +2119,11 @@ HRESULT STDMETHODCALLTYPE CorProfilerCallback::ModuleLoadFinished(ModuleID modul
         _managedCodeCache->AddModule(moduleId);
     }
 
+    if (_pDebugInfoStore != nullptr)
+    {
+        _pDebugInfoStore->OnModuleLoaded(moduleId);
+    }
+
     return S_OK;
 }
 
@@ -2371,15 +2405,11 @@ HRESULT STDMETHODCALLTYPE CorProfilerCallback::ThreadAssignedToOSThread(ThreadID
     // occurs in our profiler signal handler, we end up deadlocking the application.
     // To prevent that, we call the unwinder here for the current thread, to force libunwind
     // initializing the TLS'd data structures for the current thread.
-#ifdef ARM64
-    HybridUnwinder warmup(_managedCodeCache.get());
-#else
-    Backtrace2Unwinder warmup;
-#endif
+    auto warmup = OsSpecificApi::CreateUnwinder(_managedCodeCache.get(), _pConfiguration.get());
     uintptr_t tab[1];
     Callstack callstack(shared::span<std::uintptr_t>(tab, 1));
     auto [stackBase, stackEnd] = threadInfo->GetStackBounds();
-    warmup.Unwind(nullptr, callstack, stackBase, stackEnd);
+    warmup->Unwind(nullptr, callstack, stackBase, stackEnd);
 
     // check if SIGUSR1 signal is blocked for current thread
     sigset_t currentMask;
@@ -274,7 +274,7 @@ private :
     std::unique_ptr<TimerCreateCpuProfiler> _pCpuProfiler = nullptr;
     std::unique_ptr<IUnwinder> _pUnwinder = nullptr;
     CpuSampleProvider* _pCpuSampleProvider = nullptr;
-    std::unique_ptr<RingBuffer> _pCpuProfilerRb = nullptr;
+    std::vector<std::unique_ptr<RingBuffer>> _cpuProfilerRbs;
     std::unique_ptr<UnwindingRecorderFactory> _pUnwindingRecorderFactory = nullptr;
 #endif // LINUX
 
@@ -6,6 +6,7 @@
 #include "COMHelpers.h"
 #include "IConfiguration.h"
 #include "Log.h"
+#include "OpSysTools.h"
 
 #include "shared/src/native-src/string.h"
 
@@ -28,8 +29,46 @@ const std::uint32_t DebugInfoStore::NoStartLine = 0;
 DebugInfoStore::DebugInfoStore(ICorProfilerInfo4* profilerInfo, IConfiguration* _configuration) noexcept :
     _profilerInfo{profilerInfo},
     _isEnabled{_configuration->IsDebugInfoEnabled()},
-    _cachedItemsSize(0)
+    _cachedItemsSize(0),
+    _stopRequested{false}
 {
+    if (_isEnabled)
+    {
+        _loaderThread = std::thread([this]
+            {
+                OpSysTools::SetNativeThreadName(WStr("DD_pdb_loader"));
+                LoadModulesWork();
+            });
+    }
+}
+
+DebugInfoStore::~DebugInfoStore()
+{
+    {
+        std::lock_guard<std::mutex> lock(_modulesMutex);
+        _stopRequested = true;
+    }
+    _pendingModulesCondition.notify_one();
+
+    if (_loaderThread.joinable())
+    {
+        _loaderThread.join();
+    }
+}
+
+void DebugInfoStore::OnModuleLoaded(ModuleID moduleId)
+{
+    if (!_isEnabled)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(_modulesMutex);
+
+    if (_modulesInfo.find(moduleId) == _modulesInfo.cend())
+    {
+        StartLoading(moduleId);
+    }
 }
 
 SymbolDebugInfo DebugInfoStore::Get(ModuleID moduleId, mdMethodDef methodDef)
@@ -44,11 +83,16 @@ SymbolDebugInfo DebugInfoStore::Get(ModuleID moduleId, mdMethodDef methodDef)
     auto it = _modulesInfo.find(moduleId);
     if (it == _modulesInfo.cend())
     {
-        ParseModuleDebugInfo(moduleId);
-        it = _modulesInfo.find(moduleId);
+        // the module was loaded before the profiler started to listen to the module loads
+        StartLoading(moduleId);
+        return {NoFileFound, NoStartLine, true};
     }
 
-    ModuleDebugInfo& info = (it == _modulesInfo.cend()) ? _modulesInfo[moduleId] : it->second;
+    ModuleDebugInfo& info = it->second;
+    if (info.LoadingState == SymbolLoadingState::Pending)
+    {
+        return {NoFileFound, NoStartLine, true};
+    }
 
     // we should support 2 situations:
     //  - portable .pdb was found and we can use methodDef as RID
@@ -62,14 +106,62 @@ SymbolDebugInfo DebugInfoStore::Get(ModuleID moduleId, mdMethodDef methodDef)
     return {NoFileFound, NoStartLine};
 }
 
-void DebugInfoStore::ParseModuleDebugInfo(ModuleID moduleId)
+void DebugInfoStore::StartLoading(ModuleID moduleId)
 {
-    // This lookup creates an invalid ModuleInfo
+    // the path is retrieved now: the module could be unloaded by the time the background thread handles it
     auto& moduleInfo = _modulesInfo[moduleId];
+    moduleInfo.LoadingState = SymbolLoadingState::Pending;
+    moduleInfo.ModulePath = GetModuleFilePath(moduleId).string();
+
+    _pendingModules.push_back(moduleId);
+    _pendingModulesCondition.notify_one();
+}
+
+void DebugInfoStore::LoadModulesWork()
+{
+    std::unique_lock<std::mutex> lock(_modulesMutex);
+
+    while (true)
+    {
+        _pendingModulesCondition.wait(lock, [this] { return _stopRequested || !_pendingModules.empty(); });
+        if (_stopRequested)
+        {
+            return;
+        }
+
+        auto moduleId = _pendingModules.front();
+        _pendingModules.pop_front();
+
+        ModuleDebugInfo moduleInfo;
+        moduleInfo.ModulePath = _modulesInfo[moduleId].ModulePath;
+
+        // parsing a large pdb file could take hundreds of milliseconds: the lookups must not wait for it
+        lock.unlock();
+        ParseModuleDebugInfo(moduleId, moduleInfo);
+
+        // Incrementally track item size
+        size_t itemSize = moduleInfo.ModulePath.capacity();
+        itemSize += moduleInfo.Files.capacity() * sizeof(std::string);
+        for (const auto& file : moduleInfo.Files)
+        {
+            itemSize += file.capacity();
+        }
+        itemSize += moduleInfo.RidToDebugInfo.capacity() * sizeof(SymbolDebugInfo);
+        _cachedItemsSize.fetch_add(itemSize, std::memory_order_relaxed);
+
+        lock.lock();
+
+        // the strings of Files are not moved: the views stored in RidToDebugInfo stay valid
+        _modulesInfo[moduleId] = std::move(moduleInfo);
+    }
+}
+
+void DebugInfoStore::ParseModuleDebugInfo(ModuleID moduleId, ModuleDebugInfo& moduleInfo)
+{
+    // An invalid ModuleInfo is stored if the pdb file is not found
     moduleInfo.LoadingState = SymbolLoadingState::Unknown;
 
-    fs::path filePath = GetModuleFilePath(moduleId);
-    moduleInfo.ModulePath = filePath.string();
+    fs::path filePath = moduleInfo.ModulePath;
 
     if (!filePath.has_extension() || (filePath.extension() != ".dll" && filePath.extension() != ".exe"))
     {
@@ -91,16 +183,6 @@ void DebugInfoStore::ParseModuleDebugInfo(ModuleID moduleId)
     Log::Debug("Parsing ", pdbFile, " pdb file. (for module ", filePath,")");
 
     ParseModuleDebugInfo(moduleId, pdbFile.string(), filePath.string(), moduleInfo);
-
-    // Incrementally track item size
-    size_t itemSize = moduleInfo.ModulePath.capacity();
-    itemSize += moduleInfo.Files.capacity() * sizeof(std::string);
-    for (const auto& file : moduleInfo.Files)
-    {
-        itemSize += file.capacity();
-    }
-    itemSize += moduleInfo.RidToDebugInfo.capacity() * sizeof(SymbolDebugInfo);
-    _cachedItemsSize.fetch_add(itemSize, std::memory_order_relaxed);
 }
 
 void DebugInfoStore::ParseModuleDebugInfo(ModuleID moduleId, const std::string& pdbFilename, const std::string& moduleFilename, ModuleDebugInfo& moduleInfo)
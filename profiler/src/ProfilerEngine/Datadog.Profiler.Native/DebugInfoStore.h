@@ -8,8 +8,11 @@
 
 #include "shared/src/native-src/dd_filesystem.hpp"
 
+#include <condition_variable>
+#include <deque>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -20,7 +23,8 @@ enum class SymbolLoadingState
     Unknown,
     Failed,
     Portable,
-    Windows
+    Windows,
+    Pending // waiting to be loaded by the background thread
 };
 
 struct ModuleDebugInfo
@@ -70,8 +74,10 @@ public:
 
 public:
     DebugInfoStore(ICorProfilerInfo4* profilerInfo, IConfiguration* configuration) noexcept;
+    ~DebugInfoStore() override;
 
     SymbolDebugInfo Get(ModuleID moduleId, mdMethodDef methodDef) override;
+    void OnModuleLoaded(ModuleID moduleId) override;
 
     // Memory measurement (IMemoryFootprintProvider)
     size_t GetMemorySize() const override;
@@ -84,7 +90,10 @@ private:
     const size_t DEFAULT_RESERVE_SIZE = 1024;
 
 private:
-    void ParseModuleDebugInfo(ModuleID moduleID);
+    // MUST be called under _modulesMutex
+    void StartLoading(ModuleID moduleId);
+    void LoadModulesWork();
+    void ParseModuleDebugInfo(ModuleID moduleID, ModuleDebugInfo& moduleInfo);
     fs::path GetModuleFilePath(ModuleID moduleId) const;
 
     template <typename TInfo>
@@ -157,4 +166,11 @@ private:
 
 // mutable to allow locking in const methods (e.g., GetMemorySize, LogMemoryBreakdown)
     mutable std::mutex _modulesMutex;
+
+    // the pdb files are parsed by a background thread (lookups are not blocked meanwhile)
+    // (protected by _modulesMutex)
+    std::deque<ModuleID> _pendingModules;
+    std::condition_variable _pendingModulesCondition;
+    bool _stopRequested;
+    std::thread _loaderThread;
 };
\ No newline at end of file
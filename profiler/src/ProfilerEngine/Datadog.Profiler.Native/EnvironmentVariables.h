@@ -79,6 +79,7 @@ public:
     inline static const shared::WSTRING HeapSnapshotMemoryPressureThreshold = WStr("DD_INTERNAL_PROFILING_HEAPSNAPSHOT_MEMORY_PRESSURE_THRESHOLD");
     inline static const shared::WSTRING HeapSnapshotSkipTraversal       = WStr("DD_INTERNAL_PROFILING_HEAPSNAPSHOT_SKIP_TRAVERSAL");
     inline static const shared::WSTRING HeapSnapshotReferenceTreeFormat = WStr("DD_INTERNAL_PROFILING_HEAPSNAPSHOT_REFERENCE_TREE_FORMAT");
+    inline static const shared::WSTRING HeapSnapshotTraversalWorkers = WStr("DD_INTERNAL_PROFILING_HEAPSNAPSHOT_TRAVERSAL_WORKERS");
     inline static const shared::WSTRING MemoryFootprintEnabled          = WStr("DD_INTERNAL_PROFILING_MEMORY_FOOTPRINT_ENABLED");
     inline static const shared::WSTRING EnableProfilerArchitectureArm64 = WStr("DD_INTERNAL_PROFILING_ENABLED_ARM64");
 
@@ -91,4 +92,9 @@ public:
     inline static const shared::WSTRING InternalCIVisibilitySpanId  = WStr("DD_INTERNAL_CIVISIBILITY_SPANID");
     inline static const shared::WSTRING WaitHandleProfilingEnabled  = WStr("DD_INTERNAL_PROFILING_WAITHANDLE_ENABLED");
     inline static const shared::WSTRING UseManagedCodeCache         = WStr("DD_INTERNAL_PROFILING_USE_MANAGED_CODE_CACHE");
+    inline static const shared::WSTRING PerCpuRingBuffersEnabled    = WStr("DD_INTERNAL_PROFILING_PER_CPU_RING_BUFFERS_ENABLED");
+    inline static const shared::WSTRING BatchedWalltimeSamplingEnabled = WStr("DD_INTERNAL_PROFILING_BATCHED_WALLTIME_SAMPLING_ENABLED");
+    inline static const shared::WSTRING FrameInterningEnabled       = WStr("DD_INTERNAL_PROFILING_FRAME_INTERNING_ENABLED");
+    inline static const shared::WSTRING UnwindTablesEnabled         = WStr("DD_INTERNAL_PROFILING_UNWIND_TABLES_ENABLED");
+    inline static const shared::WSTRING AsyncEventsParsingEnabled   = WStr("DD_INTERNAL_PROFILING_ASYNC_EVENTS_PARSING_ENABLED");
 };
@@ -3,6 +3,7 @@
 
 #include "EventPipeEventsManager.h"
 
+#include "EventPipeEventsQueue.h"
 #include "EventsParserHelper.h"
 #include "IAllocationsListener.h"
 #include "IConfiguration.h"
@@ -20,9 +21,11 @@ EventPipeEventsManager::EventPipeEventsManager(
     IGCSuspensionsListener* pGCSuspensionsListener,
     INetworkListener* pNetworkListener,
     IConfiguration* pConfiguration,
-    IGCDumpListener* pGCDumpListener)
+    IGCDumpListener* pGCDumpListener,
+    EventPipeEventsQueue* pEventsQueue)
     :
-    _pCorProfilerInfo{pCorProfilerInfo}
+    _pCorProfilerInfo{pCorProfilerInfo},
+    _pEventsQueue{pEventsQueue}
 {
     _clrParser = std::make_unique<ClrEventsParser>(
         pAllocationListener,
@@ -31,6 +34,14 @@ EventPipeEventsManager::EventPipeEventsManager(
         pConfiguration,
         pGCDumpListener);
     _bclParser = std::make_unique<BclEventsParser>(pNetworkListener);
+
+    if (_pEventsQueue != nullptr)
+    {
+        _pEventsQueue->SetEventHandler(
+            [this](std::chrono::nanoseconds timestamp, DWORD version, INT64 keywords, DWORD id, ULONG cbEventData, LPCBYTE eventData) {
+                _clrParser->ParseEvent(timestamp, version, keywords, id, cbEventData, eventData);
+            });
+    }
 }
 
 void EventPipeEventsManager::Register(IGarbageCollectionsListener* pGarbageCollectionsListener)
@@ -120,8 +131,26 @@ void EventPipeEventsManager::ParseEvent(
     // Also, during the test, a last (keyword=0 id=1 V1) event is sent from "Microsoft-DotNETCore-EventPipe"
     if (dotnetProvider == DotnetEventsProvider::Clr)
     {
-        // The events are expected to be processed synchronously so the current time is used as timestamp
-        _clrParser->ParseEvent(OpSysTools::GetHighPrecisionTimestamp(), version, keywords, id, cbEventData, eventData);
+        // The current time is used as timestamp: this is also true for the events parsed by the queue thread
+        auto timestamp = OpSysTools::GetHighPrecisionTimestamp();
+        if (_pEventsQueue != nullptr)
+        {
+            if (ClrEventsParser::CanBeParsedAsynchronously(keywords, id) &&
+                _pEventsQueue->Enqueue(timestamp, version, keywords, id, cbEventData, eventData))
+            {
+                return;
+            }
+
+            // The heap dump events are parsed on this thread while the GC is suspended, but only
+            // after the queued GC events (i.e. the start of the induced GC) have been parsed
+            if (ClrEventsParser::IsGcHeapDumpEvent(keywords) &&
+                _pEventsQueue->ParseAfterQueuedEvents(timestamp, version, keywords, id, cbEventData, eventData))
+            {
+                return;
+            }
+        }
+
+        _clrParser->ParseEvent(timestamp, version, keywords, id, cbEventData, eventData);
     }
     else
     if (dotnetProvider != DotnetEventsProvider::Unknown)
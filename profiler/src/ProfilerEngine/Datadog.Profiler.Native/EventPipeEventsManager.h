@@ -20,6 +20,7 @@ class IGCSuspensionsListener;
 class IGarbageCollectionsListener;
 class INetworkListener;
 class IConfiguration;
+class EventPipeEventsQueue;
 
 class EventPipeEventsManager
 {
@@ -30,7 +31,8 @@ public:
                            IGCSuspensionsListener* pGCSuspensionsListener,
                            INetworkListener* pNetworkListener,
                            IConfiguration* pConfiguration,
-                           IGCDumpListener* pGCDumpListener);
+                           IGCDumpListener* pGCDumpListener,
+                           EventPipeEventsQueue* pEventsQueue = nullptr);
     void Register(IGarbageCollectionsListener* pGarbageCollectionsListener);
     void ParseEvent(EVENTPIPE_PROVIDER provider,
                     DWORD eventId,
@@ -60,4 +62,7 @@ private:
     ICorProfilerInfo12* _pCorProfilerInfo;
     std::unique_ptr<ClrEventsParser> _clrParser;
     std::unique_ptr<BclEventsParser> _bclParser;
+
+    // when set, the GC events are parsed by the queue thread
+    EventPipeEventsQueue* _pEventsQueue;
 };
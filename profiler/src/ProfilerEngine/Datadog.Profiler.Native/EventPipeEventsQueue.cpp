@@ -0,0 +1,300 @@
+// Unless explicitly stated otherwise all files in this repository are licensed under the Apache 2 License.
+// This product includes software developed at Datadog (https://www.datadoghq.com/). Copyright 2025 Datadog, Inc.
+
+#include "EventPipeEventsQueue.h"
+
+#include "Log.h"
+#include "OpSysTools.h"
+
+#include <cassert>
+#include <cstring>
+
+using namespace std::chrono_literals;
+
+EventPipeEventsQueue::EventPipeEventsQueue(std::size_t capacity, MetricsRegistry& metricsRegistry) :
+    _capacity{capacity},
+    _buffer{std::make_unique<std::uint8_t[]>(capacity)},
+    _readPosition{0},
+    _writePosition{0},
+    _isStarted{false},
+    _isConsumerWaiting{false},
+    _isConsumerRunning{false},
+    _eventsAvailableEvent{false}
+{
+    assert((capacity & (capacity - 1)) == 0);
+
+    _queuedEventsMetric = metricsRegistry.GetOrRegister<CounterMetric>("dotnet_eventpipe_queued_events");
+    _queueFullMetric = metricsRegistry.GetOrRegister<CounterMetric>("dotnet_eventpipe_queue_full");
+}
+
+const char* EventPipeEventsQueue::GetName()
+{
+    return _serviceName;
+}
+
+void EventPipeEventsQueue::SetEventHandler(EventHandler handler)
+{
+    _handler = std::move(handler);
+}
+
+bool EventPipeEventsQueue::StartImpl()
+{
+    Log::Info("Starting the EventPipe events queue (", _capacity, " bytes)");
+
+    _isConsumerRunning = true;
+    _workerThread = std::thread([this]
+        {
+            OpSysTools::SetNativeThreadName(WorkerThreadName);
+            Work();
+        });
+    _isStarted = true;
+
+    return true;
+}
+
+bool EventPipeEventsQueue::StopImpl()
+{
+    // the worker processes the last queued events before ending: the producers must not
+    // queue events after that (the next ones will be parsed synchronously)
+    std::lock_guard<std::mutex> lock(_producersLock);
+    _isStarted = false;
+
+    _workerThreadPromise.set_value();
+    _eventsAvailableEvent.Set();
+    _workerThread.join();
+
+    return true;
+}
+
+bool EventPipeEventsQueue::Enqueue(
+    std::chrono::nanoseconds timestamp,
+    DWORD version,
+    INT64 keywords,
+    DWORD id,
+    ULONG cbEventData,
+    LPCBYTE eventData)
+{
+    if (!_isStarted)
+    {
+        return false;
+    }
+
+    auto size = (sizeof(EventHeader) + cbEventData + Alignment - 1) & ~(Alignment - 1);
+
+    std::lock_guard<std::mutex> lock(_producersLock);
+
+    // the queue could have been stopped while waiting for the lock
+    if (!_isStarted)
+    {
+        return false;
+    }
+
+    if (size > _capacity / 2)
+    {
+        // the events already in the queue must be processed before this one
+        return ParseWhenConsumerIdle(timestamp, version, keywords, id, cbEventData, eventData);
+    }
+
+    auto writePosition = _writePosition.load(std::memory_order_relaxed);
+    auto offset = writePosition & (_capacity - 1);
+
+    // an event is never split: if it does not fit before the end of the buffer, it is stored at the beginning
+    auto contiguousSize = _capacity - offset;
+    auto paddingSize = (contiguousSize < size) ? contiguousSize : 0;
+
+    if (!WaitForFreeSpace(paddingSize + size))
+    {
+        return false;
+    }
+
+    if (paddingSize != 0)
+    {
+        // when the padding is smaller than a header, the consumer knows that it has to skip it
+        if (paddingSize >= sizeof(EventHeader))
+        {
+            std::memcpy(_buffer.get() + offset, &WrapMarker, sizeof(WrapMarker));
+        }
+
+        writePosition += paddingSize;
+        offset = 0;
+    }
+
+    EventHeader header{static_cast<std::uint32_t>(size), id, version, cbEventData, keywords, timestamp.count()};
+    std::memcpy(_buffer.get() + offset, &header, sizeof(EventHeader));
+    if (cbEventData != 0)
+    {
+        std::memcpy(_buffer.get() + offset + sizeof(EventHeader), eventData, cbEventData);
+    }
+
+    // seq_cst to be seen by the consumer before it starts waiting (see Work)
+    _writePosition.store(writePosition + size);
+    _queuedEventsMetric->Incr();
+
+    WakeUpConsumer();
+
+    return true;
+}
+
+bool EventPipeEventsQueue::ParseAfterQueuedEvents(
+    std::chrono::nanoseconds timestamp,
+    DWORD version,
+    INT64 keywords,
+    DWORD id,
+    ULONG cbEventData,
+    LPCBYTE eventData)
+{
+    if (!_isStarted)
+    {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(_producersLock);
+
+    if (!_isStarted)
+    {
+        return false;
+    }
+
+    return ParseWhenConsumerIdle(timestamp, version, keywords, id, cbEventData, eventData);
+}
+
+bool EventPipeEventsQueue::ParseWhenConsumerIdle(
+    std::chrono::nanoseconds timestamp,
+    DWORD version,
+    INT64 keywords,
+    DWORD id,
+    ULONG cbEventData,
+    LPCBYTE eventData)
+{
+    if (!WaitForConsumerIdle())
+    {
+        return false;
+    }
+
+    // no event can be queued while the lock is held: the consumer stays idle
+    _handler(timestamp, version, keywords, id, cbEventData, eventData);
+    return true;
+}
+
+void EventPipeEventsQueue::WakeUpConsumer()
+{
+    if (_isConsumerWaiting.exchange(false))
+    {
+        _eventsAvailableEvent.Set();
+    }
+}
+
+bool EventPipeEventsQueue::WaitForFreeSpace(std::size_t size)
+{
+    auto writePosition = _writePosition.load(std::memory_order_relaxed);
+    if (_capacity - (writePosition - _readPosition.load(std::memory_order_acquire)) >= size)
+    {
+        return true;
+    }
+
+    // the consumer is late: the runtime thread has to wait because dropping GC events
+    // would break the state kept by the parser
+    _queueFullMetric->Incr();
+    do
+    {
+        // the space will never be freed
+        if (!_isConsumerRunning)
+        {
+            return false;
+        }
+
+        WakeUpConsumer();
+        std::this_thread::yield();
+    } while (_capacity - (writePosition - _readPosition.load(std::memory_order_acquire)) < size);
+
+    return true;
+}
+
+bool EventPipeEventsQueue::WaitForConsumerIdle()
+{
+    // the read position is updated after the handler of the event has returned: when it
+    // reaches the write position, the consumer is not parsing an event anymore
+    auto writePosition = _writePosition.load(std::memory_order_relaxed);
+    while (_readPosition.load(std::memory_order_acquire) != writePosition)
+    {
+        if (!_isConsumerRunning)
+        {
+            return false;
+        }
+
+        WakeUpConsumer();
+        std::this_thread::yield();
+    }
+
+    return true;
+}
+
+void EventPipeEventsQueue::Work()
+{
+    const auto future = _workerThreadPromise.get_future();
+
+    while (future.wait_for(0s) == std::future_status::timeout)
+    {
+        ProcessEvents();
+
+        _isConsumerWaiting = true;
+
+        // an event could have been queued before the producer saw the flag
+        if (_readPosition.load(std::memory_order_relaxed) != _writePosition.load())
+        {
+            _isConsumerWaiting = false;
+            continue;
+        }
+
+        _eventsAvailableEvent.Wait(100ms);
+        _isConsumerWaiting = false;
+    }
+
+    // process the events queued before the queue was stopped
+    ProcessEvents();
+
+    _isConsumerRunning = false;
+}
+
+void EventPipeEventsQueue::ProcessEvents()
+{
+    auto readPosition = _readPosition.load(std::memory_order_relaxed);
+    auto writePosition = _writePosition.load(std::memory_order_acquire);
+
+    while (readPosition != writePosition)
+    {
+        auto offset = readPosition & (_capacity - 1);
+        auto contiguousSize = _capacity - offset;
+
+        EventHeader header;
+        if (contiguousSize >= sizeof(EventHeader))
+        {
+            std::memcpy(&header, _buffer.get() + offset, sizeof(EventHeader));
+        }
+
+        if ((contiguousSize < sizeof(EventHeader)) || (header.Size == WrapMarker))
+        {
+            readPosition += contiguousSize;
+        }
+        else
+        {
+            _handler(
+                std::chrono::nanoseconds(header.Timestamp),
+                header.Version,
+                header.Keywords,
+                header.Id,
+                header.PayloadSize,
+                _buffer.get() + offset + sizeof(EventHeader));
+
+            readPosition += header.Size;
+        }
+
+        // give back the space to the producers as soon as possible
+        _readPosition.store(readPosition, std::memory_order_release);
+
+        if (readPosition == writePosition)
+        {
+            writePosition = _writePosition.load(std::memory_order_acquire);
+        }
+    }
+}
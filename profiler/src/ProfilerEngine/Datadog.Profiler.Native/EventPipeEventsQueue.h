@@ -0,0 +1,134 @@
+// Unless explicitly stated otherwise all files in this repository are licensed under the Apache 2 License.
+// This product includes software developed at Datadog (https://www.datadoghq.com/). Copyright 2025 Datadog, Inc.
+
+#pragma once
+
+#include "cor.h"
+#include "corprof.h"
+
+#include "AutoResetEvent.h"
+#include "CounterMetric.h"
+#include "MetricsRegistry.h"
+#include "ServiceBase.h"
+
+#include "shared/src/native-src/string.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+// Copies the payload of the CLR events received from EventPipe into a preallocated ring buffer
+// so that they are parsed and dispatched to the listeners by a profiler thread instead of
+// the runtime thread emitting them.
+// Only the events that do not depend on the current thread (i.e. GC events) should be queued:
+// the order in which they are enqueued is the order in which they are processed.
+//
+// The ring has a single consumer (the profiler thread). The runtime could emit GC events from
+// different threads (server GC) so the producers are serialized by a lock that is uncontended
+// most of the time.
+class EventPipeEventsQueue : public ServiceBase
+{
+public:
+    using EventHandler = std::function<void(
+        std::chrono::nanoseconds timestamp,
+        DWORD version,
+        INT64 keywords,
+        DWORD id,
+        ULONG cbEventData,
+        LPCBYTE eventData)>;
+
+    inline static constexpr std::size_t DefaultCapacity = 1024 * 1024;
+
+public:
+    // capacity must be a power of 2
+    EventPipeEventsQueue(std::size_t capacity, MetricsRegistry& metricsRegistry);
+
+    // Inherited via IService
+    const char* GetName() override;
+
+    // Must be called before the service is started
+    void SetEventHandler(EventHandler handler);
+
+    // Returns false if the event must be parsed synchronously (i.e. the queue is not started).
+    // An event larger than the queue is parsed by the current thread once the events already
+    // queued have been processed, to keep the order
+    bool Enqueue(
+        std::chrono::nanoseconds timestamp,
+        DWORD version,
+        INT64 keywords,
+        DWORD id,
+        ULONG cbEventData,
+        LPCBYTE eventData);
+
+    // Parses the event on the current thread once the events already queued have been processed.
+    // Returns false if the queue is not started: the caller has to parse the event
+    bool ParseAfterQueuedEvents(
+        std::chrono::nanoseconds timestamp,
+        DWORD version,
+        INT64 keywords,
+        DWORD id,
+        ULONG cbEventData,
+        LPCBYTE eventData);
+
+private:
+    // Stored before the payload of each event, aligned on 8 bytes
+    struct EventHeader
+    {
+        std::uint32_t Size; // header + payload + alignment padding (or WrapMarker)
+        DWORD Id;
+        DWORD Version;
+        ULONG PayloadSize;
+        INT64 Keywords;
+        std::int64_t Timestamp;
+    };
+
+    // The rest of the buffer is unused: the next event is at the beginning of the buffer
+    inline static constexpr std::uint32_t WrapMarker = 0xFFFFFFFF;
+    inline static constexpr std::size_t Alignment = 8;
+
+    bool StartImpl() override;
+    bool StopImpl() override;
+
+    void Work();
+    void ProcessEvents();
+
+    // Must be called under _producersLock: return false if the consumer has stopped
+    bool WaitForFreeSpace(std::size_t size);
+    bool WaitForConsumerIdle();
+    bool ParseWhenConsumerIdle(
+        std::chrono::nanoseconds timestamp,
+        DWORD version,
+        INT64 keywords,
+        DWORD id,
+        ULONG cbEventData,
+        LPCBYTE eventData);
+    void WakeUpConsumer();
+
+private:
+    const char* _serviceName = "EventPipeEventsQueue";
+    const WCHAR* WorkerThreadName = WStr("DD_events");
+
+    std::size_t _capacity;
+    std::unique_ptr<std::uint8_t[]> _buffer;
+
+    // positions are never wrapped: the offset in the buffer is position & (_capacity - 1)
+    std::atomic<std::uint64_t> _readPosition;
+    std::atomic<std::uint64_t> _writePosition;
+
+    std::mutex _producersLock;
+    std::atomic<bool> _isStarted;
+    std::atomic<bool> _isConsumerWaiting;
+    std::atomic<bool> _isConsumerRunning;
+    AutoResetEvent _eventsAvailableEvent;
+    EventHandler _handler;
+    std::thread _workerThread;
+    std::promise<void> _workerThreadPromise;
+
+    std::shared_ptr<CounterMetric> _queuedEventsMetric;
+    std::shared_ptr<CounterMetric> _queueFullMetric;
+};
@@ -46,7 +46,8 @@ ExceptionsProvider::ExceptionsProvider(
     _sampler(pConfiguration->ExceptionSampleLimit(), pConfiguration->GetUploadInterval(), true),
     _pConfiguration(pConfiguration),
     _callstackProvider{std::move(callstackProvider)},
-    _metricsRegistry{metricsRegistry}
+    _metricsRegistry{metricsRegistry},
+    _stackFramesCollectors{pCorProfilerInfo, pConfiguration, &_callstackProvider, metricsRegistry}
 {
     _exceptionsCountMetric = metricsRegistry.GetOrRegister<CounterMetric>("dotnet_exceptions");
     _sampledExceptionsCountMetric = metricsRegistry.GetOrRegister<CounterMetric>("dotnet_sampled_exceptions");
@@ -140,8 +141,7 @@ bool ExceptionsProvider::OnExceptionThrown(ObjectID thrownObjectId)
     }
 
     uint32_t hrCollectStack = E_FAIL;
-    const auto pStackFramesCollector = OsSpecificApi::CreateNewStackFramesCollectorInstance(
-        _pCorProfilerInfo, _pConfiguration, &_callstackProvider, _metricsRegistry);
+    const auto pStackFramesCollector = _stackFramesCollectors.Acquire();
 
     pStackFramesCollector->PrepareForNextCollection();
     const auto result = pStackFramesCollector->CollectStackSample(threadInfo.get(), &hrCollectStack);
@@ -269,11 +269,10 @@ ExceptionsProvider::MemoryStats ExceptionsProvider::ComputeMemoryStats() const
         stats.exceptionTypesStringsSize += typeName.capacity();
     }
 
-    // Estimate GroupSampler memory (contains two unordered_map/set)
-    // This is an approximation since GroupSampler is a template and we can't easily access its internals
+    // Estimate GroupSampler memory (buckets + one allocated info per group)
+    // This is an approximation since the group names could be allocated outside of the info
     stats.samplerSize = sizeof(GroupSampler<std::string>);
-    // Add estimated overhead for the internal maps (rough estimate)
-    stats.samplerSize += stats.exceptionTypesCount * (sizeof(std::string) + sizeof(GroupSampler<std::string>::GroupInfo) + sizeof(void*) * 2);
+    stats.samplerSize += _sampler.GetGroupsCount() * sizeof(GroupSampler<std::string>::GroupInfo);
 
     return stats;
 }
@@ -13,6 +13,7 @@
 #include "corprof.h"
 #include "GroupSampler.h"
 #include "OsSpecificApi.h"
+#include "StackFramesCollectorPool.h"
 #include "StackSnapshotResultBuffer.h"
 #include "MetricsRegistry.h"
 #include "CounterMetric.h"
@@ -104,4 +105,5 @@ private:
     std::shared_ptr<CounterMetric> _sampledExceptionsCountMetric;
     CallstackProvider _callstackProvider;
     MetricsRegistry& _metricsRegistry;
+    StackFramesCollectorPool _stackFramesCollectors;
 };
@@ -157,17 +157,35 @@ std::pair<bool, FrameInfoView> FrameStore::GetFrame(uintptr_t instructionPointer
 }
 
 
+#ifdef DD_TEST
+void FrameStore::AddPendingFrameForTests(FunctionID functionId, std::string_view frame, ModuleID moduleId, mdMethodDef methodDef)
+{
+    _pendingMethods.Emplace(functionId, PendingFrameInfo{FrameInfo{{}, _stringArena.Allocate(frame), {}, 0}, moduleId, methodDef});
+}
+#endif
+
 FrameInfoView FrameStore::GetManagedFrame(FunctionID functionId)
 {
+    // Look into the cache first
+    auto* cachedFrame = _methods.Find(functionId);
+    if (cachedFrame != nullptr)
     {
-        std::lock_guard<std::mutex> lock(_methodsLock);
+        return *cachedFrame;
+    }
 
-        // Look into the cache first
-        auto element = _methods.find(functionId);
-        if (element != _methods.end())
+    // the pending frame is copied: it is erased once promoted into _methods
+    PendingFrameInfo pendingFrame;
+    if (_pendingMethods.TryGet(functionId, pendingFrame))
+    {
+        auto debugInfo = _pDebugInfoStore->Get(pendingFrame.ModuleId, pendingFrame.MethodDef);
+        if (debugInfo.IsPending)
         {
-            return element->second;
+            return pendingFrame.Info;
         }
+
+        auto [value, inserted] = _methods.Emplace(functionId, FrameInfo{pendingFrame.Info.ModuleName, pendingFrame.Info.Frame, debugInfo.File, debugInfo.StartLine});
+        _pendingMethods.Erase(functionId);
+        return *value;
     }
 
     // Get the method generic parameters if any + metadata token + class ID + module ID
@@ -217,52 +235,45 @@ FrameInfoView FrameStore::GetManagedFrame(FunctionID functionId)
             // It's safe to cache, because there is no reason that the next calls to
             // BuildTypeDesc will succeed.
 
-            std::lock_guard<std::mutex> lock(_methodsLock);
-            auto& value = _methods[functionId];
-            std::stringstream builder;
-            builder << UnknownManagedType << " |fn:" << std::move(methodName) << " |fg:" << std::move(methodGenericParameters) << " |sg:" << std::move(signature);
-            value = {UnknownManagedAssembly, builder.str(), "", 0};
+            std::string builder;
+            builder.reserve(UnknownManagedType.size() + methodName.size() + methodGenericParameters.size() + signature.size() + 12);
+            builder.append(UnknownManagedType).append(" |fn:").append(methodName).append(" |fg:").append(methodGenericParameters).append(" |sg:").append(signature);
+            auto [value, inserted] = _methods.Emplace(functionId, FrameInfo{UnknownManagedAssembly, _stringArena.Allocate(builder), "", 0});
 
-            // Incrementally track item size
-            size_t itemSize = value.ModuleName.capacity() + value.Frame.capacity();
-            _cachedItemsSize.fetch_add(itemSize, std::memory_order_relaxed);
-
-            return value;
+            return *value;
         }
 
         pTypeDesc = &typeDesc;
     }
 
     // build the frame from assembly, namespace, type and method names
-    std::stringstream builder;
+    // (the buffer is reused by the calling thread: no allocation once it has grown enough)
+    thread_local std::string builder;
+    builder.clear();
     if (!pTypeDesc->Assembly.empty())
     {
-        builder << "|lm:" << pTypeDesc->Assembly;
+        builder.append("|lm:").append(pTypeDesc->Assembly);
     }
-    builder << " |ns:" << pTypeDesc->Namespace;
-    builder << " |ct:" << pTypeDesc->Type;
-    builder << " |cg:" << pTypeDesc->Parameters;
-    builder << " |fn:" << methodName;
-    builder << " |fg:" << methodGenericParameters;
-    builder << " |sg:" << signature;
+    builder.append(" |ns:").append(pTypeDesc->Namespace);
+    builder.append(" |ct:").append(pTypeDesc->Type);
+    builder.append(" |cg:").append(pTypeDesc->Parameters);
+    builder.append(" |fn:").append(methodName);
+    builder.append(" |fg:").append(methodGenericParameters);
+    builder.append(" |sg:").append(signature);
 
     auto debugInfo = _pDebugInfoStore->Get(moduleId, mdTokenFunc);
-
-    std::string managedFrame = builder.str();
-
+    if (debugInfo.IsPending)
     {
-        std::lock_guard<std::mutex> lock(_methodsLock);
-
-        // store it into the function cache and return an iterator to the stored elements
-        auto [it, _] = _methods.emplace(functionId, FrameInfo{pTypeDesc->Assembly, managedFrame, debugInfo.File, debugInfo.StartLine});
+        // the file and line will be added when the frame is needed after the debug info is loaded
+        auto [value, inserted] = _pendingMethods.Emplace(functionId, PendingFrameInfo{FrameInfo{pTypeDesc->Assembly, _stringArena.Allocate(builder), {}, 0}, moduleId, mdTokenFunc});
+        return value->Info;
+    }
 
-        // Incrementally track item size
-        size_t itemSize = it->second.ModuleName.capacity() + it->second.Frame.capacity();
-        _cachedItemsSize.fetch_add(itemSize, std::memory_order_relaxed);
+    // store it into the function cache: if another thread was faster, its frame is returned
+    // (the arena bytes of the losing thread are not reclaimed but this race is rare)
+    auto [value, inserted] = _methods.Emplace(functionId, FrameInfo{pTypeDesc->Assembly, _stringArena.Allocate(builder), debugInfo.File, debugInfo.StartLine});
 
-        // first is the key, second is the associated value
-        return it->second;
-    }
+    return *value;
 }
 
 bool FrameStore::GetTypeName(ClassID classId, std::string& name)
@@ -273,14 +284,13 @@ bool FrameStore::GetTypeName(ClassID classId, std::string& name)
         return false;
     }
 
-    if (pTypeDesc->Namespace.empty())
+    name.clear();
+    name.reserve(pTypeDesc->Namespace.size() + 1 + pTypeDesc->Type.size() + pTypeDesc->Parameters.size());
+    if (!pTypeDesc->Namespace.empty())
     {
-        name = pTypeDesc->Type;
-    }
-    else
-    {
-        name = pTypeDesc->Namespace + "." + pTypeDesc->Type;
+        name.append(pTypeDesc->Namespace).append(".");
     }
+    name.append(pTypeDesc->Type);
 
     // generic and array if any
     if (!pTypeDesc->Parameters.empty())
@@ -300,13 +310,11 @@ bool FrameStore::GetTypeName(ClassID classId, std::string& name)
 // This is why it is needed to get a pointer to the TypeDesc held by the cache
 bool FrameStore::GetTypeName(ClassID classId, std::string_view& name)
 {
-    std::lock_guard<std::mutex> lock(_fullTypeNamesLock);
-
-    auto typeEntry = _fullTypeNames.find(classId);
-    if (typeEntry != _fullTypeNames.end())
+    auto* cachedName = _fullTypeNames.Find(classId);
+    if (cachedName != nullptr)
     {
         // ensure that the string_view is pointing to the string in the cache
-        name = {typeEntry->second.data(), typeEntry->second.size()};
+        name = {cachedName->data(), cachedName->size()};
         return true;
     }
 
@@ -317,12 +325,14 @@ bool FrameStore::GetTypeName(ClassID classId, std::string_view& name)
     }
 
     // ensure that the string_view is pointing to the string in the cache
-    auto& entry = _fullTypeNames[classId];
-    entry = pTypeDesc->Type + pTypeDesc->Parameters;
-    name = {entry.data(), entry.size()};
+    auto [entry, inserted] = _fullTypeNames.Emplace(classId, pTypeDesc->Type + pTypeDesc->Parameters);
+    name = {entry->data(), entry->size()};
 
     // Incrementally track item size
-    _cachedItemsSize.fetch_add(entry.capacity(), std::memory_order_relaxed);
+    if (inserted)
+    {
+        _cachedItemsSize.fetch_add(entry->capacity(), std::memory_order_relaxed);
+    }
 
     return true;
 }
@@ -331,12 +341,10 @@ bool FrameStore::GetCachedTypeDesc(ClassID classId, TypeDesc*& typeDesc)
 {
     if (classId != 0)
     {
-        std::lock_guard<std::mutex> lock(_typesLock);
-
-        auto typeEntry = _types.find(classId);
-        if (typeEntry != _types.end())
+        auto* cachedTypeDesc = _types.Find(classId);
+        if (cachedTypeDesc != nullptr)
         {
-            typeDesc = &typeEntry->second;
+            typeDesc = cachedTypeDesc;
             return true;
         }
     }
@@ -428,22 +436,17 @@ bool FrameStore::GetTypeDesc(ClassID classId, TypeDesc*& pTypeDesc)
 
         if (originalClassId != 0)
         {
-            std::lock_guard<std::mutex> lock(_typesLock);
-
             // it is possible that another thread already added the type description while we were building it
-            auto typeEntry = _types.find(originalClassId);
-            if (typeEntry != _types.end())
-            {
-                pTypeDesc = &typeEntry->second;
-                return true;
-            }
-
-            pTypeDesc = &(_types[originalClassId] = typeDesc);
+            auto [value, inserted] = _types.Emplace(originalClassId, std::move(typeDesc));
+            pTypeDesc = value;
 
             // Incrementally track item size
-            size_t itemSize = pTypeDesc->Assembly.capacity() + pTypeDesc->Namespace.capacity() +
-                              pTypeDesc->Type.capacity() + pTypeDesc->Parameters.capacity();
-            _cachedItemsSize.fetch_add(itemSize, std::memory_order_relaxed);
+            if (inserted)
+            {
+                // Assembly and Namespace are accounted in the string arena
+                size_t itemSize = pTypeDesc->Type.capacity() + pTypeDesc->Parameters.capacity();
+                _cachedItemsSize.fetch_add(itemSize, std::memory_order_relaxed);
+            }
         }
         else
         {
@@ -467,16 +470,18 @@ bool FrameStore::BuildTypeDesc(
     const char* arraySuffix)
 {
     // 1. Get the assembly from the module
-    if (!GetAssemblyName(_pCorProfilerInfo, moduleId, typeDesc.Assembly))
+    std::string assemblyName;
+    if (!GetAssemblyName(_pCorProfilerInfo, moduleId, assemblyName))
     {
         return false;
     }
+    typeDesc.Assembly = _stringArena.Intern(assemblyName);
 
     // 2. Look for the type name including namespace (need to take into account nested types and generic types)
     auto [ns, ct, cg] = GetManagedTypeName(_pCorProfilerInfo, pMetadataImport, moduleId, classId, mdTokenType, isArray, arraySuffix);
-    typeDesc.Namespace = ns;
-    typeDesc.Type = ct;
-    typeDesc.Parameters = cg;
+    typeDesc.Namespace = _stringArena.Intern(ns);
+    typeDesc.Type = std::move(ct);
+    typeDesc.Parameters = std::move(cg);
 
     return true;
 }
@@ -596,8 +601,8 @@ std::tuple<ULONG, std::string, std::string, mdTypeDef> FrameStore::GetMethodName
     // |fn:LongGenericParameterList |fg:<System.Byte, System.Boolean, System.Boolean, System.Boolean, T5, System.Boolean, System.Boolean, System.Boolean>
     // since string is a reference type, the __canon implementation is used and we can't know it is a string
     // --> this is why T5 (from the metadata) is used
-    std::stringstream builder;
-    builder << "<";
+    std::string builder;
+    builder.append("<");
     for (ULONG32 i = 0; i < genericParametersCount; i++)
     {
         auto [ns, typeName] = GetManagedTypeName(_pCorProfilerInfo, genericParameters[i]);
@@ -605,27 +610,27 @@ std::tuple<ULONG, std::string, std::string, mdTypeDef> FrameStore::GetMethodName
         // deal with System.__Canon case
         if (typeName == "__Canon")
         {
-            builder << "T" << i;
+            builder.append("T").append(std::to_string(i));
         }
         else // normal namespace.type case
         {
             // a type declared outside of any namespace has no namespace: don't prefix it with a '.'
             if (!ns.empty())
             {
-                builder << ns << ".";
+                builder.append(ns).append(".");
             }
 
-            builder << typeName;
+            builder.append(typeName);
         }
 
         if (i < genericParametersCount - 1)
         {
-            builder << ", ";
+            builder.append(", ");
         }
     }
-    builder << ">";
+    builder.append(">");
 
-    return std::make_tuple(rva, methodName, builder.str(), mdTokenType);
+    return std::make_tuple(rva, std::move(methodName), std::move(builder), mdTokenType);
 }
 
 bool FrameStore::GetAssemblyName(ICorProfilerInfo4* pInfo, ModuleID moduleId, std::string& assemblyName)
@@ -778,10 +783,9 @@ std::vector<std::string> GetGenericTypeParameters(IMetaDataImport2* pMetadata, m
     return parameters;
 }
 
-std::string FrameStore::FormatGenericTypeParameters(IMetaDataImport2* pMetadata, mdTypeDef mdTokenType)
+void FrameStore::FormatGenericTypeParameters(IMetaDataImport2* pMetadata, mdTypeDef mdTokenType, std::string& builder)
 {
-    std::stringstream builder;
-    builder << "<";
+    builder.append("<");
 
     // Get all generic parameters definition (ex: "{K, V}" for Dictionary<K,V>)
     // --> need to iterate on the generic arguments definition with metadata API
@@ -789,30 +793,29 @@ std::string FrameStore::FormatGenericTypeParameters(IMetaDataImport2* pMetadata,
     size_t genericParamsCount = parameters.size();
     for (size_t currentParam = 0; currentParam < genericParamsCount; currentParam++)
     {
-        builder << parameters[currentParam];
+        builder.append(parameters[currentParam]);
 
         if (currentParam < genericParamsCount - 1)
         {
-            builder << ", ";
+            builder.append(", ");
         }
     }
-    builder << ">";
-
-    return builder.str();
+    builder.append(">");
 }
 
-void FrameStore::ConcatUnknownGenericType(std::stringstream& builder)
+void FrameStore::ConcatUnknownGenericType(std::string& builder)
 {
-    builder << "T";
+    builder.append("T");
 }
 
-std::string FrameStore::FormatGenericParameters(
+// append the generic parameters of an instantiated generic type (ex: "<System.Int32, System.String>")
+void FrameStore::FormatGenericParameters(
     ICorProfilerInfo4* pInfo,
     ULONG32 numGenericTypeArgs,
-    ClassID* genericTypeArgs)
+    ClassID* genericTypeArgs,
+    std::string& builder)
 {
-    std::stringstream builder;
-    builder << "<";
+    builder.append("<");
 
     for (size_t currentGenericArg = 0; currentGenericArg < numGenericTypeArgs; currentGenericArg++)
     {
@@ -841,27 +844,22 @@ std::string FrameStore::FormatGenericParameters(
                 else
                 {
                     auto [ns, ct, cg] = GetManagedTypeName(pInfo, pMetadata.Get(), argModuleId, argClassId, mdType, false, nullptr);
-                    if (ns.empty())
-                    {
-                        builder << ct;
-                    }
-                    else
+                    if (!ns.empty())
                     {
-                        builder << ns << "." << ct;
+                        builder.append(ns).append(".");
                     }
+                    builder.append(ct);
                 }
             }
         }
 
         if (currentGenericArg < numGenericTypeArgs - 1)
         {
-            builder << ", ";
+            builder.append(", ");
         }
     }
 
-    builder << ">";
-
-    return builder.str();
+    builder.append(">");
 }
 
 // for a given classId/mdTypeDef, get:
@@ -885,16 +883,15 @@ std::tuple<std::string, std::string, std::string> FrameStore::GetManagedTypeName
     if (classId == 0)
     {
         // concat the generic parameter types from metadata based on mdTokenType
-        auto genericParameters = FormatGenericTypeParameters(pMetadata, mdTokenType);
+        std::string genericParameters;
+        FormatGenericTypeParameters(pMetadata, mdTokenType, genericParameters);
 
         if (isArray)
         {
-            return std::make_tuple(std::move(ns), typeName, genericParameters + arraySuffix);
-        }
-        else
-        {
-            return std::make_tuple(std::move(ns), typeName, genericParameters);
+            genericParameters.append(arraySuffix);
         }
+
+        return std::make_tuple(std::move(ns), std::move(typeName), std::move(genericParameters));
     }
 
     // figure out the instanciated generic parameters if any
@@ -942,16 +939,15 @@ std::tuple<std::string, std::string, std::string> FrameStore::GetManagedTypeName
     }
 
     // concat the generic parameter types
-    auto genericParameters = FormatGenericParameters(pInfo, numGenericTypeArgs, genericTypeArgs.get());
+    std::string genericParameters;
+    FormatGenericParameters(pInfo, numGenericTypeArgs, genericTypeArgs.get(), genericParameters);
 
     if (isArray)
     {
-        return std::make_tuple(std::move(ns), std::move(typeName), genericParameters + arraySuffix);
-    }
-    else
-    {
-        return std::make_tuple(std::move(ns), std::move(typeName), std::move(genericParameters));
+        genericParameters.append(arraySuffix);
     }
+
+    return std::make_tuple(std::move(ns), std::move(typeName), std::move(genericParameters));
 }
 
 std::tuple<std::string, mdTypeDef, ULONG> FrameStore::GetMethodNameFromMetadata(IMetaDataImport2* pMetadataImport, mdMethodDef mdTokenFunc)
@@ -1556,58 +1552,48 @@ FrameStore::MemoryStats FrameStore::ComputeMemoryStats() const
     stats.baseSize = sizeof(FrameStore);
 
     // Calculate memory for _methods cache
-    {
-        std::lock_guard<std::mutex> lock(_methodsLock);
-        stats.methodsBuckets = _methods.bucket_count();
-        stats.methodsCount = _methods.size();
-        stats.methodsCacheSize = stats.methodsBuckets * (sizeof(FunctionID) + sizeof(FrameInfo) + sizeof(void*));
-        for (const auto& [key, frameInfo] : _methods)
-        {
-            stats.methodsCacheSize += frameInfo.ModuleName.capacity();
-            stats.methodsCacheSize += frameInfo.Frame.capacity();
-            // Filename is a string_view, no additional memory
-        }
-    }
+    stats.methodsBuckets = _methods.BucketCount();
+    stats.methodsCount = 0;
+    stats.methodsCacheSize = stats.methodsBuckets * (sizeof(FunctionID) + sizeof(FrameInfo) + sizeof(void*));
+    _methods.ForEach([&stats](FunctionID, FrameInfo const&) {
+        // the strings are stored in the string arena
+        stats.methodsCount++;
+    });
 
     // Calculate memory for _types cache
-    {
-        std::lock_guard<std::mutex> lock(_typesLock);
-        stats.typesBuckets = _types.bucket_count();
-        stats.typesCount = _types.size();
-        stats.typesCacheSize = stats.typesBuckets * (sizeof(ClassID) + sizeof(TypeDesc) + sizeof(void*));
-        for (const auto& [key, typeDesc] : _types)
-        {
-            stats.typesCacheSize += typeDesc.Assembly.capacity();
-            stats.typesCacheSize += typeDesc.Namespace.capacity();
-            stats.typesCacheSize += typeDesc.Type.capacity();
-            stats.typesCacheSize += typeDesc.Parameters.capacity();
-        }
-    }
+    stats.typesBuckets = _types.BucketCount();
+    stats.typesCount = 0;
+    stats.typesCacheSize = stats.typesBuckets * (sizeof(ClassID) + sizeof(TypeDesc) + sizeof(void*));
+    _types.ForEach([&stats](ClassID, TypeDesc const& typeDesc) {
+        stats.typesCount++;
+        stats.typesCacheSize += typeDesc.Type.capacity();
+        stats.typesCacheSize += typeDesc.Parameters.capacity();
+    });
 
     // Calculate memory for _framePerNativeModule cache
-    {
-        std::lock_guard<std::mutex> lock(_nativeLock);
-        stats.nativeFramesBuckets = _framePerNativeModule.bucket_count();
-        stats.nativeFramesCount = _framePerNativeModule.size();
-        stats.nativeFramesCacheSize = stats.nativeFramesBuckets * (sizeof(std::string) + sizeof(std::string) + sizeof(void*));
-        for (const auto& [key, value] : _framePerNativeModule)
-        {
-            stats.nativeFramesCacheSize += key.capacity();
-            stats.nativeFramesCacheSize += value.capacity();
-        }
-    }
+    stats.nativeFramesBuckets = _framePerNativeModule.BucketCount();
+    stats.nativeFramesCount = 0;
+    stats.nativeFramesCacheSize = stats.nativeFramesBuckets * (sizeof(std::string) + sizeof(std::string) + sizeof(void*));
+    _framePerNativeModule.ForEach([&stats](std::string const& key, std::string const& value) {
+        stats.nativeFramesCount++;
+        stats.nativeFramesCacheSize += key.capacity();
+        stats.nativeFramesCacheSize += value.capacity();
+    });
 
     // Calculate memory for _fullTypeNames cache
-    {
-        std::lock_guard<std::mutex> lock(_fullTypeNamesLock);
-        stats.fullTypeNamesBuckets = _fullTypeNames.bucket_count();
-        stats.fullTypeNamesCount = _fullTypeNames.size();
-        stats.fullTypeNamesCacheSize = stats.fullTypeNamesBuckets * (sizeof(ClassID) + sizeof(std::string) + sizeof(void*));
-        for (const auto& [key, value] : _fullTypeNames)
-        {
-            stats.fullTypeNamesCacheSize += value.capacity();
-        }
-    }
+    stats.fullTypeNamesBuckets = _fullTypeNames.BucketCount();
+    stats.fullTypeNamesCount = 0;
+    stats.fullTypeNamesCacheSize = stats.fullTypeNamesBuckets * (sizeof(ClassID) + sizeof(std::string) + sizeof(void*));
+    _fullTypeNames.ForEach([&stats](ClassID, std::string const& value) {
+        stats.fullTypeNamesCount++;
+        stats.fullTypeNamesCacheSize += value.capacity();
+    });
+
+    // Calculate memory for the strings stored in the arena
+    stats.stringArenaSize = _stringArena.GetMemorySize();
+    stats.stringArenaUsedSize = _stringArena.GetUsedSize();
+    stats.stringArenaBlocks = _stringArena.GetBlocksCount();
+    stats.internedStringsCount = _stringArena.GetInternedCount();
 
     return stats;
 }
@@ -1617,25 +1603,15 @@ size_t FrameStore::GetMemorySize() const
     size_t totalSize = sizeof(FrameStore);
 
     // Calculate container overhead on-demand
-    {
-        std::lock_guard<std::mutex> lock(_methodsLock);
-        totalSize += _methods.bucket_count() * (sizeof(FunctionID) + sizeof(FrameInfo) + sizeof(void*));
-    }
+    totalSize += _methods.BucketCount() * (sizeof(FunctionID) + sizeof(FrameInfo) + sizeof(void*));
+    // the pending frames are erased once their debug info is loaded: only the remaining ones are counted
+    totalSize += _pendingMethods.Size() * (sizeof(FunctionID) + sizeof(PendingFrameInfo)) + _pendingMethods.BucketCount() * sizeof(void*);
+    totalSize += _types.BucketCount() * (sizeof(ClassID) + sizeof(TypeDesc) + sizeof(void*));
+    totalSize += _framePerNativeModule.BucketCount() * (sizeof(std::string) * 2 + sizeof(void*));
+    totalSize += _fullTypeNames.BucketCount() * (sizeof(ClassID) + sizeof(std::string) + sizeof(void*));
 
-    {
-        std::lock_guard<std::mutex> lock(_typesLock);
-        totalSize += _types.bucket_count() * (sizeof(ClassID) + sizeof(TypeDesc) + sizeof(void*));
-    }
-
-    {
-        std::lock_guard<std::mutex> lock(_nativeLock);
-        totalSize += _framePerNativeModule.bucket_count() * (sizeof(std::string) * 2 + sizeof(void*));
-    }
-
-    {
-        std::lock_guard<std::mutex> lock(_fullTypeNamesLock);
-        totalSize += _fullTypeNames.bucket_count() * (sizeof(ClassID) + sizeof(std::string) + sizeof(void*));
-    }
+    // The arena tracks its own size
+    totalSize += _stringArena.GetMemorySize();
 
     // Add cached items size (updated incrementally at add time)
     totalSize += _cachedItemsSize.load(std::memory_order_relaxed);
@@ -1653,5 +1629,6 @@ void FrameStore::LogMemoryBreakdown() const
     Log::Debug("  Types cache:             ", stats.typesCacheSize, " bytes (", stats.typesCount, " entries, ", stats.typesBuckets, " buckets)");
     Log::Debug("  Native frames cache:     ", stats.nativeFramesCacheSize, " bytes (", stats.nativeFramesCount, " entries, ", stats.nativeFramesBuckets, " buckets)");
     Log::Debug("  Full type names cache:   ", stats.fullTypeNamesCacheSize, " bytes (", stats.fullTypeNamesCount, " entries, ", stats.fullTypeNamesBuckets, " buckets)");
+    Log::Debug("  String arena:            ", stats.stringArenaSize, " bytes (", stats.stringArenaUsedSize, " used, ", stats.stringArenaBlocks, " blocks, ", stats.internedStringsCount, " interned strings)");
     Log::Debug("  Total memory:            ", stats.GetTotal(), " bytes (", (stats.GetTotal() / 1024.0), " KB)");
 }
\ No newline at end of file
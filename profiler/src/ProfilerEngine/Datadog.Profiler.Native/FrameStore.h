@@ -12,6 +12,8 @@
 #include <vector>
 #include "IFrameStore.h"
 #include "IDebugInfoStore.h"
+#include "ShardedMap.h"
+#include "StringArena.h"
 
 #include "shared/src/native-src/com_ptr.h"
 
@@ -29,8 +31,9 @@ private:
     class TypeDesc
     {
     public:
-        std::string Assembly;
-        std::string Namespace;
+        // assembly and namespace are shared by many types: they are interned in the string arena
+        std::string_view Assembly;
+        std::string_view Namespace;
         std::string Type;
         std::string Parameters;
     };
@@ -62,6 +65,15 @@ public:
     size_t GetMemorySize() const override;
     void LogMemoryBreakdown() const override;
 
+#ifdef DD_TEST
+    // simulate a frame resolved while the debug info of its module was still loading
+    void AddPendingFrameForTests(FunctionID functionId, std::string_view frame, ModuleID moduleId, mdMethodDef methodDef);
+    size_t GetPendingFramesCountForTests() const
+    {
+        return _pendingMethods.Size();
+    }
+#endif
+
 private:
     std::optional<std::pair<HRESULT, FunctionID>> GetFunctionFromIP(uintptr_t instructionPointer);
 
@@ -103,11 +115,12 @@ private:  // global helpers
     static std::pair<std::string, std::string> GetTypeWithNamespace(
         IMetaDataImport2* pMetadata,
         mdTypeDef mdTokenType);
-    static std::string FormatGenericTypeParameters(IMetaDataImport2* pMetadata, mdTypeDef mdTokenType);
-    static std::string FormatGenericParameters(
+    static void FormatGenericTypeParameters(IMetaDataImport2* pMetadata, mdTypeDef mdTokenType, std::string& builder);
+    static void FormatGenericParameters(
         ICorProfilerInfo4* pInfo,
         ULONG32 numGenericTypeArgs,
-        ClassID* genericTypeArgs);
+        ClassID* genericTypeArgs,
+        std::string& builder);
     static std::tuple<std::string, std::string, std::string> GetManagedTypeName(
         ICorProfilerInfo4* pInfo,
         IMetaDataImport2* pMetadata,
@@ -136,7 +149,7 @@ private:  // global helpers
         mdMethodDef mdTokenFunc
         );
     static std::pair<std::string, std::string> GetManagedTypeName(ICorProfilerInfo4* pInfo, ClassID classId);
-    static void ConcatUnknownGenericType(std::stringstream& builder);
+    static void ConcatUnknownGenericType(std::string& builder);
 
 private:
     struct MemoryStats
@@ -154,10 +167,14 @@ private:
         size_t fullTypeNamesCacheSize;
         size_t fullTypeNamesCount;
         size_t fullTypeNamesBuckets;
+        size_t stringArenaSize;
+        size_t stringArenaUsedSize;
+        size_t stringArenaBlocks;
+        size_t internedStringsCount;
 
         size_t GetTotal() const
         {
-            return baseSize + methodsCacheSize + typesCacheSize + nativeFramesCacheSize + fullTypeNamesCacheSize;
+            return baseSize + methodsCacheSize + typesCacheSize + nativeFramesCacheSize + fullTypeNamesCacheSize + stringArenaSize;
         }
     };
 
@@ -168,11 +185,12 @@ private:
     mutable std::atomic<size_t> _cachedItemsSize;
 
 private:
+    // the strings are owned by the string arena (or are static): no allocation per cached method
     struct FrameInfo
     {
     public:
-        std::string ModuleName;
-        std::string Frame;
+        std::string_view ModuleName;
+        std::string_view Frame;
         std::string_view Filename;
         std::uint32_t StartLine;
 
@@ -185,19 +203,29 @@ private:
     ICorProfilerInfo4* _pCorProfilerInfo;
     IDebugInfoStore* _pDebugInfoStore;
 
-    // mutable to allow locking in const methods (e.g., GetMemorySize, LogMemoryBreakdown)
-    mutable std::mutex _methodsLock;
-    mutable std::mutex _nativeLock;
+    // storage for the module names, namespaces and frames of the caches
+    // (must be declared before the caches pointing to its strings)
+    StringArena _stringArena;
+
+    // frame related caches are sharded so that the samples worker, the allocations recorder
+    // and the heap snapshot manager can resolve symbols concurrently without blocking each other
+    ShardedMap<FunctionID, FrameInfo> _methods;
 
-    // frame relate caches functions
-    std::unordered_map<FunctionID, FrameInfo> _methods;
-    mutable std::mutex _typesLock;
-    std::unordered_map<ClassID, TypeDesc> _types;
-    std::unordered_map<std::string, std::string> _framePerNativeModule;
+    // frames of the methods whose module debug info is still being loaded: they are added to _methods
+    // with their file and line once the debug info is available
+    struct PendingFrameInfo
+    {
+    public:
+        FrameInfo Info;
+        ModuleID ModuleId;
+        mdMethodDef MethodDef;
+    };
+    ShardedMap<FunctionID, PendingFrameInfo> _pendingMethods;
+    ShardedMap<ClassID, TypeDesc> _types;
+    ShardedMap<std::string, std::string> _framePerNativeModule;
 
     // for allocation recorder
-    mutable std::mutex _fullTypeNamesLock;
-    std::unordered_map<ClassID, std::string> _fullTypeNames;
+    ShardedMap<ClassID, std::string> _fullTypeNames;
 
     bool _resolveNativeFrames;
     ManagedCodeCache* _pManagedCodeCache;
@@ -28,6 +28,10 @@ namespace GCDesc
 // enum_flag_ContainsPointers = 0x01000000 in CoreCLR's vm/methodtable.h.
 static constexpr uint32_t Flag_ContainsPointers = 0x01000000;
 
+// enum_flag_HasComponentSize = 0x80000000 in CoreCLR's vm/methodtable.h.
+// When set, the low WORD of the flags is the size of an array element (or string char).
+static constexpr uint32_t Flag_HasComponentSize = 0x80000000;
+
 // Upper bound on the number of ValSerieItems describing a single value-type
 // array element. The CLR caps reference groups per value type well below this;
 // it is used purely as a defensive sanity bound when reading negative GCDesc
@@ -98,6 +102,43 @@ inline bool ContainsGCPointers(ClassID classID)
     return (*flags & Flag_ContainsPointers) != 0;
 }
 
+// Arrays and strings: their size depends on the number of components
+inline bool HasComponentSize(ClassID classID)
+{
+    auto* flags = reinterpret_cast<const uint32_t*>(classID);
+    return (*flags & Flag_HasComponentSize) != 0;
+}
+
+// Raw equivalents of GetClassFromObject and GetObjectSize2 (Object::GetGCSafeMethodTable and
+// Object::GetSize in CoreCLR) for the threads that are not allowed to call the profiling API.
+// They are only trusted once they returned the same values as the API for a few objects.
+//
+// The GC uses the low bits of the MethodTable pointer to mark the object during a collection.
+inline ClassID GetObjectClass(uintptr_t objectAddress)
+{
+    auto methodTable = *reinterpret_cast<const uintptr_t*>(objectAddress);
+    return static_cast<ClassID>(methodTable & ~static_cast<uintptr_t>(sizeof(void*) - 1));
+}
+
+// Number of elements of an array (whatever its rank) or chars of a string, stored right after
+// the MethodTable pointer.
+inline uint32_t GetComponentCount(uintptr_t objectAddress)
+{
+    return *reinterpret_cast<const uint32_t*>(objectAddress + sizeof(void*));
+}
+
+// m_BaseSize is the second DWORD of the MethodTable
+inline SIZE_T GetObjectSize(ClassID classID, uintptr_t objectAddress)
+{
+    auto* mt = reinterpret_cast<const uint32_t*>(classID);
+    SIZE_T size = mt[1];
+    if ((mt[0] & Flag_HasComponentSize) != 0)
+    {
+        size += static_cast<SIZE_T>(mt[0] & 0xFFFF) * GetComponentCount(objectAddress);
+    }
+    return size;
+}
+
 // Read the GCDesc series count from the MethodTable.
 // Positive: regular objects and reference arrays (GCDescSeries encoding).
 // Negative: value type arrays (ValSerieItem encoding).
@@ -3,8 +3,12 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <chrono>
-#include <unordered_set>
+#include <functional>
+#include <vector>
 
 #include "GenericSampler.h"
 #include "IConfiguration.h"
@@ -22,6 +26,10 @@ public:
 
 // Template class that support "sampling by group".
 // At least one element in the group will ALWAYS be sampled if keepAtleastOne is true
+//
+// The sampling decision is taken without lock: the groups are stored in an insert-only hash table
+// (a group is never removed, only its counters are reset when they are read) and the group
+// counters are atomic.
 template <class TGroup>
 class GroupSampler : public GenericSampler
 {
@@ -29,39 +37,72 @@ public:
     GroupSampler<TGroup>(int32_t samplesLimit, std::chrono::seconds uploadInterval, bool keepAtLeastOne = true)
         :
         GenericSampler(samplesLimit, uploadInterval),
-        _keepAtLeastOne{keepAtLeastOne}
+        _groupsCount{0},
+        _keepAtLeastOne{keepAtLeastOne},
+        _currentWindow{1}
     {
+        for (auto& bucket : _buckets)
+        {
+            bucket.store(nullptr, std::memory_order_relaxed);
+        }
     }
 
     ~GroupSampler<TGroup>()
     {
         _sampler.Stop();
+
+        for (auto& bucket : _buckets)
+        {
+            auto* pInfo = bucket.load();
+            while (pInfo != nullptr)
+            {
+                auto* pNext = pInfo->Next;
+                delete pInfo;
+                pInfo = pNext;
+            }
+        }
     }
 
 public:
     struct GroupInfo
     {
-        uint64_t RealCount;
-        uint64_t SampledCount;
-        uint64_t RealValue;
-        uint64_t SampledValue;
+        GroupInfo(TGroup group, std::size_t hash) :
+            Group{std::move(group)},
+            Hash{hash}
+        {
+        }
+
+        TGroup Group;
+        std::size_t Hash;
+        std::atomic<uint64_t> RealCount{0};
+        std::atomic<uint64_t> SampledCount{0};
+        std::atomic<uint64_t> RealValue{0};
+        std::atomic<uint64_t> SampledValue{0};
+
+        // window in which this group has been seen for the last time
+        std::atomic<uint64_t> LastWindow{0};
+
+        // never changed once the group is visible in the table
+        GroupInfo* Next = nullptr;
     };
 
 public:
     bool Sample(TGroup group, uint64_t value = 0)
     {
-        std::unique_lock lock(_groupsMutex);
+        auto* pInfo = GetOrAddGroup(std::move(group));
 
         // increment the real count and value for the given group
-        GroupInfo* pInfo;
-        AddInGroup(group, pInfo, value);
+        pInfo->RealCount.fetch_add(1, std::memory_order_relaxed);
+        pInfo->RealValue.fetch_add(value, std::memory_order_relaxed);
 
-        auto [it, inserted] = _knownGroups.insert(std::move(group));
-        if (inserted && _keepAtLeastOne)
+        auto currentWindow = _currentWindow.load(std::memory_order_relaxed);
+        if (_keepAtLeastOne &&
+            (pInfo->LastWindow.load(std::memory_order_relaxed) != currentWindow) &&
+            (pInfo->LastWindow.exchange(currentWindow, std::memory_order_relaxed) != currentWindow))
         {
             // increment the sampled count and value for the given group
-            pInfo->SampledCount++;
-            pInfo->SampledValue += value;
+            pInfo->SampledCount.fetch_add(1, std::memory_order_relaxed);
+            pInfo->SampledValue.fetch_add(value, std::memory_order_relaxed);
 
             // This is the first time we see this group in this time window,
             // so force the sampling decision
@@ -72,74 +113,110 @@ public:
         if (sampled)
         {
             // increment the sampled count and value for the given group
-            pInfo->SampledCount++;
-            pInfo->SampledValue += value;
+            pInfo->SampledCount.fetch_add(1, std::memory_order_relaxed);
+            pInfo->SampledValue.fetch_add(value, std::memory_order_relaxed);
         }
 
         return sampled;
     }
 
-    // MUST be called under the lock
-    void AddInGroup(TGroup group, GroupInfo*& groupInfo, uint64_t value = 0)
+    std::vector<UpscaleGroupInfo<TGroup>> GetGroups()
     {
-        auto info = _groups.find(group);
-        if (info != _groups.end())
+        std::vector<UpscaleGroupInfo<TGroup>> upscaleGroups;
+        upscaleGroups.reserve(_groupsCount.load(std::memory_order_relaxed));
+
+        for (auto& bucket : _buckets)
         {
-            groupInfo = &(info->second);
-            info->second.RealCount++;
-            info->second.RealValue += value;
-            return;
+            for (auto* pInfo = bucket.load(std::memory_order_acquire); pInfo != nullptr; pInfo = pInfo->Next)
+            {
+                // reset groups count
+                // The counters are not reset atomically together: a sample added at the same time can be
+                // counted as real in this batch and as sampled in the next one (or the other way around).
+                auto sampledCount = pInfo->SampledCount.exchange(0, std::memory_order_relaxed);
+                auto sampledValue = pInfo->SampledValue.exchange(0, std::memory_order_relaxed);
+                auto realCount = pInfo->RealCount.exchange(0, std::memory_order_relaxed);
+                auto realValue = pInfo->RealValue.exchange(0, std::memory_order_relaxed);
+
+                if (sampledCount > 0)
+                {
+                    // never downscale: the sampled samples have been counted as real in a previous batch
+                    realCount = std::max(realCount, sampledCount);
+                    realValue = std::max(realValue, sampledValue);
+                    upscaleGroups.push_back(UpscaleGroupInfo<TGroup>{pInfo->Group, realCount, sampledCount, realValue, sampledValue});
+                }
+            }
         }
 
-        // need to add the info of this new group
-        GroupInfo gi;
-        gi.RealCount = 1;
-        gi.SampledCount = 0;
-        gi.RealValue = value;
-        gi.SampledValue = 0;
-        auto slot = _groups.insert_or_assign(group, gi);
-        groupInfo = &((*slot.first).second);
+        return upscaleGroups;
     }
 
-    std::vector<UpscaleGroupInfo<TGroup>> GetGroups()
+    std::size_t GetGroupsCount() const
     {
-        std::vector<UpscaleGroupInfo<TGroup>> upscaleGroups;
-        std::unique_lock lock(_groupsMutex);
+        return _groupsCount.load(std::memory_order_relaxed);
+    }
 
-        upscaleGroups.reserve(_groups.size());
+protected:
+    void OnRollWindow() override
+    {
+        // all groups are now unknown in the new window
+        _currentWindow.fetch_add(1, std::memory_order_relaxed);
+    }
 
-        for (auto& [name, info] : _groups)
+private:
+    GroupInfo* GetOrAddGroup(TGroup&& group)
+    {
+        auto hash = std::hash<TGroup>{}(group);
+        auto& bucket = _buckets[hash % BucketsCount];
+
+        auto* pHead = bucket.load(std::memory_order_acquire);
+        auto* pInfo = Find(pHead, nullptr, group, hash);
+        if (pInfo != nullptr)
+        {
+            return pInfo;
+        }
+
+        // need to add the info of this new group
+        auto* pNewInfo = new GroupInfo(std::move(group), hash);
+        while (true)
         {
-            auto sampledCount = info.SampledCount;
-            if (sampledCount > 0)
+            pNewInfo->Next = pHead;
+            if (bucket.compare_exchange_weak(pHead, pNewInfo, std::memory_order_release, std::memory_order_acquire))
             {
-                upscaleGroups.push_back(UpscaleGroupInfo<TGroup>{name, info.RealCount, sampledCount, info.RealValue, info.SampledValue});
+                _groupsCount.fetch_add(1, std::memory_order_relaxed);
+                return pNewInfo;
             }
 
-            // reset groups count
-            info.RealCount = 0;
-            info.SampledCount = 0;
-            info.RealValue = 0;
-            info.SampledValue = 0;
+            // the same group could have been added by another thread: only the new ones need to be checked
+            pInfo = Find(pHead, pNewInfo->Next, pNewInfo->Group, hash);
+            if (pInfo != nullptr)
+            {
+                delete pNewInfo;
+                return pInfo;
+            }
         }
-
-        return upscaleGroups;
     }
 
-protected:
-    void OnRollWindow() override
+    static GroupInfo* Find(GroupInfo* pFirst, GroupInfo* pLast, TGroup const& group, std::size_t hash)
     {
-        std::unique_lock lock(_groupsMutex);
-        _knownGroups.clear();
+        for (auto* pInfo = pFirst; pInfo != pLast; pInfo = pInfo->Next)
+        {
+            if ((pInfo->Hash == hash) && (pInfo->Group == group))
+            {
+                return pInfo;
+            }
+        }
+
+        return nullptr;
     }
 
 private:
-    // _knownGroups is used to detect when a new group appear during a given window
-    std::unordered_set<TGroup> _knownGroups;
+    static constexpr std::size_t BucketsCount = 256;
 
     // _groups keeps track of the sampled/real count per group
-    std::unordered_map<TGroup, GroupInfo> _groups;
+    std::array<std::atomic<GroupInfo*>, BucketsCount> _buckets;
+    std::atomic<std::size_t> _groupsCount;
     bool _keepAtLeastOne;
 
-    std::mutex _groupsMutex;
+    // incremented for each new window: used to detect when a group appears in a given window
+    std::atomic<uint64_t> _currentWindow;
 };
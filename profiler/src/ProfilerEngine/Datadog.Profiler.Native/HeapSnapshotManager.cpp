@@ -57,6 +57,7 @@ HeapSnapshotManager::HeapSnapshotManager(
     _memPressureThreshold = pConfiguration->GetHeapSnapshotMemoryPressureThreshold();
     _snapshotCheckInterval = pConfiguration->GetHeapSnapshotCheckInterval();
     _referenceTreeFormat = pConfiguration->GetReferenceTreeFormat();
+    _traversalWorkers = pConfiguration->GetHeapSnapshotTraversalWorkers();
 
     auto testInterval = pConfiguration->GetTestHeapSnapshotInterval();
     _delayFirstSnapshot = (testInterval.count() > 0);
@@ -87,6 +88,14 @@ HeapSnapshotManager::HeapSnapshotManager(
         return static_cast<double>(_lastTraversalFaultCount);
     });
 
+    _referenceTreeSizeMetric = metricsRegistry.GetOrRegister<ProxyMetric>("dotnet_heapsnapshot_reference_tree_size", [this]() {
+        return static_cast<double>(_lastReferenceTreeSize);
+    });
+
+    _referenceTreeNodeCountMetric = metricsRegistry.GetOrRegister<ProxyMetric>("dotnet_heapsnapshot_reference_tree_nodes", [this]() {
+        return static_cast<double>(_lastReferenceTreeNodeCount);
+    });
+
 
     _pCorProfilerInfo->AddRef();
 
@@ -368,7 +377,7 @@ void HeapSnapshotManager::OnBulkRootEdges(
 {
     // This lock MUST stay above the reference-chain traversal below. The traverser
     // recovers from memory access faults via SEH / siglongjmp, which unwinds WITHOUT
-    // running destructors. The fault guard lives entirely inside TraverseFromSingleRoot
+    // running destructors. The fault guard lives entirely inside TraverseRoots
     // (below this lock), so recovery never skips this lock_guard's unlock. Never move
     // the guard above this line or a fault would leave _histogramLock held and deadlock
     // the GC.
@@ -378,6 +387,7 @@ void HeapSnapshotManager::OnBulkRootEdges(
 
     uint32_t successCount = 0;
     uint32_t failCount = 0;
+    _batchRoots.clear();
 
     for (size_t i = 0; i < count; i++)
     {
@@ -442,13 +452,13 @@ void HeapSnapshotManager::OnBulkRootEdges(
         }
 
         successCount++;
-        RootInfo rootInfo(root.RootedNodeAddress, category, rootClassID, size);
+        _batchRoots.emplace_back(root.RootedNodeAddress, category, rootClassID, size);
+    }
 
-        // Traverse the object graph from this root immediately (while still in GC callback context)
-        if (_pReferenceChainTraverser)
-        {
-            _pReferenceChainTraverser->TraverseFromSingleRoot(rootInfo);
-        }
+    // Traverse the object graphs from these roots immediately (while still in GC callback context)
+    if (_pReferenceChainTraverser)
+    {
+        _pReferenceChainTraverser->TraverseRoots(_batchRoots);
     }
 
     Log::Debug("OnBulkRootEdges: batch done, success=", successCount, " failed=", failCount);
@@ -710,6 +720,10 @@ void HeapSnapshotManager::StartGCDump()
             _pReferenceChainTraverser = std::make_unique<ReferenceChainTraverser>(
                 _pCorProfilerInfo, _pFrameStore, *_typeReferenceTree, *_pInlineVTCache,
                 _visitedSetHighWatermark);
+            if (_traversalWorkers > 0)
+            {
+                _pReferenceChainTraverser->StartWorkers(_traversalWorkers);
+            }
         }
 
         _cachedItemsSize.store(0, std::memory_order_relaxed);
@@ -758,6 +772,7 @@ void HeapSnapshotManager::OnEndGCDump()
     // Traversal itself was done incrementally during OnBulkRoot* callbacks.
     if (_pReferenceChainTraverser)
     {
+        _pReferenceChainTraverser->StopWorkers();
         _pReferenceChainTraverser->LogStats();
 
         size_t hwm = _pReferenceChainTraverser->GetVisitedHighWatermark();
@@ -771,6 +786,14 @@ void HeapSnapshotManager::OnEndGCDump()
 
         _lastTraversalFaultCount = _pReferenceChainTraverser->GetFaultCount();
 
+        // the tree is cleared once serialized: keep its peak size for the metrics
+        {
+            std::lock_guard lock(_histogramLock);
+            _lastReferenceTreeSize = _typeReferenceTree->GetMemorySize();
+            _lastReferenceTreeNodeCount = _typeReferenceTree->GetNodeCount();
+        }
+        Log::Debug("Reference tree: ", _lastReferenceTreeNodeCount, " nodes, ", _lastReferenceTreeSize, " bytes");
+
         // Policy separating the permanent layout-level signal from transient
         // traversal stop reasons:
         //  1. Self-test failure is systemic (our MethodTable/GCDesc model is wrong)
@@ -6,6 +6,7 @@
 #include <thread>
 #include <memory>
 #include <unordered_map>
+#include <vector>
 #include <chrono>
 
 #include "IHeapSnapshotManager.h"
@@ -17,6 +18,7 @@
 #include "MetricsRegistry.h"
 #include "ProxyMetric.h"
 #include "InlineVTCache.h"
+#include "ReferenceChainTypes.h"
 #include "SnapshotCooldown.h"
 
 #include "corprof.h"
@@ -28,7 +30,6 @@ class INativeThreadList;
 class IRuntimeInfo;
 class TypeReferenceTree;
 class ReferenceChainTraverser;
-struct RootInfo;
 
 using namespace std::chrono_literals;
 
@@ -179,6 +180,7 @@ private:
     std::chrono::milliseconds _snapshotCheckInterval;
     uint32_t _memPressureThreshold;
     uint32_t _referenceTreeFormat;
+    uint32_t _traversalWorkers;
     bool _delayFirstSnapshot;
     uint64_t _runtimeSessionKeywords;
     uint32_t _runtimeSessionVerbosity;
@@ -196,6 +198,8 @@ private:
     std::shared_ptr<ProxyMetric> _heapSnapshotObjectCountMetric;
     std::shared_ptr<ProxyMetric> _heapSnapshotTotalSizeMetric;
     std::shared_ptr<ProxyMetric> _heapSnapshotTraversalFaultsMetric;
+    std::shared_ptr<ProxyMetric> _referenceTreeSizeMetric;
+    std::shared_ptr<ProxyMetric> _referenceTreeNodeCountMetric;
 
     ICorProfilerInfo12* _pCorProfilerInfo;
     IFrameStore* _pFrameStore;
@@ -235,6 +239,9 @@ private:
     std::unique_ptr<TypeReferenceTree> _typeReferenceTree;
     std::unique_ptr<ReferenceChainTraverser> _pReferenceChainTraverser;
 
+    // roots of the current OnBulkRootEdges batch (reused to avoid allocations)
+    std::vector<RootInfo> _batchRoots;
+
     // Set to true once the GCDesc reader fails its runtime self-test during a dump,
     // or once memory access faults exhaust the budget on several consecutive dumps.
     // When set, subsequent dumps skip reference-chain traversal entirely (no
@@ -253,6 +260,10 @@ private:
     // Fault count from the most recent dump's traversal, surfaced as a metric.
     uint32_t _lastTraversalFaultCount = 0;
 
+    // Size of the reference tree at the end of the last traversal (i.e. its peak)
+    size_t _lastReferenceTreeSize = 0;
+    uint32_t _lastReferenceTreeNodeCount = 0;
+
     // Ensures the runtime version range diagnostic is logged at most once.
     bool _runtimeVersionLogged = false;
 
@@ -88,10 +88,16 @@ public:
     virtual std::chrono::minutes GetHeapSnapshotInterval() const = 0;
     virtual std::chrono::milliseconds GetHeapSnapshotCheckInterval() const = 0;
     virtual uint32_t GetHeapSnapshotMemoryPressureThreshold() const = 0;
+    virtual uint32_t GetHeapSnapshotTraversalWorkers() const = 0;
     virtual std::chrono::seconds GetTestHeapSnapshotInterval() const = 0;
     virtual std::chrono::milliseconds GetLibrariesInfoCacheStartTimeout() const = 0;
     virtual uint32_t GetHeapHandleLimit() const = 0;
     virtual bool UseManagedCodeCache() const = 0;
     virtual bool IsMemoryFootprintEnabled() const = 0;
     virtual uint32_t GetReferenceTreeFormat() const = 0;
+    virtual bool IsPerCpuRingBuffersEnabled() const = 0;
+    virtual bool IsBatchedWalltimeSamplingEnabled() const = 0;
+    virtual bool IsFrameInterningEnabled() const = 0;
+    virtual bool IsUnwindTablesEnabled() const = 0;
+    virtual bool IsAsyncEventsParsingEnabled() const = 0;
 };
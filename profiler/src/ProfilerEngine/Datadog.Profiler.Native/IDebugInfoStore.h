@@ -18,6 +18,9 @@ struct SymbolDebugInfo
 public:
     std::string_view File;
     std::uint32_t StartLine = 0;
+
+    // the debug info of the module is not loaded yet: File and StartLine will be available later
+    bool IsPending = false;
 };
 
 class IDebugInfoStore : public IMemoryFootprintProvider
@@ -25,4 +28,7 @@ class IDebugInfoStore : public IMemoryFootprintProvider
 public:
     virtual ~IDebugInfoStore() = default;
     virtual SymbolDebugInfo Get(ModuleID moduleId, mdMethodDef methodDef) = 0;
+
+    // start loading the debug info of the module in the background
+    virtual void OnModuleLoaded(ModuleID moduleId) = 0;
 };
\ No newline at end of file
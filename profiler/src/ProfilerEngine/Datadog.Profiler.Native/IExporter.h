@@ -21,6 +21,7 @@ public:
     virtual ~IExporter() = default;
     virtual void Add(std::shared_ptr<Sample> const& sample) = 0;
     virtual void SetEndpoint(const std::string& runtimeId, uint64_t traceId, const std::string& endpoint) = 0;
+    // Add and SetEndpoint could be called by other threads while the profiles are exported
     virtual bool Export(bool lastCall = false) = 0;
     virtual void RegisterUpscaleProvider(IUpscaleProvider* provider) = 0;
     virtual void RegisterUpscalePoissonProvider(IUpscalePoissonProvider* provider) = 0;
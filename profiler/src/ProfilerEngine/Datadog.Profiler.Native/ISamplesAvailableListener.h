@@ -0,0 +1,13 @@
+// Unless explicitly stated otherwise all files in this repository are licensed under the Apache 2 License.
+// This product includes software developed at Datadog (https://www.datadoghq.com/). Copyright 2025 Datadog, Inc.
+
+#pragma once
+
+class ISamplesAvailableListener
+{
+public:
+    virtual ~ISamplesAvailableListener() = default;
+
+    // Called by a provider (from any thread) when enough samples are waiting to be collected
+    virtual void OnSamplesAvailable() = 0;
+};
@@ -6,6 +6,7 @@
 #include <memory>
 
 // forward declarations
+class ISamplesAvailableListener;
 class SamplesEnumerator;
 
 class ISamplesProvider
@@ -14,4 +15,10 @@ public:
     virtual ~ISamplesProvider() = default;
     virtual std::unique_ptr<SamplesEnumerator> GetSamples() = 0;
     virtual const char* GetName() = 0;
+
+    // Providers able to detect a burst of samples notify the listener instead of waiting
+    // for the next collection; the others are only collected periodically
+    virtual void SetSamplesAvailableListener(ISamplesAvailableListener* listener)
+    {
+    }
 };
\ No newline at end of file
@@ -12,4 +12,7 @@ public:
     virtual void NotifyCollectionStart() = 0;
     virtual void NotifyCollectionEnd() = 0;
     virtual void NotifyIterationFinished() = 0;
+    virtual bool AllowBatchedStackWalk(std::shared_ptr<ManagedThreadInfo> const& pThreadInfo) = 0;
+    virtual void NotifyBatchCollectionStart() = 0;
+    virtual void NotifyBatchCollectionEnd() = 0;
 };
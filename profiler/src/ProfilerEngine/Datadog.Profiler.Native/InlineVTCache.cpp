@@ -73,6 +73,24 @@ const InlineVTCache::InlineVTInfo* InlineVTCache::GetInlineVTInfo(ClassID classI
     return nullptr;
 }
 
+const InlineVTCache::InlineVTInfo* InlineVTCache::FindInlineVTInfo(ClassID classID, bool& isKnown) const
+{
+    isKnown = true;
+    if (classID == 0 || !GCDesc::ContainsGCPointers(classID))
+    {
+        return nullptr;
+    }
+
+    auto it = _cache.find(classID);
+    if (it == _cache.end())
+    {
+        isKnown = false;
+        return nullptr;
+    }
+
+    return it->second.has_value() ? &it->second.value() : nullptr;
+}
+
 const InlineVTCache::InlineVTInfo* InlineVTCache::GetOrBuildInlineVTInfo(
     ClassID classID,
     InspectionStatus* pStatus)
@@ -72,6 +72,11 @@ public:
     // the first time is queued and gets its attribution starting with the next snapshot.
     const InlineVTInfo* GetInlineVTInfo(ClassID classID);
 
+    // Read-only variant of GetInlineVTInfo for the traversal worker threads: several of them
+    // read the cache at the same time, so nothing is queued here. When isKnown is false, the
+    // type must be given to GetInlineVTInfo once the workers are done.
+    const InlineVTInfo* FindInlineVTInfo(ClassID classID, bool& isKnown) const;
+
     // Inspects the types queued by GetInlineVTInfo and returns how many were inspected.
     //
     // MUST be called outside of the heap dump (i.e. once the EventPipe session is stopped so
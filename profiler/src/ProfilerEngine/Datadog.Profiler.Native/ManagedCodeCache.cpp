@@ -38,7 +38,10 @@ struct IMAGE_NT_HEADERS_GENERIC
 };
 
 ManagedCodeCache::ManagedCodeCache(ICorProfilerInfo4* pProfilerInfo)
-    : _profilerInfo(pProfilerInfo),
+    : _snapshot(new Snapshot()),
+      _epoch(0),
+      _activeReaders{0, 0},
+      _profilerInfo(pProfilerInfo),
       _workerQueueEvent(false),
       _requestStop(false)
 {
@@ -52,6 +55,32 @@ ManagedCodeCache::~ManagedCodeCache()
         _workerQueueEvent.Set();
         _worker.join();
     }
+
+    delete _snapshot.load();
+}
+
+ManagedCodeCache::ReadSection::ReadSection(const ManagedCodeCache& cache) noexcept
+    : _cache(cache)
+{
+    // Register as a reader of the current epoch. If a writer bumped the epoch in between,
+    // it may already be waiting for the counter we just incremented to drain: step back and retry.
+    while (true)
+    {
+        _epoch = _cache._epoch.load();
+        _cache._activeReaders[_epoch & 1].fetch_add(1);
+        if (_cache._epoch.load() == _epoch)
+        {
+            break;
+        }
+        _cache._activeReaders[_epoch & 1].fetch_sub(1);
+    }
+
+    _snapshot = _cache._snapshot.load();
+}
+
+ManagedCodeCache::ReadSection::~ReadSection()
+{
+    _cache._activeReaders[_epoch & 1].fetch_sub(1);
 }
 
 bool ManagedCodeCache::Initialize()
@@ -68,38 +97,22 @@ bool ManagedCodeCache::Initialize()
     return false;
 }
 
-std::optional<bool> ManagedCodeCache::IsCodeInR2RModule(std::uintptr_t ip, bool signalSafe) const noexcept
+bool ManagedCodeCache::IsCodeInR2RModule(Snapshot const& snapshot, std::uintptr_t ip) noexcept
 {
-    // IsCodeInR2RModule can be called in a signal handler or not.
-    // If it's called in a signal handler, we need to use a shared lock with try_to_lock.
-    // If it's called not in a signal handler, we need to use a shared lock with defer_lock.
-    auto moduleLock = [](std::shared_mutex& mutex, bool signalSafe) {
-        if (signalSafe)
-        {
-            return std::shared_lock<std::shared_mutex>(mutex, std::try_to_lock);
-        }
-        return std::shared_lock<std::shared_mutex>(mutex);
-    }(_modulesMutex, signalSafe);
-
-    if (!moduleLock.owns_lock())
-    {
-        return std::nullopt;
-    }
-
-    auto moduleCodeRange = FindRange(_modulesCodeRanges, ip);
+    auto moduleCodeRange = FindRange(snapshot.modules, ip);
     if (!moduleCodeRange.has_value())
     {
-        return {false};
+        return false;
     }
 
     if (moduleCodeRange->isRemoved)
     {
         // No print, can be called in a signal handler
         // LogOnce(Debug, "ManagedCodeCache::IsCodeInR2RModule: Module code range was removed for ip: 0x", std::hex, ip);
-        return {false};
+        return false;
     }
 
-    return {moduleCodeRange->contains(ip)};
+    return moduleCodeRange->contains(ip);
 }
 
 // must not be called in a signal handler (GetFunctionFromIP is not signal-safe)
@@ -113,13 +126,13 @@ std::optional<FunctionID> ManagedCodeCache::GetFunctionId(std::uintptr_t ip) noe
     }
 
     // Level 2: Check if the IP is within a module code range
-    
-    auto isR2r = IsCodeInR2RModule(ip, false);
-    // GetFunctionId is NOT signal-safe: we pass signalSafe=false, so
-    // IsCodeInR2RModule takes the shared lock unconditionally and always
-    // returns an engaged optional. The !has_value() guard below is defence
-    // in depth in case IsCodeInR2RModule ever grows a new failure path.
-    if (!isR2r.has_value() || !isR2r.value())
+    bool isR2r;
+    {
+        ReadSection section(*this);
+        isR2r = IsCodeInR2RModule(section.Get(), ip);
+    }
+
+    if (!isR2r)
     {
         // if it has value `false`, just return InvalidFunctionId
         return std::optional<FunctionID>(InvalidFunctionId);
@@ -178,79 +191,52 @@ std::optional<FunctionID> ManagedCodeCache::GetFunctionFromIP_Original(std::uint
     return std::optional<FunctionID>(InvalidFunctionId);
 }
 
-std::optional<FunctionID> ManagedCodeCache::GetFunctionIdImpl(std::uintptr_t ip) const noexcept
+std::optional<FunctionID> ManagedCodeCache::FindFunctionId(Snapshot const& snapshot, std::uintptr_t ip) noexcept
 {
     uint64_t page = GetPageNumber(static_cast<UINT_PTR>(ip));
-    
-    // Level 1: Find the page (shared lock on map structure)
-    std::shared_lock<std::shared_mutex> mapLock(_pagesMutex);
-    auto pageIt = _pagesMap.find(page);
-    if (pageIt == _pagesMap.end())
+
+    // Level 1: Find the page
+    auto pageIt = std::lower_bound(snapshot.pages.begin(), snapshot.pages.end(), page,
+        [](std::shared_ptr<PageEntry> const& entry, uint64_t page) {
+            return entry->page < page;
+        });
+    if (pageIt == snapshot.pages.end() || (*pageIt)->page != page)
     {
         return std::nullopt;  // No code on this page
     }
-    
-    // Level 2: Binary search within the page's ranges (shared lock on page)
-    std::shared_lock<std::shared_mutex> pageLock(pageIt->second.lock);
-    auto range = FindRange(pageIt->second.ranges, static_cast<UINT_PTR>(ip));
+
+    // Level 2: Binary search within the page's ranges
+    auto range = FindRange((*pageIt)->ranges, static_cast<UINT_PTR>(ip));
     if (range.has_value())
     {
         return range->functionId;
     }
-    
+
     return std::nullopt;
 }
 
-// can be called in a signal handler
-std::optional<bool> ManagedCodeCache::IsManaged(std::uintptr_t ip) const noexcept
+std::optional<FunctionID> ManagedCodeCache::GetFunctionIdImpl(std::uintptr_t ip) const noexcept
 {
-    // This is temporary workaround to try at best identifying an instruction pointer.
-    // Once ManagedCodeCache has a better concurrent data structure, we can remove this function.
-    // Best effort to get the managed code address range
-    // If IsManaged returns nullopt (which means that we failed at acquiring the lock),
-    // we try MaxRetries times.
-    auto constexpr MaxRetries = 5;
-    for (auto i = 0; i < MaxRetries; i++)
-    {
-        auto result = IsManagedImpl(ip);
-        if (result.has_value())
-        {
-            return result;
-        }
-    }
-    return std::nullopt;
+    ReadSection section(*this);
+    return FindFunctionId(section.Get(), ip);
 }
 
-std::optional<bool> ManagedCodeCache::IsManagedImpl(std::uintptr_t ip) const noexcept
+// can be called in a signal handler
+std::optional<bool> ManagedCodeCache::IsManaged(std::uintptr_t ip) const noexcept
 {
-    uint64_t page = GetPageNumber(static_cast<UINT_PTR>(ip));
-    
+    // The published snapshot is never modified and is kept alive until we leave the
+    // read section: no lock is needed, so we always get an answer (even while the
+    // worker thread is publishing a new snapshot).
+    ReadSection section(*this);
+    auto const& snapshot = section.Get();
+
+    if (FindFunctionId(snapshot, ip).has_value())
     {
-        // Level 1: Find the page (shared lock on map structure)
-        std::shared_lock<std::shared_mutex> mapLock(_pagesMutex, std::try_to_lock);
-        if (!mapLock.owns_lock())
-        {
-            return std::nullopt;
-        }
-        auto pageIt = _pagesMap.find(page);
-        if (pageIt != _pagesMap.end())
-        {
-            // Level 2: Binary search within the page's ranges (shared lock on page)
-            std::shared_lock<std::shared_mutex> pageLock(pageIt->second.lock, std::try_to_lock);
-            if (!pageLock.owns_lock())
-            {
-                return std::nullopt;
-            }
-            auto range = FindRange(pageIt->second.ranges, static_cast<UINT_PTR>(ip));
-            if (range.has_value())
-            {
-                return std::optional{true};
-            }
-        }
+        return std::optional{true};
     }
 
     // Page not found or IP not in any JIT-compiled range: check R2R modules
-    return IsCodeInR2RModule(ip, true);
+    return std::optional{IsCodeInR2RModule(snapshot, ip)};
 }
 
 void ManagedCodeCache::AddFunction(FunctionID functionId)
@@ -272,16 +258,11 @@ void ManagedCodeCache::AddFunctionImpl(FunctionID functionId, bool isAsync)
     {
         // IMPORTANT: Defer to background thread to avoid deadlock
         //
-        // Why we can't do this synchronously:
-        // 1. JITCompilationFinished is called on a managed thread (Thread A)
-        // 2. If we called AppendRangesToCache directly here, Thread A would acquire 
-        //    writer lock on PageEntry
-        // 3. CPU profiler signal could interrupt Thread A (async)
-        // 4. Signal handler calls IsManaged, tries to acquire reader lock on same PageEntry
-        // 5. DEADLOCK: Reader lock waits for writer lock held by same thread
-        //
-        // Solution: Enqueue work to background thread. Thread A never acquires PageEntry 
-        // locks, so signal handler can safely acquire locks without deadlock.
+        // Readers never block on writers, but publishing a snapshot copies the page
+        // index and waits for the readers of the previous snapshot to leave:
+        // this cost must not be paid by the managed thread in the JITCompilationFinished
+        // callback. The worker thread also batches the pending work items into a single
+        // snapshot update.
         AddFunctionCodeRangesAsync(std::move(ranges));
     }
     else
@@ -311,20 +292,8 @@ void ManagedCodeCache::AddModule(ModuleID moduleId)
         Log::Debug("ManagedCodeCache::AddModule: Module code ranges for module id: ", moduleId, " are: ", ss.str());
     }
 
-    // IMPORTANT: Defer to background thread to avoid deadlock
-    //
-    // Scenario: ModuleLoadFinished is called on a managed thread (Thread A)
-    // 1. Thread A calls AddModuleRanges, acquires writer lock if done synchronously
-    // 2. CPU profiler signal interrupts Thread A (async)
-    // 3. Signal handler calls IsManaged, tries to acquire reader lock
-    // 4. DEADLOCK: Reader lock waits for writer lock held by same thread
-    //
-    // Solution: Enqueue work to background thread. Thread A holds no locks
-    // when it returns from this callback, so signal handler can safely
-    // acquire locks.
-    //
-    // Additional benefit: Reduces callback latency and avoids holding
-    // CLR-internal locks longer than necessary.
+    // Defer to background thread: it reduces callback latency and avoids holding
+    // CLR-internal locks while a new snapshot is built and published.
     AddModuleCodeRangesAsync(std::move(moduleCodeRanges));
 }
 
@@ -336,18 +305,20 @@ void ManagedCodeCache::RemoveModule(ModuleID moduleId)
         return;
     }
 
-    std::unique_lock<std::shared_mutex> moduleLock(_modulesMutex);
+    std::unique_lock<std::mutex> writersLock(_writersMutex);
+    auto snapshot = CloneCurrentSnapshot();
     for (auto const& range : moduleCodeRanges)
     {
-        auto it = std::find_if(_modulesCodeRanges.begin(), _modulesCodeRanges.end(),
+        auto it = std::find_if(snapshot->modules.begin(), snapshot->modules.end(),
          [&range](const ModuleCodeRange& r) {
             return r.startAddress == range.startAddress && r.endAddress == range.endAddress;
         });
-        if (it != _modulesCodeRanges.end())
+        if (it != snapshot->modules.end())
         {
             it->isRemoved = true;
         }
     }
+    PublishSnapshot(std::move(snapshot));
 }
 
 std::vector<CodeRange> ManagedCodeCache::GetCodeRanges(FunctionID functionId)
@@ -383,16 +354,29 @@ std::vector<CodeRange> ManagedCodeCache::GetCodeRanges(FunctionID functionId)
     return result;
 }
 
-void ManagedCodeCache::InsertCodeRangeIntoPage(PagesMap::iterator pageIt,
-    const CodeRange& range)
+std::unique_ptr<ManagedCodeCache::Snapshot> ManagedCodeCache::CloneCurrentSnapshot() const
 {
-    std::unique_lock<std::shared_mutex> pageLock(pageIt->second.lock);
-    auto& ranges = pageIt->second.ranges;
-    ranges.insert(std::upper_bound(ranges.begin(), ranges.end(), range), range);
+    // Only writers replace the snapshot and they are serialized by _writersMutex:
+    // the current snapshot cannot be freed while we copy it.
+    return std::make_unique<Snapshot>(*_snapshot.load());
 }
 
-// This function must be called by the worker thread only
-void ManagedCodeCache::AddFunctionRangesToCache(std::vector<CodeRange> newRanges)
+void ManagedCodeCache::PublishSnapshot(std::unique_ptr<Snapshot> snapshot)
+{
+    auto* oldSnapshot = _snapshot.exchange(snapshot.release());
+
+    // Readers that started after the exchange see the new snapshot. Move them to the
+    // other epoch counter and wait for the ones that may still look at the old snapshot.
+    auto epoch = _epoch.fetch_add(1);
+    while (_activeReaders[epoch & 1].load() != 0)
+    {
+        std::this_thread::yield();
+    }
+
+    delete oldSnapshot;
+}
+
+void ManagedCodeCache::AddFunctionRangesToSnapshot(Snapshot& snapshot, std::vector<CodeRange> const& newRanges)
 {
     for (const auto& range : newRanges)
     {
@@ -401,62 +385,59 @@ void ManagedCodeCache::AddFunctionRangesToCache(std::vector<CodeRange> newRanges
         uint64_t startPage = GetPageNumber(range.startAddress);
         uint64_t endPage = GetPageNumber(range.endAddress);
         for (uint64_t page = startPage; page <= endPage; ++page)
-        {  
-            // Check if page exists (with shared lock first - fast path)
+        {
+            auto pageIt = std::lower_bound(snapshot.pages.begin(), snapshot.pages.end(), page,
+                [](std::shared_ptr<PageEntry> const& entry, uint64_t page) {
+                    return entry->page < page;
+                });
+
+            if (pageIt == snapshot.pages.end() || (*pageIt)->page != page)
             {
-                std::shared_lock<std::shared_mutex> mapLock(_pagesMutex);
-                auto pageIt = _pagesMap.find(page);
-                if (pageIt != _pagesMap.end())
-                {
-                    InsertCodeRangeIntoPage(pageIt, range);
-                    continue;
-                }
+                pageIt = snapshot.pages.insert(pageIt, std::make_shared<PageEntry>(PageEntry{page, {}}));
             }
-            
-            // Page doesn't exist, create it (with exclusive lock)
-            std::unique_lock<std::shared_mutex> mapLock(_pagesMutex);
-            
-            auto [pageIt, _] = _pagesMap.try_emplace(page);
-            InsertCodeRangeIntoPage(pageIt, range);
+            else if (pageIt->use_count() > 1)
+            {
+                // The page is shared with the published snapshot: copy it before modifying it
+                *pageIt = std::make_shared<PageEntry>(**pageIt);
+            }
+
+            auto& ranges = (*pageIt)->ranges;
+            ranges.insert(std::upper_bound(ranges.begin(), ranges.end(), range), range);
         }
     }
 }
 
-void ManagedCodeCache::AddModuleRangesToCache(std::vector<ModuleCodeRange> moduleCodeRanges)
+// This function must be called by the worker thread or by a native thread that is not
+// interrupted by the profiler
+void ManagedCodeCache::AddFunctionRangesToCache(std::vector<CodeRange> newRanges)
+{
+    std::unique_lock<std::mutex> writersLock(_writersMutex);
+    auto snapshot = CloneCurrentSnapshot();
+    AddFunctionRangesToSnapshot(*snapshot, newRanges);
+    PublishSnapshot(std::move(snapshot));
+}
+
+void ManagedCodeCache::AddModuleRangesToSnapshot(Snapshot& snapshot, std::vector<ModuleCodeRange> const& moduleCodeRanges)
 {
-    std::unique_lock<std::shared_mutex> moduleLock(_modulesMutex);
     for (const auto& moduleCodeRange : moduleCodeRanges)
     {
         auto insertPos = std::upper_bound(
-            _modulesCodeRanges.begin(),
-            _modulesCodeRanges.end(),
+            snapshot.modules.begin(),
+            snapshot.modules.end(),
             moduleCodeRange,
             [](const ModuleCodeRange& range, const ModuleCodeRange& other) {
                 return range.startAddress < other.startAddress;
             });
-        _modulesCodeRanges.insert(insertPos, moduleCodeRange);
+        snapshot.modules.insert(insertPos, moduleCodeRange);
     }
 }
 
-void ManagedCodeCache::EnsurePageExists(uint64_t page)
+void ManagedCodeCache::AddModuleRangesToCache(std::vector<ModuleCodeRange> moduleCodeRanges)
 {
-    // Check if page exists (with shared lock first - fast path)
-    {
-        std::shared_lock<std::shared_mutex> mapLock(_pagesMutex);
-        if (_pagesMap.find(page) != _pagesMap.end())
-        {
-            return;  // Already exists
-        }
-    }
-    
-    // Page doesn't exist, create it (with exclusive lock)
-    std::unique_lock<std::shared_mutex> mapLock(_pagesMutex);
-    
-    // Double-check after acquiring exclusive lock (another thread might have created it)
-    if (_pagesMap.find(page) == _pagesMap.end())
-    {
-        _pagesMap[page] = PageEntry();
-    }
+    std::unique_lock<std::mutex> writersLock(_writersMutex);
+    auto snapshot = CloneCurrentSnapshot();
+    AddModuleRangesToSnapshot(*snapshot, moduleCodeRanges);
+    PublishSnapshot(std::move(snapshot));
 }
 
 // Template struct for appending ranges work items
@@ -486,16 +467,25 @@ void ManagedCodeCache::WorkerThread(std::promise<void> startPromise)
             break;
         }
 
-        std::deque<std::function<void()>> workItems;
+        std::deque<std::function<void(Snapshot&)>> workItems;
         {
             std::unique_lock<std::mutex> lock(_queueMutex);
             std::swap(_workerQueue, workItems);
         }
 
+        if (workItems.empty())
+        {
+            continue;
+        }
+
+        // Apply all pending work items to a single copy and publish it once
+        std::unique_lock<std::mutex> writersLock(_writersMutex);
+        auto snapshot = CloneCurrentSnapshot();
         for (auto& workItem : workItems)
         {
-            workItem();
+            workItem(*snapshot);
         }
+        PublishSnapshot(std::move(snapshot));
     }
 }
 
@@ -503,14 +493,14 @@ void ManagedCodeCache::WorkerThread(std::promise<void> startPromise)
 template<typename WorkType>
 void ManagedCodeCache::EnqueueWork(WorkType work)
 {
-    auto workFunction = [this, work = std::move(work)]() mutable{
+    auto workFunction = [work = std::move(work)](Snapshot& snapshot) mutable{
         using T = std::decay_t<WorkType>;
         
         if constexpr (std::is_same_v<T, AppendCodeRangesWork>) {
-            AddFunctionRangesToCache(std::move(work.ranges));
+            AddFunctionRangesToSnapshot(snapshot, work.ranges);
         }
         else if constexpr (std::is_same_v<T, AppendModuleRangesWork>) {
-            AddModuleRangesToCache(std::move(work.ranges));
+            AddModuleRangesToSnapshot(snapshot, work.ranges);
         }
     };
 
@@ -11,8 +11,8 @@
 #include <vector>
 #include <unordered_map>
 #include <unordered_set>
+#include <memory>
 #include <optional>
-#include <shared_mutex>
 #include <thread>
 #include <mutex>
 #include <set>
@@ -96,28 +96,21 @@ public:
     bool Initialize();
 
 private:
-    // Each page has its own data + lock for fine-grained concurrency
+    // Code ranges of a 64KB page of the address space, sorted by startAddress
     struct PageEntry {
-        std::vector<CodeRange> ranges;  // Sorted by startAddress
-        mutable std::shared_mutex lock;  // Reader-writer lock
-        
-        PageEntry() = default;
-        
-        // Needed for map operations (can't copy mutex)
-        PageEntry(PageEntry&& other) noexcept 
-            : ranges(std::move(other.ranges)) {}
-        
-        PageEntry& operator=(PageEntry&& other) noexcept {
-            ranges = std::move(other.ranges);
-            return *this;
-        }
-        
-        // Delete copy operations
-        PageEntry(const PageEntry&) = delete;
-        PageEntry& operator=(const PageEntry&) = delete;
+        uint64_t page;
+        std::vector<CodeRange> ranges;
+    };
+
+    // Immutable view of the cache.
+    // Writers never modify a published snapshot: they copy the current one, apply their changes
+    // and publish the copy. Pages that are not touched are shared between consecutive snapshots.
+    // Readers (including signal handlers) only follow raw pointers: no lock, no allocation and
+    // no reference counting.
+    struct Snapshot {
+        std::vector<std::shared_ptr<PageEntry>> pages;  // Sorted by page number
+        std::vector<ModuleCodeRange> modules;           // Sorted by startAddress
     };
-        
-    using PagesMap = std::unordered_map<uint64_t, PageEntry>;
 
     // Partition address space into 64KB pages for faster lookup
     static constexpr size_t PAGE_SHIFT = 16;  // 64KB pages (size = 1ULL << 16 = 65536)
@@ -126,7 +119,25 @@ private:
     static uint64_t GetPageNumber(UINT_PTR address) {
         return address >> PAGE_SHIFT;
     }
-    
+
+    // Epoch-based read-side critical section around the access to the published snapshot.
+    // The snapshot returned by Get() stays alive until the section is left.
+    class ReadSection {
+    public:
+        explicit ReadSection(const ManagedCodeCache& cache) noexcept;
+        ~ReadSection();
+
+        ReadSection(const ReadSection&) = delete;
+        ReadSection& operator=(const ReadSection&) = delete;
+
+        const Snapshot& Get() const noexcept { return *_snapshot; }
+
+    private:
+        const ManagedCodeCache& _cache;
+        uint64_t _epoch;
+        const Snapshot* _snapshot;
+    };
+
     // Query the runtime for code ranges for a specific version
     // This is called when a new tier is compiled
     std::vector<CodeRange> GetCodeRanges(FunctionID functionId);
@@ -134,6 +145,8 @@ private:
     // Append new ranges to the cache (accumulative - never removes old ranges)
     // This preserves old tier code that might still be on the stack
     void AddFunctionRangesToCache(std::vector<CodeRange> newRanges);
+    static void AddFunctionRangesToSnapshot(Snapshot& snapshot, std::vector<CodeRange> const& newRanges);
+    static void AddModuleRangesToSnapshot(Snapshot& snapshot, std::vector<ModuleCodeRange> const& moduleCodeRanges);
 
 // Expose the helpers below to tests without duplicating the declarations.
 #ifdef DD_TEST
@@ -141,52 +154,52 @@ public:
 #endif
     void AddModuleRangesToCache(std::vector<ModuleCodeRange> moduleCodeRanges);
 #ifdef DD_TEST
-    // Test-only hooks to simulate signal-handler contention. IsManaged uses
-    // try_to_lock semantics on these two mutexes and returns std::nullopt when
-    // ownership cannot be acquired. Holding an exclusive lock on either mutex
-    // from another thread deterministically reproduces that "contended" state.
-    std::unique_lock<std::shared_mutex> LockPagesMutexExclusiveForTest()
+    // Test-only hook to simulate a writer in the middle of a snapshot update:
+    // holding this lock from another thread blocks every writer but must not
+    // affect IsManaged or GetFunctionId.
+    std::unique_lock<std::mutex> LockWritersForTest()
     {
-        return std::unique_lock<std::shared_mutex>(_pagesMutex);
-    }
-    std::unique_lock<std::shared_mutex> LockModulesMutexExclusiveForTest()
-    {
-        return std::unique_lock<std::shared_mutex>(_modulesMutex);
+        return std::unique_lock<std::mutex>(_writersMutex);
     }
 private:
 #endif
     void AddModuleCodeRangesAsync(std::vector<ModuleCodeRange> moduleCodeRanges);
     void AddFunctionCodeRangesAsync(std::vector<CodeRange> ranges);
     std::vector<ModuleCodeRange> GetModuleCodeRanges(ModuleID moduleId);
-    void InsertCodeRangeIntoPage(PagesMap::iterator pageIt, const CodeRange& range);
 
     void WorkerThread(std::promise<void> startPromise);
-    
-    // Helper: Ensure a page exists in the map
-    void EnsurePageExists(uint64_t page);
-    std::optional<bool> IsManagedImpl(std::uintptr_t ip) const noexcept;
-
-    // Map from page number -> page entry (with its own lock)
-    PagesMap _pagesMap;
-    std::vector<ModuleCodeRange> _modulesCodeRanges;
-    mutable std::shared_mutex _modulesMutex;
-    
-    // Coarse lock ONLY for modifying the map structure itself
-    // (adding/removing pages, not modifying page contents)
-    mutable std::shared_mutex _pagesMutex;
+
+    // Must be called with _writersMutex held
+    void PublishSnapshot(std::unique_ptr<Snapshot> snapshot);
+    std::unique_ptr<Snapshot> CloneCurrentSnapshot() const;
+
+    static std::optional<FunctionID> FindFunctionId(Snapshot const& snapshot, std::uintptr_t ip) noexcept;
+    static bool IsCodeInR2RModule(Snapshot const& snapshot, std::uintptr_t ip) noexcept;
+
+    // Currently published snapshot
+    std::atomic<Snapshot*> _snapshot;
+
+    // Epoch-based reclamation: readers register in the counter matching the parity of
+    // the epoch they observed. After publishing, a writer bumps the epoch and waits for
+    // the readers of the previous parity to leave before freeing the old snapshot.
+    std::atomic<uint64_t> _epoch;
+    mutable std::atomic<uint32_t> _activeReaders[2];
+
+    // Serializes the writers (worker thread, synchronous adds and module removal).
+    // Never taken by readers.
+    std::mutex _writersMutex;
     
     // Profiler interface (ICorProfilerInfo4 is available in .NET Framework 4.5+)
     ICorProfilerInfo4* _profilerInfo;
     std::thread _worker;
     std::atomic<bool> _requestStop;
     
-    std::deque<std::function<void()>> _workerQueue;
+    std::deque<std::function<void(Snapshot&)>> _workerQueue;
     std::mutex _queueMutex;
 
     template<typename WorkType>
     void EnqueueWork(WorkType work);
     std::optional<FunctionID> GetFunctionIdImpl(std::uintptr_t ip) const noexcept;
-    std::optional<bool> IsCodeInR2RModule(std::uintptr_t ip, bool signalSafe) const noexcept;
     std::optional<FunctionID> GetFunctionFromIP_Original(std::uintptr_t ip) noexcept;
     void AddFunctionImpl(FunctionID functionId, bool isAsync);
     
@@ -20,6 +20,7 @@
 
 #ifdef LINUX
 #include "SpinningMutex.hpp"
+#include "ThreadStatFile.h"
 using dd_mutex_t = SpinningMutex;
 #else
 using dd_mutex_t = std::mutex;
@@ -104,6 +105,7 @@ public:
     inline bool CanBeInterrupted() const;
     inline void SetStackBounds(std::uintptr_t stackBase, std::uintptr_t stackEnd);
     inline std::pair<std::uintptr_t, std::uintptr_t> GetStackBounds() const;
+    inline ThreadStatFile& GetStatFile();
 #endif
 
 #ifdef DD_TEST
@@ -174,6 +176,8 @@ private:
     std::int32_t _timerId;
     std::uintptr_t _stackBase = 0;
     std::uintptr_t _stackEnd = 0;
+    // only used by the sampling thread to get the state of the thread
+    ThreadStatFile _statFile;
 #endif
     uint64_t _blockingThreadId;
     shared::WSTRING _blockingThreadName;
@@ -445,6 +449,11 @@ inline std::pair<std::uintptr_t, std::uintptr_t> ManagedThreadInfo::GetStackBoun
 {
     return {_stackBase, _stackEnd};
 }
+
+inline ThreadStatFile& ManagedThreadInfo::GetStatFile()
+{
+    return _statFile;
+}
 #endif
 
 inline AppDomainID ManagedThreadInfo::GetAppDomainId()
@@ -39,6 +39,7 @@ const std::string MetadataProvider::HeapSnapshotInterval("DD_INTERNAL_PROFILING_
 const std::string MetadataProvider::HeapSnapshotCheckInterval("DD_INTERNAL_PROFILING_HEAPSNAPSHOT_CHECK_INTERVAL");
 const std::string MetadataProvider::HeapSnapshotMemoryPressureThreshold("DD_INTERNAL_PROFILING_HEAPSNAPSHOT_MEMORY_PRESSURE_THRESHOLD");
 const std::string MetadataProvider::HeapSnapshotSkipTraversal("DD_INTERNAL_PROFILING_HEAPSNAPSHOT_SKIP_TRAVERSAL");
+const std::string MetadataProvider::HeapSnapshotTraversalWorkers("DD_INTERNAL_PROFILING_HEAPSNAPSHOT_TRAVERSAL_WORKERS");
 const std::string MetadataProvider::ForceHttpSampling("DD_INTERNAL_PROFILING_FORCE_HTTP_SAMPLING");
 
 const std::string MetadataProvider::SectionOverrides("Environment Overrides");
@@ -98,6 +99,7 @@ void MetadataProvider::Initialize()
     AddEnvVar(SectionEnvVars, HeapSnapshotCheckInterval, EnvironmentVariables::HeapSnapshotCheckInterval);
     AddEnvVar(SectionEnvVars, HeapSnapshotMemoryPressureThreshold, EnvironmentVariables::HeapSnapshotMemoryPressureThreshold);
     AddEnvVar(SectionEnvVars, HeapSnapshotSkipTraversal, EnvironmentVariables::HeapSnapshotSkipTraversal);
+    AddEnvVar(SectionEnvVars, HeapSnapshotTraversalWorkers, EnvironmentVariables::HeapSnapshotTraversalWorkers);
     AddEnvVar(SectionEnvVars, ForceHttpSampling, EnvironmentVariables::ForceHttpSampling);
 
     AddEnvVar(SectionOverrides, ProfilerEnabled, EnvironmentVariables::ProfilerEnabled);
@@ -40,6 +40,7 @@ public:
         static const std::string HeapSnapshotCheckInterval;
         static const std::string HeapSnapshotMemoryPressureThreshold;
         static const std::string HeapSnapshotSkipTraversal;
+        static const std::string HeapSnapshotTraversalWorkers;
         static const std::string ForceHttpSampling;
 
     static const std::string SectionOverrides;
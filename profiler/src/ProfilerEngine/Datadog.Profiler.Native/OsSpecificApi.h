@@ -17,18 +17,25 @@ struct LoaderResourceMonikerIDs;
 }
 class IConfiguration;
 class IThreadInfo;
+struct ManagedThreadInfo;
 class IEtwEventsManager;
 class IAllocationsListener;
 class IContentionListener;
 class IGCSuspensionsListener;
 class CallstackProvider;
 class ManagedCodeCache;
+class IUnwinder;
 
 // Those functions must be defined in the main projects (Linux and Windows)
 // Here are forward declarations to avoid hard coupling
 namespace OsSpecificApi
 {
-    void InitializeUnwinder(ManagedCodeCache* managedCodeCache);
+    void InitializeUnwinder(ManagedCodeCache* managedCodeCache, IConfiguration const* pConfiguration);
+
+#ifdef LINUX
+    // HybridUnwinder (native frames with libunwind, then frame chain) when the managed code cache is available
+    std::unique_ptr<IUnwinder> CreateUnwinder(ManagedCodeCache* managedCodeCache, IConfiguration const* pConfiguration);
+#endif
 
     std::unique_ptr<StackFramesCollectorBase> CreateNewStackFramesCollectorInstance(
         ICorProfilerInfo4* pCorProfilerInfo,
@@ -39,7 +46,7 @@ namespace OsSpecificApi
     std::chrono::milliseconds GetThreadCpuTime(IThreadInfo* pThreadInfo);
 
     //    isRunning,        cpu time          , failed 
-    std::tuple<bool, std::chrono::milliseconds, bool> IsRunning(IThreadInfo* pThreadInfo);
+    std::tuple<bool, std::chrono::milliseconds, bool> IsRunning(ManagedThreadInfo* pThreadInfo);
 
     int32_t GetProcessorCount();
 
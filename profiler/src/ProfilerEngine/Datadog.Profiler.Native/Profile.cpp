@@ -3,6 +3,7 @@
 
 #include "Profile.h"
 
+#include "EncodedProfile.hpp"
 #include "FfiHelper.h"
 #include "IConfiguration.h"
 #include "Log.h"
@@ -16,11 +17,11 @@ namespace libdatadog {
 
 using namespace std::chrono_literals;
 
-libdatadog::profile_unique_ptr CreateProfile(std::vector<SampleValueType> const& valueTypes, std::string const& periodType, std::string const& periodUnit);
+libdatadog::profile_unique_ptr CreateProfile(std::vector<SampleValueType> const& valueTypes, std::string const& periodType, std::string const& periodUnit, bool useStringStorage);
 
 std::unique_ptr<Profile> Profile::Create(IConfiguration* configuration, std::vector<SampleValueType> const& valueTypes, std::string const& periodType, std::string const& periodUnit, std::string applicationName)
 {
-    auto impl = CreateProfile(valueTypes, periodType, periodUnit);
+    auto impl = CreateProfile(valueTypes, periodType, periodUnit, configuration->IsFrameInterningEnabled());
     if (impl == nullptr)
     {
         return nullptr;
@@ -37,12 +38,33 @@ Profile::Profile(profile_unique_ptr impl, std::string applicationName, bool addT
 
 Profile::~Profile() = default;
 
+std::optional<ddog_prof_ManagedStringId> ProfileImpl::Intern(std::string_view str)
+{
+    auto it = _internedStrings.find(str);
+    if (it != _internedStrings.end())
+    {
+        return it->second;
+    }
+
+    auto res = ddog_prof_ManagedStringStorage_intern(_stringStorage, to_char_slice(str));
+    if (res.tag == DDOG_PROF_MANAGED_STRING_STORAGE_INTERN_RESULT_ERR)
+    {
+        auto error = libdatadog::make_error(res.err);
+        LogOnce(Info, "Unable to intern string '", str, "': ", error.message());
+        return std::nullopt;
+    }
+
+    _internedStrings.emplace(_internedStringsStorage.Allocate(str), res.ok);
+    return res.ok;
+}
+
 libdatadog::Success Profile::Add(std::shared_ptr<Sample> const& sample)
 {
     auto const& callstack = sample->GetCallstack();
     auto nbFrames = callstack.size();
 
-    auto& [locations, locationsSize, profile] = *_impl;
+    auto& impl = *_impl;
+    auto& [locations, locationsSize, profile] = impl;
 
     if (nbFrames > locationsSize)
     {
@@ -50,24 +72,6 @@ libdatadog::Success Profile::Add(std::shared_ptr<Sample> const& sample)
         locations.resize(locationsSize);
     }
 
-    std::size_t idx = 0UL;
-    for (auto const& frame : callstack)
-    {
-        auto& location = locations[idx];
-
-        location.mapping = {};
-        location.mapping.filename = to_char_slice(frame.ModuleName);
-        location.function.filename = to_char_slice(frame.Filename);
-        location.line = frame.StartLine; // For now we only have the start line of the function.
-        location.function.name = to_char_slice(frame.Frame);
-        location.address = 0; // TODO check if we can get that information in the provider
-
-        ++idx;
-    }
-
-    auto ffiSample = ddog_prof_Sample{};
-    ffiSample.locations = {locations.data(), nbFrames};
-
     // Labels
     // PERF: since adding to a profile is done by only one thread (SamplesCollector worker thread),
     // we can reuse the same ffi labels vector for all samples.
@@ -80,29 +84,79 @@ libdatadog::Success Profile::Add(std::shared_ptr<Sample> const& sample)
         ffiLabels.clear();
     };
 
-    auto labelsVisitor = LabelsVisitor{
-        [](NumericLabel const& l) -> ddog_prof_Label {
-            auto const& [name, value] = l;
-            return ddog_prof_Label {
-                .key = {name.data(), name.size()},
-                .num = value
-            };
-        },
-        [](StringLabel const& l) -> ddog_prof_Label {
-            auto const& [name, value] = l;
-            return ddog_prof_Label {
-                .key = {name.data(), name.size()},
-                .str = {value.data(), value.size()}
+    // When the profile has a string storage, the strings of the sample (frames and labels) are interned
+    // once per profile and libdatadog only gets their ids: it does not need to hash the same strings
+    // again for each sample.
+    // libdatadog reads the ids only if the labels keys are ids: a sample is either all ids or all slices.
+    auto setString = [&impl](bool useIds, std::string_view str, ddog_CharSlice& slice, ddog_prof_ManagedStringId& id) {
+        if (!useIds)
+        {
+            slice = to_char_slice(str);
+            return true;
+        }
+
+        auto internedId = impl.Intern(str);
+        if (!internedId.has_value())
+        {
+            return false;
+        }
+        id = internedId.value();
+        return true;
+    };
+
+    auto fillSample = [&](bool useIds) {
+        std::size_t idx = 0UL;
+        for (auto const& frame : callstack)
+        {
+            auto& location = locations[idx];
+
+            location = {};
+            location.line = frame.StartLine; // For now we only have the start line of the function.
+            location.address = 0;            // TODO check if we can get that information in the provider
+            if (!setString(useIds, frame.ModuleName, location.mapping.filename, location.mapping.filename_id) ||
+                !setString(useIds, frame.Filename, location.function.filename, location.function.filename_id) ||
+                !setString(useIds, frame.Frame, location.function.name, location.function.name_id))
+            {
+                return false;
+            }
+
+            ++idx;
+        }
+
+        ffiLabels.clear();
+        for (auto const& label : labels)
+        {
+            auto& ffiLabel = ffiLabels.emplace_back();
+            auto labelsVisitor = LabelsVisitor{
+                [&](NumericLabel const& l) {
+                    auto const& [name, value] = l;
+                    ffiLabel.num = value;
+                    return setString(useIds, name, ffiLabel.key, ffiLabel.key_id);
+                },
+                [&](StringLabel const& l) {
+                    auto const& [name, value] = l;
+                    return setString(useIds, name, ffiLabel.key, ffiLabel.key_id) &&
+                           setString(useIds, value, ffiLabel.str, ffiLabel.str_id);
+                }
             };
+
+            if (!std::visit(labelsVisitor, label))
+            {
+                return false;
+            }
         }
+
+        return true;
     };
 
-    for (auto const& label : labels)
+    if (!fillSample(impl.HasStringStorage()))
     {
-        auto ffiLabel = std::visit(labelsVisitor, label);
-        ffiLabels.push_back(ffiLabel);
+        // a string could not be interned: send the whole sample as slices
+        fillSample(false);
     }
 
+    auto ffiSample = ddog_prof_Sample{};
+    ffiSample.locations = {locations.data(), nbFrames};
     ffiSample.labels = {ffiLabels.data(), ffiLabels.size()};
 
     // values
@@ -196,7 +250,31 @@ libdatadog::Success Profile::AddUpscalingRulePoisson(std::vector<std::uintptr_t>
     return make_success();
 }
 
-libdatadog::profile_unique_ptr CreateProfile(std::vector<SampleValueType> const& valueTypes, std::string const& periodType, std::string const& periodUnit)
+#ifdef DD_TEST
+std::vector<std::uint8_t> Profile::SerializeForTests()
+{
+    auto s = ddog_prof_Profile_serialize(*_impl, nullptr, nullptr);
+    if (s.tag == DDOG_PROF_PROFILE_SERIALIZE_RESULT_ERR)
+    {
+        auto error = make_error(s.err);
+        Log::Error("Unable to serialize the profile: ", error.message());
+        return {};
+    }
+
+    auto ep = EncodedProfile(&s.ok);
+    auto bytes = ddog_prof_EncodedProfile_bytes(ep);
+    if (bytes.tag == DDOG_PROF_RESULT_BYTE_SLICE_ERR_BYTE_SLICE)
+    {
+        auto error = make_error(bytes.err);
+        Log::Error("Unable to get the serialized profile: ", error.message());
+        return {};
+    }
+
+    return {bytes.ok.ptr, bytes.ok.ptr + bytes.ok.len};
+}
+#endif
+
+libdatadog::profile_unique_ptr CreateProfile(std::vector<SampleValueType> const& valueTypes, std::string const& periodType, std::string const& periodUnit, bool useStringStorage)
 {
     if (valueTypes.empty())
     {
@@ -234,6 +312,31 @@ libdatadog::profile_unique_ptr CreateProfile(std::vector<SampleValueType> const&
 
     Log::Debug("Creating libdatadog profile with ", samplesTypes.size(), " sample type(s), slice ptr=", (void*)sample_types.ptr, ", len=", sample_types.len);
 
+    if (useStringStorage)
+    {
+        auto storageRes = ddog_prof_ManagedStringStorage_new();
+        if (storageRes.tag == DDOG_PROF_MANAGED_STRING_STORAGE_NEW_RESULT_ERR)
+        {
+            // not fatal: fall back to a profile without string storage
+            auto error = libdatadog::make_error(storageRes.err);
+            LogOnce(Info, "Unable to create the libdatadog string storage, frames will not be interned: ", error.message());
+        }
+        else
+        {
+            auto res = ddog_prof_Profile_with_string_storage(sample_types, &period, storageRes.ok);
+            if (res.tag == DDOG_PROF_PROFILE_NEW_RESULT_ERR)
+            {
+                ddog_prof_ManagedStringStorage_drop(storageRes.ok);
+                auto error = libdatadog::make_error(res.err);
+                Log::Error("ddog_prof_Profile_with_string_storage failed: ", error.message(),
+                           " (sample_types count=", samplesTypes.size(),
+                           ", period=", periodType, "/", periodUnit, ")");
+                return nullptr;
+            }
+            return std::make_unique<ProfileImpl>(res.ok, storageRes.ok);
+        }
+    }
+
     auto res = ddog_prof_Profile_new(sample_types, &period);
     if (res.tag == DDOG_PROF_PROFILE_NEW_RESULT_ERR)
     {
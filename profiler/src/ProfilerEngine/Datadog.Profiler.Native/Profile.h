@@ -6,6 +6,7 @@
 
 #include "Success.h"
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <system_error>
@@ -36,6 +37,11 @@ public:
     Success AddUpscalingRulePoisson(std::vector<std::uintptr_t> const& offsets, std::string_view labelName, std::string_view groupName, uintptr_t sumValueOffset, uintptr_t countValueOffset, uint64_t sampling_distance);
     std::string const& GetApplicationName() const;
 
+#ifdef DD_TEST
+    // pprof bytes (compressed) of the profile as it would be exported
+    std::vector<std::uint8_t> SerializeForTests();
+#endif
+
 private:
     std::unique_ptr<ProfileImpl> _impl;
     Profile(std::unique_ptr<ProfileImpl> impl, std::string applicationName, bool addTimestampOnSample);
@@ -3,8 +3,14 @@
 
 #pragma once
 
+#include "StringArena.h"
+
 #include <memory>
+#include <optional>
+#include <string_view>
 #include <type_traits>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 extern "C"
@@ -18,7 +24,17 @@ namespace libdatadog {
 struct ProfileImpl
 {
     ProfileImpl(ddog_prof_Profile prof) :
-        _inner(prof)
+        _inner(prof),
+        _stringStorage{},
+        _hasStringStorage{false}
+    {
+        _locations.resize(_locationsSize);
+    }
+
+    ProfileImpl(ddog_prof_Profile prof, ddog_prof_ManagedStringStorage stringStorage) :
+        _inner(prof),
+        _stringStorage(stringStorage),
+        _hasStringStorage{true}
     {
         _locations.resize(_locationsSize);
     }
@@ -26,8 +42,22 @@ struct ProfileImpl
     ~ProfileImpl()
     {
         ddog_prof_Profile_drop(&_inner);
+        if (_hasStringStorage)
+        {
+            ddog_prof_ManagedStringStorage_drop(_stringStorage);
+        }
     }
 
+    bool HasStringStorage() const
+    {
+        return _hasStringStorage;
+    }
+
+    // Return the id of the string in the storage associated to the profile.
+    // The cache is keyed by the content of the string (copied into the profile arena): the
+    // frames views and labels may point to strings that do not outlive the sample.
+    std::optional<ddog_prof_ManagedStringId> Intern(std::string_view str);
+
     operator ddog_prof_Profile*()
     {
         return &_inner;
@@ -50,6 +80,12 @@ private:
     std::size_t _locationsSize = 512;
 
     ddog_prof_Profile _inner;
+
+    ddog_prof_ManagedStringStorage _stringStorage;
+    bool _hasStringStorage;
+    // keys are owned by _internedStringsStorage (declared first to outlive the map)
+    StringArena _internedStringsStorage;
+    std::unordered_map<std::string_view, ddog_prof_ManagedStringId> _internedStrings;
 };
 
 using profile_unique_ptr = std::unique_ptr<ProfileImpl>;
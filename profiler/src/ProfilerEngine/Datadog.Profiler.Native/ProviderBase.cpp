@@ -7,10 +7,25 @@
 
 ProviderBase::ProviderBase(const char* name)
     :
-    _name {name}
+    _name {name},
+    _samplesAvailableListener {nullptr}
 {
 }
 
+void ProviderBase::SetSamplesAvailableListener(ISamplesAvailableListener* listener)
+{
+    _samplesAvailableListener.store(listener, std::memory_order_release);
+}
+
+void ProviderBase::NotifySamplesAvailable()
+{
+    auto* listener = _samplesAvailableListener.load(std::memory_order_acquire);
+    if (listener != nullptr)
+    {
+        listener->OnSamplesAvailable();
+    }
+}
+
 const char* ProviderBase::GetName()
 {
     return _name.c_str();
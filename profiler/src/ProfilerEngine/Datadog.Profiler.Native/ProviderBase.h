@@ -2,9 +2,11 @@
 // This product includes software developed at Datadog (https://www.datadoghq.com/). Copyright 2022 Datadog, Inc.
 
 #pragma once
+#include <atomic>
 #include <mutex>
 #include <list>
 
+#include "ISamplesAvailableListener.h"
 #include "ISamplesProvider.h"
 #include "Sample.h"
 
@@ -14,7 +16,17 @@ class ProviderBase : public ISamplesProvider
 public:
     ProviderBase(const char* name);
     const char* GetName() override;
+    void SetSamplesAvailableListener(ISamplesAvailableListener* listener) override;
+
+    // number of pending samples that triggers a notification to the listener
+    static constexpr std::size_t SamplesAvailableThreshold = 512;
+
+protected:
+    void NotifySamplesAvailable();
 
 protected:
     std::string _name;
+
+private:
+    std::atomic<ISamplesAvailableListener*> _samplesAvailableListener;
 };
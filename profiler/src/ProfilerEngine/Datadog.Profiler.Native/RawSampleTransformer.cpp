@@ -3,16 +3,38 @@
 
 #include "RawSampleTransformer.h"
 
+#include "CounterMetric.h"
 #include "OpSysTools.h"
 #include "IAppDomainStore.h"
 #include "IFrameStore.h"
 #include "IRuntimeIdStore.h"
+#include "MetricsRegistry.h"
+#include "ProxyMetric.h"
 
+#include <algorithm>
 #include <chrono>
 #include <string>
 #include <string_view>
 #include <utility>
 
+RawSampleTransformer::RawSampleTransformer(
+    IFrameStore* pFrameStore,
+    IAppDomainStore* pAppDomainStore,
+    IRuntimeIdStore* pRuntimeIdStore,
+    MetricsRegistry& metricsRegistry) :
+    _pFrameStore{pFrameStore},
+    _pAppDomainStore{pAppDomainStore},
+    _pRuntimeIdStore{pRuntimeIdStore},
+    _callstackCacheCreationTime{std::chrono::steady_clock::now()}
+{
+    _callstackCacheHitsMetric = metricsRegistry.GetOrRegister<CounterMetric>("dotnet_callstack_cache_hits");
+    _callstackCacheMissesMetric = metricsRegistry.GetOrRegister<CounterMetric>("dotnet_callstack_cache_misses");
+    metricsRegistry.GetOrRegister<ProxyMetric>("dotnet_callstack_cache_size", [this]() {
+        std::lock_guard<std::mutex> lock(_callstackCacheLock);
+        return static_cast<double>(_callstackCache.size());
+    });
+}
+
 std::shared_ptr<Sample> RawSampleTransformer::Transform(const RawSample& rawSample, std::vector<SampleValueTypeProvider::Offset> const& offsets)
 {
     auto sample = std::make_shared<Sample>(rawSample.Timestamp, std::string_view(), rawSample.Stack.Size());
@@ -85,13 +107,87 @@ void RawSampleTransformer::SetThreadDetails(const RawSample& rawSample, std::sha
 void RawSampleTransformer::SetStack(const RawSample& rawSample, std::shared_ptr<Sample>& sample)
 {
     // Deal with fake stack frames like for garbage collections since the Stack will be empty
+    if (rawSample.Stack.Size() == 0)
+    {
+        return;
+    }
+
+    auto hash = ComputeHash(rawSample.Stack);
+    auto frames = GetCachedCallstack(rawSample.Stack, hash);
+    if (frames != nullptr)
+    {
+        _callstackCacheHitsMetric->Incr();
+        sample->SetCallstack(std::move(frames));
+        return;
+    }
+
+    _callstackCacheMissesMetric->Incr();
+
+    auto resolvedFrames = std::make_shared<std::vector<FrameInfoView>>();
+    resolvedFrames->reserve(rawSample.Stack.Size());
     for (auto const& instructionPointer : rawSample.Stack)
     {
         auto [isResolved, frame] = _pFrameStore->GetFrame(instructionPointer);
 
         if (isResolved)
         {
-            sample->AddFrame(frame);
+            resolvedFrames->push_back(frame);
         }
     }
+
+    Sample::SharedCallstack sharedFrames = std::move(resolvedFrames);
+    sample->SetCallstack(sharedFrames);
+    AddCachedCallstack(rawSample.Stack, hash, std::move(sharedFrames));
+}
+
+std::uint64_t RawSampleTransformer::ComputeHash(const Callstack& stack)
+{
+    // FNV-1a on the instruction pointers
+    std::uint64_t hash = 14695981039346656037ULL;
+    for (auto const& instructionPointer : stack)
+    {
+        hash ^= static_cast<std::uint64_t>(instructionPointer);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+Sample::SharedCallstack RawSampleTransformer::GetCachedCallstack(const Callstack& stack, std::uint64_t hash)
+{
+    std::lock_guard<std::mutex> lock(_callstackCacheLock);
+
+    if (std::chrono::steady_clock::now() - _callstackCacheCreationTime > CallstackCacheLifetime)
+    {
+        _callstackCache.clear();
+        _callstackCacheCreationTime = std::chrono::steady_clock::now();
+        return nullptr;
+    }
+
+    auto it = _callstackCache.find(hash);
+    if (it == _callstackCache.end())
+    {
+        return nullptr;
+    }
+
+    // check for hash collision
+    auto const& ips = it->second.InstructionPointers;
+    if (!std::equal(ips.begin(), ips.end(), stack.begin(), stack.end()))
+    {
+        return nullptr;
+    }
+
+    return it->second.Frames;
+}
+
+void RawSampleTransformer::AddCachedCallstack(const Callstack& stack, std::uint64_t hash, Sample::SharedCallstack frames)
+{
+    std::lock_guard<std::mutex> lock(_callstackCacheLock);
+
+    if (_callstackCache.size() >= MaxCachedCallstacks)
+    {
+        _callstackCache.clear();
+    }
+
+    // in case of collision, the last callstack wins
+    _callstackCache.insert_or_assign(hash, CachedCallstack{std::vector<std::uintptr_t>(stack.begin(), stack.end()), std::move(frames)});
 }
\ No newline at end of file
@@ -3,16 +3,21 @@
 #pragma once
 
 
+#include <chrono>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 
 #include "RawSample.h"
 #include "Sample.h"
 
 //forward declarations
+class CounterMetric;
 class IAppDomainStore;
 class IFrameStore;
 class IRuntimeIdStore;
+class MetricsRegistry;
 
 class RawSampleTransformer
 {
@@ -20,12 +25,8 @@ public:
     RawSampleTransformer(
         IFrameStore* pFrameStore,
         IAppDomainStore* pAppDomainStore,
-        IRuntimeIdStore* pRuntimeIdStore) :
-        _pFrameStore{pFrameStore},
-        _pAppDomainStore{pAppDomainStore},
-        _pRuntimeIdStore{pRuntimeIdStore}
-    {
-    }
+        IRuntimeIdStore* pRuntimeIdStore,
+        MetricsRegistry& metricsRegistry);
 
     ~RawSampleTransformer() = default;
 
@@ -43,7 +44,31 @@ private:
     void SetThreadDetails(const RawSample& rawSample, std::shared_ptr<Sample>& sample);
     void SetStack(const RawSample& rawSample, std::shared_ptr<Sample>& sample);
 
+    Sample::SharedCallstack GetCachedCallstack(const Callstack& stack, std::uint64_t hash);
+    void AddCachedCallstack(const Callstack& stack, std::uint64_t hash, Sample::SharedCallstack frames);
+    static std::uint64_t ComputeHash(const Callstack& stack);
+
+private:
+    // Most samples share a few hundreds of callstacks: symbolize each of them once and
+    // share the resolved frames between the samples.
+    // The cache is flushed every CallstackCacheLifetime (default upload period) to give a
+    // chance to frames that failed to be resolved and to bound its memory usage.
+    static constexpr std::chrono::seconds CallstackCacheLifetime = std::chrono::seconds(60);
+    static constexpr std::size_t MaxCachedCallstacks = 4096;
+
+    struct CachedCallstack
+    {
+        std::vector<std::uintptr_t> InstructionPointers;
+        Sample::SharedCallstack Frames;
+    };
+
     IFrameStore* _pFrameStore;
     IAppDomainStore* _pAppDomainStore;
     IRuntimeIdStore* _pRuntimeIdStore;
+
+    std::mutex _callstackCacheLock;
+    std::unordered_map<std::uint64_t, CachedCallstack> _callstackCache;
+    std::chrono::steady_clock::time_point _callstackCacheCreationTime;
+    std::shared_ptr<CounterMetric> _callstackCacheHitsMetric;
+    std::shared_ptr<CounterMetric> _callstackCacheMissesMetric;
 };
\ No newline at end of file
@@ -47,10 +47,12 @@ public:
         return RawSamples(std::move(result), _memoryResource);
     }
 
-    void Add(TRawSample&& sample)
+    // returns the number of samples after the addition
+    std::size_t Add(TRawSample&& sample)
     {
         std::lock_guard<std::mutex> lock(_lock);
         _samples.Append(std::forward<TRawSample>(sample));
+        return _samples.Size();
     }
 
     auto begin()
@@ -7,8 +7,10 @@
 #include "MemoryFaultGuard.h"
 #include "OpSysTools.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <stdexcept>
+#include <system_error>
 #include <utility>
 
 ReferenceChainTraverser::ReferenceChainTraverser(
@@ -27,6 +29,265 @@ ReferenceChainTraverser::ReferenceChainTraverser(
 {
 }
 
+ReferenceChainTraverser::ReferenceChainTraverser(const ReferenceChainTraverser& coordinator, TypeReferenceTree& tree)
+    : _pCorProfilerInfo(coordinator._pCorProfilerInfo),
+      _pFrameStore(coordinator._pFrameStore),
+      _tree(tree),
+      _inlineVTCache(coordinator._inlineVTCache),
+      _visited(coordinator._visited.GetBucketCount()),
+      _objectsTraversed(0),
+      _rootsProcessed(0),
+      _selfTestObjectsChecked(MaxSelfTestObjects),
+      _isWorker(true)
+{
+}
+
+ReferenceChainTraverser::~ReferenceChainTraverser()
+{
+    StopWorkers();
+}
+
+void ReferenceChainTraverser::StartWorkers(uint32_t workerCount)
+{
+    for (uint32_t i = 0; i < workerCount; i++)
+    {
+        auto worker = std::make_unique<Worker>();
+        worker->traverser.reset(new ReferenceChainTraverser(*this, worker->tree));
+        _workers.push_back(std::move(worker));
+    }
+
+    try
+    {
+        for (auto& worker : _workers)
+        {
+            worker->thread = std::thread([this, pWorker = worker.get()] { WorkerLoop(*pWorker); });
+        }
+    }
+    catch (const std::system_error& e)
+    {
+        Log::Warn("Failed to start the reference-chain traversal workers (", e.what(), "): the roots are traversed sequentially.");
+        StopWorkers();
+        _workers.clear();
+    }
+}
+
+void ReferenceChainTraverser::StopWorkers()
+{
+    {
+        std::lock_guard lock(_workersLock);
+        _stopWorkers = true;
+    }
+    _batchAvailable.notify_all();
+
+    for (auto& worker : _workers)
+    {
+        if (worker->thread.joinable())
+        {
+            worker->thread.join();
+        }
+    }
+}
+
+void ReferenceChainTraverser::WorkerLoop(Worker& worker)
+{
+    OpSysTools::SetNativeThreadName(WStr("DD_heap_walker"));
+
+    uint64_t batchNumber = 0;
+    while (true)
+    {
+        const std::vector<RootInfo>* batch = nullptr;
+        bool isStopping = false;
+        {
+            std::unique_lock lock(_workersLock);
+            _batchAvailable.wait(lock, [this, batchNumber] { return _stopWorkers || _batchNumber != batchNumber; });
+            if (_batchNumber == batchNumber)
+            {
+                // stopped and no batch left for this worker
+                return;
+            }
+            batchNumber = _batchNumber;
+            batch = _batch;
+            isStopping = _stopWorkers;
+        }
+
+        // the roots are taken one by one: their graphs have very different sizes
+        for (auto i = _nextBatchRoot.fetch_add(1, std::memory_order_relaxed); !isStopping && i < batch->size(); i = _nextBatchRoot.fetch_add(1, std::memory_order_relaxed))
+        {
+            worker.traverser->TraverseFromSingleRoot((*batch)[i]);
+        }
+
+        // even when stopping: the coordinator waits for every worker of the batch
+        {
+            std::lock_guard lock(_workersLock);
+            _busyWorkers--;
+        }
+        _batchDone.notify_one();
+    }
+}
+
+void ReferenceChainTraverser::TraverseRoots(const std::vector<RootInfo>& roots)
+{
+    size_t current = 0;
+    for (; current < roots.size() && !CanUseWorkers(); current++)
+    {
+        ValidateRawObjectLayout(roots[current]);
+        TraverseFromSingleRoot(roots[current]);
+    }
+
+    if (current < roots.size())
+    {
+        TraverseRootsWithWorkers(roots, current);
+    }
+}
+
+void ReferenceChainTraverser::ValidateRawObjectLayout(const RootInfo& root)
+{
+    if (_workers.empty() || _rawLayout != RawLayoutState::Pending)
+    {
+        return;
+    }
+
+    // The profiling API has just read the same object, so this does not need the fault guard
+    ClassID classID = GCDesc::GetObjectClass(root.address);
+    SIZE_T size = (classID == root.classID) ? GCDesc::GetObjectSize(classID, root.address) : 0;
+    if (classID != root.classID || size != root.objectSize)
+    {
+        _rawLayout = RawLayoutState::Mismatch;
+        LogOnce(Warn,
+                "Reference-chain traversal workers are disabled: the class or size read from the MethodTable "
+                "does not match the profiling API. The roots are traversed sequentially.");
+        return;
+    }
+
+    // the size of an array or a string also depends on the component size read from the MethodTable:
+    // at least one of them must have been checked
+    if (GCDesc::HasComponentSize(classID))
+    {
+        _rawLayoutComponentSizeChecks++;
+    }
+
+    if (++_rawLayoutChecks >= MinRawLayoutChecks && _rawLayoutComponentSizeChecks > 0)
+    {
+        _rawLayout = RawLayoutState::Trusted;
+    }
+}
+
+bool ReferenceChainTraverser::CanUseWorkers() const
+{
+    // the self-test calls the profiling API: it must be over before the workers are used
+    return !_workers.empty() &&
+           _rawLayout == RawLayoutState::Trusted &&
+           (_selfTest != GCDesc::SelfTestResult::Pending || _selfTestObjectsChecked >= MaxSelfTestObjects) &&
+           _gcDescTrusted &&
+           _stopReason == TraversalStopReason::None;
+}
+
+void ReferenceChainTraverser::TraverseRootsWithWorkers(const std::vector<RootInfo>& roots, size_t firstRoot)
+{
+    auto startTime = OpSysTools::GetHighPrecisionTimestamp();
+
+    {
+        std::unique_lock lock(_workersLock);
+        if (_stopWorkers)
+        {
+            // no worker would take the batch
+            lock.unlock();
+            for (auto current = firstRoot; current < roots.size(); current++)
+            {
+                TraverseFromSingleRoot(roots[current]);
+            }
+            return;
+        }
+
+        _batch = &roots;
+        _nextBatchRoot.store(firstRoot, std::memory_order_relaxed);
+        _busyWorkers = _workers.size();
+        _batchNumber++;
+    }
+    _batchAvailable.notify_all();
+
+    // This thread must not return before the workers are done: the objects could be moved
+    // or collected as soon as the runtime resumes.
+    {
+        std::unique_lock lock(_workersLock);
+        _batchDone.wait(lock, [this] { return _busyWorkers == 0; });
+        _batch = nullptr;
+    }
+
+    try
+    {
+        MergeWorkers();
+    }
+    catch (...)
+    {
+        OnTraversalAborted();
+    }
+
+    _totalTraversalDuration += OpSysTools::GetHighPrecisionTimestamp() - startTime;
+}
+
+void ReferenceChainTraverser::MergeWorkers()
+{
+    for (auto& worker : _workers)
+    {
+        auto& traverser = *worker->traverser;
+
+        _tree.Merge(worker->tree);
+        worker->tree.Clear();
+
+        for (auto classID : traverser._unknownInlineVTTypes)
+        {
+            _inlineVTCache.GetInlineVTInfo(classID);
+        }
+        traverser._unknownInlineVTTypes.clear();
+
+        // the counters of the workers only cover the last batch
+        _objectsTraversed += std::exchange(traverser._objectsTraversed, 0);
+        _rootsProcessed += std::exchange(traverser._rootsProcessed, 0);
+        for (int i = 0; i < static_cast<int>(RootCategoryCount); i++)
+        {
+            _rootCategoryCounts[i] += std::exchange(traverser._rootCategoryCounts[i], 0);
+        }
+        _faultCount += std::exchange(traverser._faultCount, 0);
+
+        if (traverser._traversalStackHighWatermark > _traversalStackHighWatermark)
+        {
+            _traversalStackHighWatermark = traverser._traversalStackHighWatermark;
+        }
+
+        if (_stopReason == TraversalStopReason::None)
+        {
+            _stopReason = traverser._stopReason;
+        }
+    }
+
+    // the fault budget is for the whole dump, not for each worker
+    if (_stopReason == TraversalStopReason::None && _faultCount >= MaxFaultsPerDump)
+    {
+        _stopReason = TraversalStopReason::FaultBudgetExhausted;
+    }
+}
+
+size_t ReferenceChainTraverser::GetVisitedHighWatermark() const
+{
+    size_t highWatermark = _visited.GetBucketCount();
+    for (auto const& worker : _workers)
+    {
+        highWatermark = std::max(highWatermark, worker->traverser->_visited.GetBucketCount());
+    }
+    return highWatermark;
+}
+
+size_t ReferenceChainTraverser::GetVisitedPeakEntryCount() const
+{
+    size_t peakEntryCount = _visited.GetPeakEntryCount();
+    for (auto const& worker : _workers)
+    {
+        peakEntryCount = std::max(peakEntryCount, worker->traverser->_visited.GetPeakEntryCount());
+    }
+    return peakEntryCount;
+}
+
 template <typename TBody>
 bool ReferenceChainTraverser::RunGuarded(TBody&& body)
 {
@@ -262,6 +523,12 @@ void ReferenceChainTraverser::LogStats() const
               "memory access faults: ", _faultCount,
               stopDescription);
 
+    if (!_workers.empty())
+    {
+        Log::Debug("  Traversal workers: ", _workers.size(),
+                  (_rawLayout == RawLayoutState::Mismatch) ? " (disabled: raw object layout mismatch)" : "");
+    }
+
     Log::Debug("  VisitedObjectSet: ",
               _visited.Size(), " current / ",
               _visited.GetPeakEntryCount(), " peak entries, ",
@@ -314,8 +581,8 @@ void ReferenceChainTraverser::LogStats() const
 void ReferenceChainTraverser::DrainTraversalStack()
 {
     // Accepted residual risk: this runs under the fault guard and mutates the tree
-    // via TypeTreeNode::GetOrCreateChild (which allocates unordered_map nodes and can
-    // rehash). A fault landing mid-rehash could in theory leave the tree inconsistent.
+    // via TypeReferenceTree::GetOrCreateChild (which allocates node chunks and can grow
+    // the children index). A fault landing mid-growth could in theory leave the tree inconsistent.
     // In practice faults come from raw object/MethodTable reads (GCDesc slots,
     // GetClassFromObject), never from our own allocator, so this is not observed. The
     // airtight follow-up would be a harvest-then-process split (read slots under the
@@ -385,7 +652,7 @@ void ReferenceChainTraverser::DrainTraversalStack()
         // Check if this type has inline VTs (slow path needed for tree attribution).
         // A type met for the first time is only known from the next snapshot on: it cannot be
         // inspected from here (see InlineVTCache::ResolvePendingTypes).
-        const InlineVTCache::InlineVTInfo* vtInfo = _inlineVTCache.GetInlineVTInfo(classID);
+        const InlineVTCache::InlineVTInfo* vtInfo = LookupInlineVTInfo(classID);
 
         if (vtInfo == nullptr)
         {
@@ -426,18 +693,44 @@ void ReferenceChainTraverser::EnqueueValueTypeArrayChildren(
     TypeTreeNode* currentNode,
     uint32_t depth)
 {
+    uint64_t totalElements = 0;
+    if (!GetValueTypeArrayLength(arrayAddress, arrayClassID, totalElements) || totalElements == 0)
+    {
+        return;
+    }
+
+    GCDesc::EnumerateVTArrayRefs(arrayClassID, arrayAddress, totalElements,
+        [&](const uintptr_t* /*slot*/, uintptr_t refAddr, ULONG /*offset*/)
+        {
+            if (IsValidObjectAddress(refAddr))
+            {
+                ProcessDiscoveredRef(refAddr, currentNode, depth);
+            }
+        });
+}
+
+bool ReferenceChainTraverser::GetValueTypeArrayLength(uintptr_t arrayAddress, ClassID arrayClassID, uint64_t& totalElements)
+{
+    if (_isWorker)
+    {
+        // Only arrays of value types containing references have a negative series count
+        // and their number of components is the number of elements, whatever their rank.
+        totalElements = GCDesc::GetComponentCount(arrayAddress);
+        return true;
+    }
+
     CorElementType elementType;
     ClassID elementClassID;
     ULONG rank = 0;
     HRESULT hr = _pCorProfilerInfo->IsArrayClass(arrayClassID, &elementType, &elementClassID, &rank);
     if (hr != S_OK || rank == 0 || elementType != ELEMENT_TYPE_VALUETYPE)
     {
-        return;
+        return false;
     }
 
     if (elementClassID == 0 || !GCDesc::ContainsGCPointers(elementClassID))
     {
-        return;
+        return false;
     }
 
     // Stack-allocate for rank 1; use reusable members for multi-dimensional so no
@@ -471,10 +764,10 @@ void ReferenceChainTraverser::EnqueueValueTypeArrayChildren(
 
     if (FAILED(hr) || pData == nullptr)
     {
-        return;
+        return false;
     }
 
-    uint64_t totalElements = 1;
+    totalElements = 1;
     for (ULONG32 d = 0; d < rank; d++)
     {
         ULONG32 dim = dimensionSizes[d];
@@ -483,55 +776,12 @@ void ReferenceChainTraverser::EnqueueValueTypeArrayChildren(
         // rather than walking arbitrary memory based on a wrapped count.
         if (dim != 0 && totalElements > UINT64_MAX / dim)
         {
-            return;
+            return false;
         }
         totalElements *= dim;
     }
 
-    if (totalElements == 0)
-    {
-        return;
-    }
-
-    GCDesc::EnumerateVTArrayRefs(arrayClassID, arrayAddress, totalElements,
-        [&](const uintptr_t* /*slot*/, uintptr_t refAddr, ULONG /*offset*/)
-        {
-            if (refAddr == 0 || !IsValidObjectAddress(refAddr))
-            {
-                return;
-            }
-
-            VisitedObjectSet::VisitedEntry* slot = nullptr;
-            if (_visited.TryInsert(refAddr, slot) == VisitedObjectSet::InsertResult::Inserted)
-            {
-                ClassID targetClassID = 0;
-                HRESULT hr = _pCorProfilerInfo->GetClassFromObject(refAddr, &targetClassID);
-                if (FAILED(hr) || targetClassID == 0)
-                {
-                    return;
-                }
-
-                SIZE_T targetSize = 0;
-                hr = _pCorProfilerInfo->GetObjectSize2(refAddr, &targetSize);
-                if (FAILED(hr) || targetSize == 0)
-                {
-                    return;
-                }
-
-                slot->classID = targetClassID;
-
-                TypeTreeNode* childNode = currentNode->GetOrCreateChild(targetClassID);
-                childNode->AddInstance(targetSize);
-                PushTraversalFrameIfScannable(refAddr, childNode, depth + 1, targetClassID, targetSize);
-            }
-            else if (slot->classID != 0)
-            {
-                SIZE_T revisitSize = 0;
-                _pCorProfilerInfo->GetObjectSize2(refAddr, &revisitSize);
-                TypeTreeNode* childNode = currentNode->GetOrCreateChild(slot->classID);
-                childNode->AddInstance(revisitSize);
-            }
-        });
+    return true;
 }
 
 void ReferenceChainTraverser::AddInlineValueTypeInstances(TypeTreeNode* currentNode, const InlineVTCache::InlineVTInfo& vtInfo)
@@ -539,10 +789,10 @@ void ReferenceChainTraverser::AddInlineValueTypeInstances(TypeTreeNode* currentN
     for (const auto& field : vtInfo.fields)
     {
         ClassID vtClassID = field.classID;
-        TypeTreeNode* vtNode = currentNode->GetOrCreateChild(vtClassID);
+        TypeTreeNode* vtNode = _tree.GetOrCreateChild(currentNode, vtClassID);
         vtNode->AddInstance(0);
 
-        const InlineVTCache::InlineVTInfo* nestedInfo = _inlineVTCache.GetInlineVTInfo(vtClassID);
+        const InlineVTCache::InlineVTInfo* nestedInfo = LookupInlineVTInfo(vtClassID);
         if (nestedInfo != nullptr)
         {
             AddInlineValueTypeInstances(vtNode, *nestedInfo);
@@ -570,9 +820,9 @@ ReferenceChainTraverser::InlineVTOwner ReferenceChainTraverser::GetInlineValueTy
             continue;
         }
 
-        TypeTreeNode* vtNode = currentNode->GetOrCreateChild(field.classID);
+        TypeTreeNode* vtNode = _tree.GetOrCreateChild(currentNode, field.classID);
 
-        const InlineVTCache::InlineVTInfo* nestedInfo = _inlineVTCache.GetInlineVTInfo(field.classID);
+        const InlineVTCache::InlineVTInfo* nestedInfo = LookupInlineVTInfo(field.classID);
         if (nestedInfo != nullptr)
         {
             return GetInlineValueTypeOwner(vtNode, depth + 1, refOffset, *nestedInfo, vtStart);
@@ -590,22 +840,15 @@ bool ReferenceChainTraverser::ProcessDiscoveredRef(uintptr_t refAddress, TypeTre
     if (_visited.TryInsert(refAddress, slot) == VisitedObjectSet::InsertResult::Inserted)
     {
         ClassID targetClassID = 0;
-        HRESULT hr = _pCorProfilerInfo->GetClassFromObject(refAddress, &targetClassID);
-        if (FAILED(hr) || targetClassID == 0)
-        {
-            return false;
-        }
-
         SIZE_T targetSize = 0;
-        hr = _pCorProfilerInfo->GetObjectSize2(refAddress, &targetSize);
-        if (FAILED(hr) || targetSize == 0)
+        if (!GetObjectClassAndSize(refAddress, targetClassID, targetSize))
         {
             return false;
         }
 
         slot->classID = targetClassID;
 
-        TypeTreeNode* childNode = parentNode->GetOrCreateChild(targetClassID);
+        TypeTreeNode* childNode = _tree.GetOrCreateChild(parentNode, targetClassID);
         childNode->AddInstance(targetSize);
         PushTraversalFrameIfScannable(refAddress, childNode, depth + 1, targetClassID, targetSize);
         return true;
@@ -613,15 +856,68 @@ bool ReferenceChainTraverser::ProcessDiscoveredRef(uintptr_t refAddress, TypeTre
 
     if (slot->classID != 0)
     {
-        SIZE_T revisitSize = 0;
-        _pCorProfilerInfo->GetObjectSize2(refAddress, &revisitSize);
-        TypeTreeNode* childNode = parentNode->GetOrCreateChild(slot->classID);
+        SIZE_T revisitSize = GetObjectSize(refAddress, slot->classID);
+        TypeTreeNode* childNode = _tree.GetOrCreateChild(parentNode, slot->classID);
         childNode->AddInstance(revisitSize);
     }
 
     return false;
 }
 
+bool ReferenceChainTraverser::GetObjectClassAndSize(uintptr_t address, ClassID& classID, SIZE_T& size)
+{
+    if (_isWorker)
+    {
+        classID = GCDesc::GetObjectClass(address);
+        if (classID == 0)
+        {
+            return false;
+        }
+
+        size = GCDesc::GetObjectSize(classID, address);
+        return size != 0;
+    }
+
+    HRESULT hr = _pCorProfilerInfo->GetClassFromObject(address, &classID);
+    if (FAILED(hr) || classID == 0)
+    {
+        return false;
+    }
+
+    hr = _pCorProfilerInfo->GetObjectSize2(address, &size);
+    return SUCCEEDED(hr) && size != 0;
+}
+
+SIZE_T ReferenceChainTraverser::GetObjectSize(uintptr_t address, ClassID classID)
+{
+    if (_isWorker)
+    {
+        return GCDesc::GetObjectSize(classID, address);
+    }
+
+    SIZE_T size = 0;
+    _pCorProfilerInfo->GetObjectSize2(address, &size);
+    return size;
+}
+
+const InlineVTCache::InlineVTInfo* ReferenceChainTraverser::LookupInlineVTInfo(ClassID classID)
+{
+    if (!_isWorker)
+    {
+        return _inlineVTCache.GetInlineVTInfo(classID);
+    }
+
+    // The cache is shared by the workers so it is only read here: the callback thread
+    // queues the unknown types once the batch is done (see MergeWorkers).
+    bool isKnown = true;
+    const InlineVTCache::InlineVTInfo* vtInfo = _inlineVTCache.FindInlineVTInfo(classID, isKnown);
+    if (!isKnown)
+    {
+        _unknownInlineVTTypes.insert(classID);
+    }
+    return vtInfo;
+}
+
 void ReferenceChainTraverser::PushTraversalFrameIfScannable(
     uintptr_t objectAddress,
     TypeTreeNode* treeNode,
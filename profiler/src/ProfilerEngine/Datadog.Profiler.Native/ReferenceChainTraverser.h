@@ -10,8 +10,14 @@
 #include "TypeReferenceTree.h"
 #include "VisitedObjectSet.h"
 #include "ReferenceChainTypes.h"
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <unordered_set>
 #include <vector>
 
 // Forward declarations
@@ -26,6 +32,12 @@ class IFrameStore;
 //
 // Reference enumeration uses the GCDesc (fast path, no cache) for all objects.
 // Inline value type tree attribution uses InlineVTCache (slow path, rare).
+//
+// On large heaps, the roots of an OnBulkRootEdges batch can be spread over worker threads
+// (see StartWorkers) while the callback thread waits for them, so that the runtime stays
+// suspended. Since the workers cannot call the profiling API, they read the class and size
+// of the objects from the MethodTable. Each worker has its own visited set, stack and fault
+// budget, and builds its own subtree that is merged into the tree once the batch is done.
 class ReferenceChainTraverser
 {
 public:
@@ -53,14 +65,30 @@ public:
         InlineVTCache& inlineVTCache,
         size_t visitedSetInitialCapacity = 512);
 
+    ~ReferenceChainTraverser();
+
+    ReferenceChainTraverser(const ReferenceChainTraverser&) = delete;
+    ReferenceChainTraverser& operator=(const ReferenceChainTraverser&) = delete;
+
     // Traverse from a single root (called from OnBulkRoot* event handlers).
     // A fresh VisitedObjectSet is used per root for cycle detection within that root's graph.
     void TraverseFromSingleRoot(const RootInfo& root);
 
+    // Traverse the roots of an OnBulkRootEdges batch. Without workers (or until the GCDesc
+    // self-test and the raw object reads have been validated), each root is traversed
+    // by the calling thread as with TraverseFromSingleRoot.
+    void TraverseRoots(const std::vector<RootInfo>& roots);
+
+    // Must be called before the first root is traversed.
+    void StartWorkers(uint32_t workerCount);
+
+    // Called at the end of the dump: the statistics of the workers are kept.
+    void StopWorkers();
+
     void LogStats() const;
 
-    size_t GetVisitedHighWatermark() const { return _visited.GetBucketCount(); }
-    size_t GetVisitedPeakEntryCount() const { return _visited.GetPeakEntryCount(); }
+    size_t GetVisitedHighWatermark() const;
+    size_t GetVisitedPeakEntryCount() const;
 
     // Whether the GCDesc reader passed (or has not yet failed) its runtime
     // self-test. When false, GCDesc-based traversal is disabled for this
@@ -100,6 +128,37 @@ public:
 #endif
 
 private:
+    enum class RawLayoutState
+    {
+        Pending,
+        Trusted,
+        Mismatch
+    };
+
+    struct Worker
+    {
+        TypeReferenceTree tree;
+        std::unique_ptr<ReferenceChainTraverser> traverser;
+        std::thread thread;
+    };
+
+    // Worker traverser: builds its own tree, never calls the profiling API and skips the
+    // GCDesc self-test (it only runs once the self-test of the coordinator is over).
+    ReferenceChainTraverser(const ReferenceChainTraverser& coordinator, TypeReferenceTree& tree);
+
+    void WorkerLoop(Worker& worker);
+
+    // Compares GCDesc::GetObjectClass/GetObjectSize to what the profiling API returned for
+    // the root: the workers are only used after MinRawLayoutChecks roots agreed, including
+    // at least one array or string (their size depends on the component size).
+    void ValidateRawObjectLayout(const RootInfo& root);
+    bool CanUseWorkers() const;
+    void TraverseRootsWithWorkers(const std::vector<RootInfo>& roots, size_t firstRoot);
+
+    // Adds the subtrees, statistics and stop reasons of the workers to this traverser
+    // and queues the types they did not find in the InlineVTCache.
+    void MergeWorkers();
+
     // Everything TraverseFromSingleRoot does, minus the "an exception escaped" safety
     // net that wraps it.
     void TraverseFromSingleRootCore(const RootInfo& root);
@@ -179,6 +238,16 @@ private:
         ClassID classID,
         SIZE_T objectSize);
 
+    // GetClassFromObject + GetObjectSize2, or the raw MethodTable reads for a worker
+    bool GetObjectClassAndSize(uintptr_t address, ClassID& classID, SIZE_T& size);
+    SIZE_T GetObjectSize(uintptr_t address, ClassID classID);
+
+    // IsArrayClass + GetArrayObjectInfo, or the raw component count for a worker
+    bool GetValueTypeArrayLength(uintptr_t arrayAddress, ClassID arrayClassID, uint64_t& totalElements);
+
+    // InlineVTCache::GetInlineVTInfo, or its read-only variant for a worker
+    const InlineVTCache::InlineVTInfo* LookupInlineVTInfo(ClassID classID);
+
     static bool IsValidObjectAddress(uintptr_t address);
     std::string GetClassName(ClassID classID) const;
 
@@ -247,4 +316,25 @@ private:
     static constexpr uint32_t MaxFaultsPerDump = 16;
     uint32_t _faultCount = 0;
     TraversalStopReason _stopReason = TraversalStopReason::None;
+
+    // ---- Traversal workers ----
+    bool _isWorker = false;
+
+    // Worker only: types to give to InlineVTCache::GetInlineVTInfo after the batch
+    std::unordered_set<ClassID> _unknownInlineVTTypes;
+
+    std::vector<std::unique_ptr<Worker>> _workers;
+    std::mutex _workersLock;
+    std::condition_variable _batchAvailable;
+    std::condition_variable _batchDone;
+    const std::vector<RootInfo>* _batch = nullptr;
+    std::atomic<size_t> _nextBatchRoot{0};
+    uint64_t _batchNumber = 0;
+    size_t _busyWorkers = 0;
+    bool _stopWorkers = false;
+
+    static constexpr uint32_t MinRawLayoutChecks = 16;
+    RawLayoutState _rawLayout = RawLayoutState::Pending;
+    uint32_t _rawLayoutChecks = 0;
+    uint32_t _rawLayoutComponentSizeChecks = 0;
 };
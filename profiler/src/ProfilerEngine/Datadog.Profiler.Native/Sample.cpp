@@ -105,11 +105,29 @@ void Sample::AddValue(std::int64_t value, size_t index)
 
 void Sample::AddFrame(FrameInfoView const& frame)
 {
+    if (_sharedCallstack != nullptr)
+    {
+        // the shared frames are immutable: get our own copy before adding a frame
+        _callstack.assign(_sharedCallstack->begin(), _sharedCallstack->end());
+        _sharedCallstack.reset();
+    }
+
     _callstack.push_back(frame);
 }
 
+void Sample::SetCallstack(SharedCallstack callstack)
+{
+    _callstack.clear();
+    _sharedCallstack = std::move(callstack);
+}
+
 const std::vector<FrameInfoView>& Sample::GetCallstack() const
 {
+    if (_sharedCallstack != nullptr)
+    {
+        return *_sharedCallstack;
+    }
+
     return _callstack;
 }
 
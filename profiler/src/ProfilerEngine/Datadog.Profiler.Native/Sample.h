@@ -10,6 +10,7 @@
 #include <chrono>
 #include <iostream>
 #include <list>
+#include <memory>
 #include <string>
 #include <string_view>
 #include <tuple>
@@ -45,6 +46,9 @@ class Sample final
 public:
     static size_t ValuesCount;
 
+    // frames shared by the samples with the same callstack (see RawSampleTransformer)
+    using SharedCallstack = std::shared_ptr<const std::vector<FrameInfoView>>;
+
 public:
     Sample(std::chrono::nanoseconds timestamp, std::string_view runtimeId, size_t framesCount);
     Sample(std::string_view runtimeId); // only for tests
@@ -73,6 +77,7 @@ public:
     // and a Sample in each Provider (this is behind CollectorBase template class)
     void AddValue(std::int64_t value, size_t index);
     void AddFrame(FrameInfoView const& frame);
+    void SetCallstack(SharedCallstack callstack);
 
     template <typename T>
     void AddLabel(T&& label)
@@ -135,6 +140,7 @@ public:
     {
         _timestamp = 0ns;
         _callstack.clear();
+        _sharedCallstack.reset();
         _runtimeId = {};
         _allLabels.clear();
         std::fill(_values.begin(), _values.end(), 0);
@@ -182,6 +188,7 @@ public:
 private:
     std::chrono::nanoseconds _timestamp;
     std::vector<FrameInfoView> _callstack;
+    SharedCallstack _sharedCallstack;
     Values _values;
     Labels _allLabels;
     std::string_view _runtimeId;
@@ -16,18 +16,30 @@ SamplesCollector::SamplesCollector(
     IConfiguration* configuration,
     IThreadsCpuManager* pThreadsCpuManager,
     IExporter* exporter,
-    IMetricsSender* metricsSender) :
+    IMetricsSender* metricsSender,
+    MetricsRegistry& metricsRegistry) :
     _uploadInterval{configuration->GetUploadInterval()},
     _pThreadsCpuManager{pThreadsCpuManager},
+    _samplesAvailableEvent{false},
     _metricsSender{metricsSender},
     _exporter{exporter},
     _cachedSample{std::make_shared<Sample>(0ns, std::string_view{}, Callstack::MaxFrames)}
 {
+    _queueDepthMetric = metricsRegistry.GetOrRegister<MeanMaxMetric>("dotnet_samples_collector_queue_depth");
+    _drainDurationMetric = metricsRegistry.GetOrRegister<MeanMaxMetric>("dotnet_samples_collector_drain_duration");
+    _samplesAvailableNotificationsMetric = metricsRegistry.GetOrRegister<CounterMetric>("dotnet_samples_collector_notifications");
 }
 
 void SamplesCollector::Register(ISamplesProvider* samplesProvider)
 {
     _samplesProviders.push_front(std::make_pair(samplesProvider, 0));
+    samplesProvider->SetSamplesAvailableListener(this);
+}
+
+void SamplesCollector::OnSamplesAvailable()
+{
+    _samplesAvailableNotificationsMetric->Incr();
+    _samplesAvailableEvent.Set();
 }
 
 void SamplesCollector::RegisterBatchedProvider(IBatchedSamplesProvider* batchedSamplesProvider)
@@ -55,7 +67,14 @@ bool SamplesCollector::StopImpl()
 {
     Log::Info("Stopping the samples collector");
 
+    // the providers must not notify this instance anymore
+    for (auto& samplesProvider : _samplesProviders)
+    {
+        samplesProvider.first->SetSamplesAvailableListener(nullptr);
+    }
+
     _workerThreadPromise.set_value();
+    _samplesAvailableEvent.Set();
     _workerThread.join();
 
     _exporterThreadPromise.set_value();
@@ -79,8 +98,15 @@ void SamplesCollector::SamplesWork()
 
     const auto future = _workerThreadPromise.get_future();
 
-    while (future.wait_for(CollectingPeriod) == std::future_status::timeout)
+    while (future.wait_for(0s) == std::future_status::timeout)
     {
+        // collect either periodically or as soon as a provider notifies a burst of samples
+        _samplesAvailableEvent.Wait(std::chrono::duration_cast<std::chrono::milliseconds>(CollectingPeriod));
+        if (future.wait_for(0s) != std::future_status::timeout)
+        {
+            break;
+        }
+
         CollectSamples(_samplesProviders);
     }
 }
@@ -103,25 +129,30 @@ void SamplesCollector::Export(bool lastCall)
 
     try
     {
-        std::lock_guard lock(_exportLock);
+        {
+            std::lock_guard lock(_exportLock);
 
-        // batched samples are collected once just before export
-        CollectSamples(_batchedSamplesProviders);
+            // batched samples are collected once just before export
+            CollectSamples(_batchedSamplesProviders);
 
-        Log::Debug("Collected samples per provider:");
-        for (auto& samplesProvider : _samplesProviders)
-        {
-            auto name = samplesProvider.first->GetName();
-            Log::Debug(name, " : ", samplesProvider.second);
-            samplesProvider.second = 0;
-        }
-        for (auto& batchedSamplesProvider : _batchedSamplesProviders)
-        {
-            auto name = batchedSamplesProvider.first->GetName();
-            Log::Debug(name, " : ", batchedSamplesProvider.second);
-            batchedSamplesProvider.second = 0;
+            Log::Debug("Collected samples per provider:");
+            for (auto& samplesProvider : _samplesProviders)
+            {
+                auto name = samplesProvider.first->GetName();
+                Log::Debug(name, " : ", samplesProvider.second);
+                samplesProvider.second = 0;
+            }
+            for (auto& batchedSamplesProvider : _batchedSamplesProviders)
+            {
+                auto name = batchedSamplesProvider.first->GetName();
+                Log::Debug(name, " : ", batchedSamplesProvider.second);
+                batchedSamplesProvider.second = 0;
+            }
         }
 
+        // The exporter swaps each application profile for a new one before serializing it:
+        // the serialization and the upload are done without holding the lock so that the
+        // worker thread keeps draining the providers (and their ring buffers) meanwhile.
         success = _exporter->Export(lastCall);
     }
     catch (std::exception const& ex)
@@ -136,13 +167,24 @@ void SamplesCollector::Export(bool lastCall)
 
 void SamplesCollector::CollectSamples(std::forward_list<std::pair<ISamplesProvider*, uint64_t>>& samplesProviders)
 {
+    std::size_t pendingSamplesCount = 0;
+    std::chrono::nanoseconds drainDuration = 0ns;
+
+    // each provider is drained then transformed before the next one: only the samples of one
+    // provider are held at a time
     for (auto& samplesProvider : samplesProviders)
     {
         try
         {
+            // the drain does not need the export lock: only this thread gets the samples
+            // of these providers (the exporter thread only drains the batched providers)
+            auto start = OpSysTools::GetHighPrecisionTimestamp();
+            auto samples = samplesProvider.first->GetSamples();
+            drainDuration += OpSysTools::GetHighPrecisionTimestamp() - start;
+            pendingSamplesCount += samples->size();
+
             std::lock_guard lock(_exportLock);
 
-            auto samples = samplesProvider.first->GetSamples();
             samplesProvider.second += samples->size();
 
             while (samples->MoveNext(_cachedSample))
@@ -158,6 +200,9 @@ void SamplesCollector::CollectSamples(std::forward_list<std::pair<ISamplesProvid
             Log::Error("An exception occurred while collecting samples: ", ex.what());
         }
     }
+
+    _queueDepthMetric->Add(static_cast<double_t>(pendingSamplesCount));
+    _drainDurationMetric->Add(std::chrono::duration<double_t, std::milli>(drainDuration).count());
 }
 
 void SamplesCollector::SendHeartBeatMetric(bool success)
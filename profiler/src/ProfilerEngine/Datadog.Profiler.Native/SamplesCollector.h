@@ -3,15 +3,21 @@
 
 #pragma once
 
+#include "AutoResetEvent.h"
+#include "CounterMetric.h"
 #include "IBatchedSamplesProvider.h"
 #include "IConfiguration.h"
 #include "IExporter.h"
 #include "IMetricsSender.h"
+#include "ISamplesAvailableListener.h"
 #include "ISamplesCollector.h"
 #include "IThreadsCpuManager.h"
+#include "MeanMaxMetric.h"
+#include "MetricsRegistry.h"
 #include "ServiceBase.h"
 
 #include <forward_list>
+#include <memory>
 #include <mutex>
 #include <thread>
 #include <future>
@@ -21,10 +27,11 @@ using namespace std::chrono_literals;
 class SamplesCollector
     :
     public ISamplesCollector,
+    public ISamplesAvailableListener,
     public ServiceBase
 {
 public:
-    SamplesCollector(IConfiguration* configuration, IThreadsCpuManager* pThreadsCpuManager, IExporter* exporter, IMetricsSender* metricsSender);
+    SamplesCollector(IConfiguration* configuration, IThreadsCpuManager* pThreadsCpuManager, IExporter* exporter, IMetricsSender* metricsSender, MetricsRegistry& metricsRegistry);
 
     // Inherited via IService
     const char* GetName() override;
@@ -32,6 +39,9 @@ public:
     void Register(ISamplesProvider* samplesProvider) override;
     void RegisterBatchedProvider(IBatchedSamplesProvider* batchedSamplesProvider) override;
 
+    // Inherited via ISamplesAvailableListener
+    void OnSamplesAvailable() override;
+
     // Public but should only be called privately or from tests
     void Export(bool lastCall = false);
 
@@ -61,9 +71,15 @@ private:
     std::recursive_mutex _exportLock;
     std::promise<void> _exporterThreadPromise;
     std::promise<void> _workerThreadPromise;
+    AutoResetEvent _samplesAvailableEvent;
     IMetricsSender* _metricsSender;
     IExporter* _exporter;
 
+    // samples pending in the providers when they are drained and time spent to drain them
+    std::shared_ptr<MeanMaxMetric> _queueDepthMetric;
+    std::shared_ptr<MeanMaxMetric> _drainDurationMetric;
+    std::shared_ptr<CounterMetric> _samplesAvailableNotificationsMetric;
+
     // OPTIM
     // It safe to have only one cached sample with no synchronization
     // This field is only used by one thread at a time:
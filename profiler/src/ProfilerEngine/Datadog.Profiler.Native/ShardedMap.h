@@ -0,0 +1,132 @@
+// Unless explicitly stated otherwise all files in this repository are licensed under the Apache 2 License.
+// This product includes software developed at Datadog (https://www.datadoghq.com/). Copyright 2025 Datadog, Inc.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <utility>
+
+// Concurrent map split into independently locked shards.
+// Lookups take a shared lock on a single shard so concurrent readers never block each other,
+// and writers only block readers of the same shard.
+// Since std::unordered_map nodes are stable, pointers returned by Find/Emplace stay valid for the
+// lifetime of the map. Elements that can be erased must only be read with TryGet (copy) instead.
+template <typename TKey, typename TValue, std::size_t ShardCount = 16, typename THash = std::hash<TKey>>
+class ShardedMap
+{
+    static_assert((ShardCount & (ShardCount - 1)) == 0, "ShardCount must be a power of 2");
+
+public:
+    TValue* Find(TKey const& key)
+    {
+        auto& shard = GetShard(key);
+        std::shared_lock lock(shard.Lock);
+
+        auto it = shard.Map.find(key);
+        if (it == shard.Map.end())
+        {
+            return nullptr;
+        }
+
+        return &it->second;
+    }
+
+    // Copies the element under the shard lock: safe with a concurrent Erase
+    bool TryGet(TKey const& key, TValue& value)
+    {
+        auto& shard = GetShard(key);
+        std::shared_lock lock(shard.Lock);
+
+        auto it = shard.Map.find(key);
+        if (it == shard.Map.end())
+        {
+            return false;
+        }
+
+        value = it->second;
+        return true;
+    }
+
+    bool Erase(TKey const& key)
+    {
+        auto& shard = GetShard(key);
+        std::unique_lock lock(shard.Lock);
+
+        return shard.Map.erase(key) != 0;
+    }
+
+    // Returns the element stored for the key and true if it was inserted by this call.
+    // If another thread already added the key, the existing element is returned instead.
+    template <typename... TArgs>
+    std::pair<TValue*, bool> Emplace(TKey const& key, TArgs&&... args)
+    {
+        auto& shard = GetShard(key);
+        std::unique_lock lock(shard.Lock);
+
+        auto [it, inserted] = shard.Map.try_emplace(key, std::forward<TArgs>(args)...);
+        return {&it->second, inserted};
+    }
+
+    // The callback is called for each element while its shard is locked for read
+    template <typename TCallback>
+    void ForEach(TCallback&& callback) const
+    {
+        for (auto const& shard : _shards)
+        {
+            std::shared_lock lock(shard.Lock);
+            for (auto const& [key, value] : shard.Map)
+            {
+                callback(key, value);
+            }
+        }
+    }
+
+    std::size_t Size() const
+    {
+        std::size_t size = 0;
+        for (auto const& shard : _shards)
+        {
+            std::shared_lock lock(shard.Lock);
+            size += shard.Map.size();
+        }
+        return size;
+    }
+
+    std::size_t BucketCount() const
+    {
+        std::size_t buckets = 0;
+        for (auto const& shard : _shards)
+        {
+            std::shared_lock lock(shard.Lock);
+            buckets += shard.Map.bucket_count();
+        }
+        return buckets;
+    }
+
+private:
+    // each shard sits on its own cache line to avoid false sharing between the locks
+    struct alignas(64) Shard
+    {
+        mutable std::shared_mutex Lock;
+        std::unordered_map<TKey, TValue, THash> Map;
+    };
+
+    Shard& GetShard(TKey const& key)
+    {
+        // FunctionID/ClassID are aligned addresses: mix the bits so that the low bits
+        // used to select the shard are not always the same
+        std::uint64_t h = static_cast<std::uint64_t>(THash{}(key));
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        return _shards[h & (ShardCount - 1)];
+    }
+
+    std::array<Shard, ShardCount> _shards;
+};
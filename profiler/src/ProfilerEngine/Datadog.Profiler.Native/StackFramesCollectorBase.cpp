@@ -112,6 +112,13 @@ StackSnapshotResultBuffer* StackFramesCollectorBase::CollectStackSampleImplement
     return GetStackSnapshotResult();
 }
 
+bool StackFramesCollectorBase::CollectStackSamples(std::vector<StackSampleRequest>& requests)
+{
+    // The actual business logic provided by a subclass.
+    // By default, batched collection is not supported.
+    return false;
+}
+
 bool StackFramesCollectorBase::IsCurrentCollectionAbortRequested()
 {
     return _isCurrentCollectionAbortRequested.load();
@@ -133,13 +140,23 @@ bool StackFramesCollectorBase::TryApplyTraceContextDataFromCurrentCollectionThre
         return false;
     }
 
-    auto [localRootSpanId, spanId] = pCurrentCollectionThreadInfo->GetTracingContext();
+    auto [localRootSpanId, spanId] = GetTraceContext(pCurrentCollectionThreadInfo);
     _pStackSnapshotResult->SetLocalRootSpanId(localRootSpanId);
     _pStackSnapshotResult->SetSpanId(spanId);
 
     return true;
 }
 
+std::pair<std::uint64_t, std::uint64_t> StackFramesCollectorBase::GetTraceContext(ManagedThreadInfo* pThreadInfo) const
+{
+    if (_isCIVisibilityEnabled && _ciVisibilitySpanId > 0)
+    {
+        return {_ciVisibilitySpanId, _ciVisibilitySpanId};
+    }
+
+    return pThreadInfo->GetTracingContext();
+}
+
 StackSnapshotResultBuffer* StackFramesCollectorBase::GetStackSnapshotResult()
 {
     return _pStackSnapshotResult.get();
@@ -8,6 +8,7 @@
 #include <condition_variable>
 #include <memory>
 #include <mutex>
+#include <vector>
 
 #include "CallstackProvider.h"
 #include "ManagedThreadInfo.h"
@@ -16,12 +17,23 @@
 class IConfiguration;
 class UnwindingRecorder;
 
+// One entry per thread of a batched collection (see CollectStackSamples)
+struct StackSampleRequest
+{
+    std::shared_ptr<ManagedThreadInfo> ThreadInfo;
+    Callstack Stack;
+    std::uint64_t LocalRootSpanId = 0;
+    std::uint64_t SpanId = 0;
+    std::int32_t ErrorCode = 0;
+};
+
 class StackFramesCollectorBase
 {
 protected:
     StackFramesCollectorBase(IConfiguration const * _configuration, CallstackProvider* callstackProvider);
 
     bool TryApplyTraceContextDataFromCurrentCollectionThreadToSnapshot();
+    std::pair<std::uint64_t, std::uint64_t> GetTraceContext(ManagedThreadInfo* pThreadInfo) const;
     bool AddFrame(std::uintptr_t ip);
     void AddFakeFrame();
     void SetFrameCount(std::uint16_t count);
@@ -54,6 +66,12 @@ public:
     void ResumeTargetThreadIfRequired(ManagedThreadInfo* pThreadInfo, bool isTargetThreadSuspended, uint32_t* pErrorCodeHR);
     StackSnapshotResultBuffer* CollectStackSample(ManagedThreadInfo* pThreadInfo, uint32_t* pHR, UnwindingRecorder* recorder = nullptr);
 
+    // Collect the callstacks of all the requested threads at once instead of one after the other.
+    // The caller must hold the lock of each thread (see ManagedThreadInfo::TryAcquireLock).
+    // Returns false if the collector does not support batched collection: the threads
+    // must then be sampled one by one with CollectStackSample.
+    virtual bool CollectStackSamples(std::vector<StackSampleRequest>& requests);
+
 protected:
     ManagedThreadInfo* _pCurrentCollectionThreadInfo;
     CallstackProvider* _callstackProvider;
@@ -0,0 +1,76 @@
+// Unless explicitly stated otherwise all files in this repository are licensed under the Apache 2 License.
+// This product includes software developed at Datadog (https://www.datadoghq.com/). Copyright 2025 Datadog, Inc.
+
+#include "StackFramesCollectorPool.h"
+
+#include "OsSpecificApi.h"
+
+StackFramesCollectorPool::Lease::Lease(StackFramesCollectorPool* pool, std::unique_ptr<StackFramesCollectorBase> collector) :
+    _pool{pool},
+    _collector{std::move(collector)}
+{
+}
+
+StackFramesCollectorPool::Lease::Lease(Lease&& other) noexcept :
+    _pool{other._pool},
+    _collector{std::move(other._collector)}
+{
+}
+
+StackFramesCollectorPool::Lease::~Lease()
+{
+    if (_collector != nullptr)
+    {
+        _pool->Release(std::move(_collector));
+    }
+}
+
+StackFramesCollectorPool::StackFramesCollectorPool(
+    ICorProfilerInfo4* pCorProfilerInfo,
+    IConfiguration const* pConfiguration,
+    CallstackProvider* callstackProvider,
+    MetricsRegistry& metricsRegistry) :
+    _pCorProfilerInfo{pCorProfilerInfo},
+    _pConfiguration{pConfiguration},
+    _callstackProvider{callstackProvider},
+    _metricsRegistry{metricsRegistry},
+    _createdCount{0}
+{
+}
+
+StackFramesCollectorPool::Lease StackFramesCollectorPool::Acquire()
+{
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+
+        if (!_availableCollectors.empty())
+        {
+            auto collector = std::move(_availableCollectors.back());
+            _availableCollectors.pop_back();
+            return Lease(this, std::move(collector));
+        }
+
+        _createdCount++;
+
+        // make sure that giving back the collector will not need to grow the vector
+        _availableCollectors.reserve(_createdCount);
+    }
+
+    // the creation is done outside of the lock: other threads can reuse their collector in the meantime
+    return Lease(this, OsSpecificApi::CreateNewStackFramesCollectorInstance(
+                           _pCorProfilerInfo, _pConfiguration, _callstackProvider, _metricsRegistry));
+}
+
+void StackFramesCollectorPool::Release(std::unique_ptr<StackFramesCollectorBase> collector)
+{
+    std::lock_guard<std::mutex> lock(_lock);
+
+    _availableCollectors.push_back(std::move(collector));
+}
+
+std::size_t StackFramesCollectorPool::GetCreatedCount() const
+{
+    std::lock_guard<std::mutex> lock(_lock);
+
+    return _createdCount;
+}
@@ -0,0 +1,75 @@
+// Unless explicitly stated otherwise all files in this repository are licensed under the Apache 2 License.
+// This product includes software developed at Datadog (https://www.datadoghq.com/). Copyright 2025 Datadog, Inc.
+
+#pragma once
+
+#include "cor.h"
+#include "corprof.h"
+
+#include "StackFramesCollectorBase.h"
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+class CallstackProvider;
+class IConfiguration;
+class MetricsRegistry;
+
+// Keeps the stack frames collectors used by the providers that walk the stack of the current
+// thread when an event is received (allocations, exceptions).
+// Creating a collector allocates it, its result buffer and looks up its metrics: instead, the
+// collectors are created once and reused so that, in steady state, no heap allocation is done
+// on the application thread to collect a sample.
+class StackFramesCollectorPool
+{
+public:
+    // Gives back the collector to the pool when destroyed
+    class Lease
+    {
+    public:
+        Lease(StackFramesCollectorPool* pool, std::unique_ptr<StackFramesCollectorBase> collector);
+        ~Lease();
+
+        Lease(Lease const&) = delete;
+        Lease& operator=(Lease const&) = delete;
+        Lease(Lease&& other) noexcept;
+        Lease& operator=(Lease&& other) = delete;
+
+        StackFramesCollectorBase* operator->() const { return _collector.get(); }
+        StackFramesCollectorBase* Get() const { return _collector.get(); }
+
+    private:
+        StackFramesCollectorPool* _pool;
+        std::unique_ptr<StackFramesCollectorBase> _collector;
+    };
+
+public:
+    StackFramesCollectorPool(
+        ICorProfilerInfo4* pCorProfilerInfo,
+        IConfiguration const* pConfiguration,
+        CallstackProvider* callstackProvider,
+        MetricsRegistry& metricsRegistry);
+
+    StackFramesCollectorPool(StackFramesCollectorPool const&) = delete;
+    StackFramesCollectorPool& operator=(StackFramesCollectorPool const&) = delete;
+
+    // Each thread collecting a sample gets its own collector: a new one is created only
+    // if all the existing ones are currently used by other threads
+    Lease Acquire();
+
+    std::size_t GetCreatedCount() const;
+
+private:
+    void Release(std::unique_ptr<StackFramesCollectorBase> collector);
+
+private:
+    ICorProfilerInfo4* _pCorProfilerInfo;
+    IConfiguration const* _pConfiguration;
+    CallstackProvider* _callstackProvider;
+    MetricsRegistry& _metricsRegistry;
+
+    mutable std::mutex _lock;
+    std::vector<std::unique_ptr<StackFramesCollectorBase>> _availableCollectors;
+    std::size_t _createdCount;
+};
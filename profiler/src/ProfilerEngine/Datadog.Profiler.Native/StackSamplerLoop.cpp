@@ -65,7 +65,8 @@ StackSamplerLoop::StackSamplerLoop(
     _codeHotspotsThreadsThreshold{pConfiguration->CodeHotspotsThreadsThreshold()},
     _isWalltimeEnabled{pConfiguration->IsWallTimeProfilingEnabled()},
     _isCpuEnabled{pConfiguration->IsCpuProfilingEnabled() && pConfiguration->GetCpuProfilerType() == CpuProfilerType::ManualCpuTime},
-    _areInternalMetricsEnabled{pConfiguration->IsInternalMetricsEnabled()}
+    _areInternalMetricsEnabled{pConfiguration->IsInternalMetricsEnabled()},
+    _isBatchedWalltimeEnabled{pConfiguration->IsBatchedWalltimeSamplingEnabled()}
 {
     _nbCores = OsSpecificApi::GetProcessorCount();
     Log::Info("Processor cores = ", _nbCores);
@@ -77,6 +78,7 @@ StackSamplerLoop::StackSamplerLoop(
     Log::Info("Max CPU sampled threads = ", _cpuThreadsThreshold);
     Log::Info("Manual Cpu profiler is ", (_isCpuEnabled) ? "enabled" : "disabled");
     Log::Info("Wall-time profiler is ", (_isWalltimeEnabled) ? "enabled" : "disabled");
+    Log::Info("Batched wall-time sampling is ", (_isBatchedWalltimeEnabled) ? "enabled" : "disabled");
 
     _pCorProfilerInfo->AddRef();
 
@@ -227,6 +229,12 @@ void StackSamplerLoop::MainLoopIteration()
 
 void StackSamplerLoop::WalltimeProfilingIteration()
 {
+    if (_isBatchedWalltimeEnabled)
+    {
+        BatchedWalltimeProfilingIteration();
+        return;
+    }
+
     int32_t managedThreadsCount = _pManagedThreadList->Count();
     int32_t sampledThreadsCount = (std::min)(managedThreadsCount, _walltimeThreadsThreshold);
 
@@ -282,6 +290,114 @@ void StackSamplerLoop::WalltimeProfilingIteration()
 
 }
 
+void StackSamplerLoop::BatchedWalltimeProfilingIteration()
+{
+    int32_t managedThreadsCount = _pManagedThreadList->Count();
+    int32_t sampledThreadsCount = (std::min)(managedThreadsCount, _walltimeThreadsThreshold);
+
+    _batchRequests.clear();
+    _batchDurations.clear();
+
+    ManagedThreadInfo* firstThread = nullptr;
+    while (static_cast<int32_t>(_batchRequests.size()) < sampledThreadsCount && !_shutdownRequested)
+    {
+        auto threadInfo = _pManagedThreadList->LoopNext(_iteratorWallTime);
+
+        // either the list is empty or iterator is not in the array range
+        // so prefer bailing out
+        if (threadInfo == nullptr || firstThread == threadInfo.get())
+        {
+            break;
+        }
+
+        if (firstThread == nullptr)
+        {
+            firstThread = threadInfo.get();
+        }
+
+        auto mustSkip =
+#ifdef LINUX
+            !threadInfo->CanBeInterrupted() ||
+#endif
+            // skip thread if it has a trace context
+            threadInfo->HasTraceContext() ||
+            // the OS handle is not associated yet
+            threadInfo->GetOsThreadHandle() == static_cast<HANDLE>(0);
+
+        if (mustSkip)
+        {
+            continue;
+        }
+
+        // The StackSamplerLoopManager may determine that the thread is not fit for a sample collection right now
+        // (recent deadlocks) or it is busy: it will be sampled during the next iteration.
+        // Otherwise, the thread is locked to prevent it from being destroyed while walking its callstack.
+        if (!_pManager->AllowBatchedStackWalk(threadInfo))
+        {
+            continue;
+        }
+
+        auto thisSampleTimestamp = OpSysTools::GetHighPrecisionTimestamp();
+        auto prevSampleTimestamp = threadInfo->SetLastSampleTimestamp(thisSampleTimestamp);
+        _batchDurations.push_back(ComputeWallTime(thisSampleTimestamp, prevSampleTimestamp));
+        _batchRequests.push_back(StackSampleRequest{std::move(threadInfo)});
+    }
+
+    if (_batchRequests.empty())
+    {
+        return;
+    }
+
+    bool isBatchSupported;
+    {
+        on_leave
+        {
+            for (auto& request : _batchRequests)
+            {
+                request.ThreadInfo->ReleaseLock();
+            }
+        };
+
+        // reset the abort request of the previous collection before the watcher can see this one
+        _pStackFramesCollector->PrepareForNextCollection();
+
+        // the manager monitors the whole batch: if it freezes, the collector is asked to abandon it
+        on_leave { _pManager->NotifyBatchCollectionEnd(); };
+        _pManager->NotifyBatchCollectionStart();
+
+        isBatchSupported = _pStackFramesCollector->CollectStackSamples(_batchRequests);
+    }
+
+    auto thisSampleTimestamp = OpSysTools::GetHighPrecisionTimestamp();
+    for (std::size_t i = 0; i < _batchRequests.size(); i++)
+    {
+        auto& request = _batchRequests[i];
+        if (!isBatchSupported)
+        {
+            CollectOneThreadStackSample(request.ThreadInfo, thisSampleTimestamp, _batchDurations[i], PROFILING_TYPE::WallTime);
+            continue;
+        }
+
+        if (request.Stack.Size() == 0)
+        {
+            continue;
+        }
+
+        // add the WallTime sample to the lipddprof pipeline
+        RawWallTimeSample rawSample;
+        rawSample.Timestamp = thisSampleTimestamp;
+        rawSample.LocalRootSpanId = request.LocalRootSpanId;
+        rawSample.SpanId = request.SpanId;
+        rawSample.AppDomainId = request.ThreadInfo->GetAppDomainId();
+        rawSample.Stack = std::move(request.Stack);
+        rawSample.ThreadInfo = request.ThreadInfo;
+        rawSample.Duration = _batchDurations[i];
+        _pWallTimeCollector->Add(std::move(rawSample));
+    }
+
+    _batchRequests.clear();
+}
+
 void StackSamplerLoop::CpuProfilingIteration()
 {
     uint32_t sampledThreads = 0;
@@ -23,6 +23,7 @@
 #include "RawWallTimeSample.h"
 #include "MetricsRegistry.h"
 #include "MeanMaxMetric.h"
+#include "StackFramesCollectorBase.h"
 #include "shared/src/native-src/string.h"
 
 // forward declarations
@@ -92,6 +93,10 @@ private:
     bool _isWalltimeEnabled;
     bool _isCpuEnabled;
     bool _areInternalMetricsEnabled;
+    bool _isBatchedWalltimeEnabled;
+    // reused between iterations to avoid allocations
+    std::vector<StackSampleRequest> _batchRequests;
+    std::vector<std::chrono::nanoseconds> _batchDurations;
     std::shared_ptr<MeanMaxMetric> _walltimeDurationMetric;
     std::shared_ptr<MeanMaxMetric> _cpuDurationMetric;
 
@@ -100,6 +105,7 @@ private:
     void MainLoopIteration();
     void CpuProfilingIteration();
     void WalltimeProfilingIteration();
+    void BatchedWalltimeProfilingIteration();
     void CodeHotspotIteration();
     void CollectOneThreadStackSample(std::shared_ptr<ManagedThreadInfo>& pThreadInfo,
                                      std::chrono::nanoseconds thisSampleTimestampNanosecs,
@@ -50,6 +50,7 @@ StackSamplerLoopManager::StackSamplerLoopManager(
     _pWatcherThread{nullptr},
     _isWatcherShutdownRequested{false},
     _pTargetThread{nullptr},
+    _isBatchCollectionInProgress{false},
     _collectionStartNs{0},
     _isTargetThreadSuspended{false},
     _isForceTerminated{false},
@@ -219,7 +220,12 @@ void StackSamplerLoopManager::WatcherLoopIteration()
     {
         // TODO: Validate that calling resuming again (and again) could unlock the situation.
         // The previous call to ResumeThread failed.
-        if (_deadlockInterventionInProgress == 1)
+        if (_deadlockInterventionInProgress == 1 && _isBatchCollectionInProgress)
+        {
+            _deadlockInterventionInProgress++;
+            Log::Info("StackSamplerLoopManager::WatcherLoopIteration - Deadlock intervention still in progress for a batch of threads");
+        }
+        else if (_deadlockInterventionInProgress == 1)
         {
             _deadlockInterventionInProgress++;
             Log::Info("StackSamplerLoopManager::WatcherLoopIteration - Deadlock intervention still in progress for thread ", _pTargetThread->GetOsThreadId(),
@@ -283,6 +289,12 @@ bool StackSamplerLoopManager::HasMadeProgress(FILETIME userTime, FILETIME kernel
 
 void StackSamplerLoopManager::PerformDeadlockIntervention(const std::chrono::nanoseconds& ongoingStackSampleCollectionDurationNs)
 {
+    if (_isBatchCollectionInProgress)
+    {
+        PerformBatchDeadlockIntervention(ongoingStackSampleCollectionDurationNs);
+        return;
+    }
+
     _deadlockInterventionInProgress = 1;
 
     // ! ! ! ! ! ! ! ! ! ! !
@@ -326,6 +338,28 @@ void StackSamplerLoopManager::PerformDeadlockIntervention(const std::chrono::nan
     // The sampled thread has been resumed. The lock blocking the stack sampler loop should be released anytime soon.
 }
 
+void StackSamplerLoopManager::PerformBatchDeadlockIntervention(const std::chrono::nanoseconds& ongoingStackSampleCollectionDurationNs)
+{
+    _deadlockInterventionInProgress = 1;
+
+    // This private method is invoked by WatcherLoopIteration() while holding the _watcherActivityLock.
+    //
+    // The threads of a batch are not suspended: each one walks its own callstack from a signal handler.
+    // There is no target thread to resume, so the collector is asked to abandon the batch instead.
+    // The deadlock counts for the whole period: too many of them will stop the collections.
+    _deadlocksInPeriod++;
+    _totalDeadlockDetectionsCount++;
+
+    _pStackFramesCollector->RequestAbortCurrentCollection();
+
+    Log::Info("StackSamplerLoopManager::PerformBatchDeadlockIntervention(): The ongoing batched StackSampleCollection duration crossed the threshold."
+              " The batch is abandoned;"
+              " ongoingStackSampleCollectionDurationNs=", ToMillis(ongoingStackSampleCollectionDurationNs), " millisecs;",
+              " _currentPeriod=", _currentPeriod, ";",
+              " _deadlocksInPeriod=", _deadlocksInPeriod, ";",
+              " _totalDeadlockDetectionsCount=", _totalDeadlockDetectionsCount, ".");
+}
+
 void StackSamplerLoopManager::LogDeadlockIntervention(const std::chrono::nanoseconds& ongoingStackSampleCollectionDurationNs,
                                                       bool wasThreadSafeForStackSampleCollection,
                                                       bool isThreadSafeForStackSampleCollection,
@@ -404,12 +438,12 @@ double StackSamplerLoopManager::ToMillis(const std::chrono::nanoseconds& nanosec
     return nanosecs.count() / 1000000.0;
 }
 
-bool StackSamplerLoopManager::AllowStackWalk(std::shared_ptr<ManagedThreadInfo> pThreadInfo)
+bool StackSamplerLoopManager::IsThreadSafeForStackWalk(ManagedThreadInfo* pThreadInfo, const char* caller)
 {
-    std::lock_guard<std::mutex> guardedLock(_watcherActivityLock);
+    // This method must only be called while _watcherActivityLock is held!
 
     bool isThreadSafeStatusChanged;
-    bool isThreadSafeForStackSampleCollection = GetUpdateIsThreadSafeForStackSampleCollection(pThreadInfo.get(), &isThreadSafeStatusChanged);
+    bool isThreadSafeForStackSampleCollection = GetUpdateIsThreadSafeForStackSampleCollection(pThreadInfo, &isThreadSafeStatusChanged);
 
     if (isThreadSafeStatusChanged)
     {
@@ -421,7 +455,7 @@ bool StackSamplerLoopManager::AllowStackWalk(std::shared_ptr<ManagedThreadInfo>
                                        &threadUsedDeadlocksAggPeriodIndex);
 
         // At that step, the target thread is not suspended so no deadlock risk when logging
-        Log::Info("ShouldCollectThread status changed in AllowStackWalk",
+        Log::Info("ShouldCollectThread status changed in ", caller,
                   " for thread (OsThreadId=", pThreadInfo->GetOsThreadId(),
                   ", ClrThreadId=0x", std::hex, pThreadInfo->GetClrThreadId(), std::dec,
                   ", ThreadName=\"", pThreadInfo->GetThreadName(), "\"):",
@@ -432,8 +466,14 @@ bool StackSamplerLoopManager::AllowStackWalk(std::shared_ptr<ManagedThreadInfo>
                   " _deadlocksInPeriod=", _deadlocksInPeriod, ".");
     }
 
+    return isThreadSafeForStackSampleCollection;
+}
 
-    if (!isThreadSafeForStackSampleCollection)
+bool StackSamplerLoopManager::AllowStackWalk(std::shared_ptr<ManagedThreadInfo> pThreadInfo)
+{
+    std::lock_guard<std::mutex> guardedLock(_watcherActivityLock);
+
+    if (!IsThreadSafeForStackWalk(pThreadInfo.get(), "AllowStackWalk"))
     {
         return false;
     }
@@ -458,6 +498,49 @@ bool StackSamplerLoopManager::AllowStackWalk(std::shared_ptr<ManagedThreadInfo>
     return true;
 }
 
+bool StackSamplerLoopManager::AllowBatchedStackWalk(std::shared_ptr<ManagedThreadInfo> const& pThreadInfo)
+{
+    std::lock_guard<std::mutex> guardedLock(_watcherActivityLock);
+
+    if (!IsThreadSafeForStackWalk(pThreadInfo.get(), "AllowBatchedStackWalk"))
+    {
+        return false;
+    }
+
+    // Same as AllowStackWalk: prevent the thread from being destroyed while walking its callstack
+    // but do not wait for a busy thread: it will be sampled during the next iteration
+    if (!pThreadInfo->TryAcquireLock())
+    {
+        return false;
+    }
+
+    if (pThreadInfo->IsDestroyed())
+    {
+        pThreadInfo->ReleaseLock();
+        return false;
+    }
+
+    return true;
+}
+
+void StackSamplerLoopManager::NotifyBatchCollectionStart()
+{
+    {
+        std::lock_guard<std::mutex> guardedLock(_watcherActivityLock);
+        _isBatchCollectionInProgress = true;
+    }
+
+    NotifyCollectionStart();
+}
+
+void StackSamplerLoopManager::NotifyBatchCollectionEnd()
+{
+    NotifyCollectionEnd();
+
+    std::lock_guard<std::mutex> guardedLock(_watcherActivityLock);
+    _isBatchCollectionInProgress = false;
+}
+
 void StackSamplerLoopManager::NotifyThreadState(bool isSuspended)
 {
     std::lock_guard<std::mutex> guardedLock(_watcherActivityLock);
@@ -98,11 +98,15 @@ public:
     void NotifyCollectionStart() override;
     void NotifyCollectionEnd() override;
     void NotifyIterationFinished() override;
+    bool AllowBatchedStackWalk(std::shared_ptr<ManagedThreadInfo> const& pThreadInfo) override;
+    void NotifyBatchCollectionStart() override;
+    void NotifyBatchCollectionEnd() override;
 
 private:
     StackSamplerLoopManager() = delete;
 
     inline bool GetUpdateIsThreadSafeForStackSampleCollection(ManagedThreadInfo* pThreadInfo, bool* pIsStatusChanged);
+    bool IsThreadSafeForStackWalk(ManagedThreadInfo* pThreadInfo, const char* caller);
     static inline bool ShouldCollectThread(std::uint64_t threadAggPeriodDeadlockCount, std::uint64_t globalAggPeriodDeadlockCount) ;
 
     void InitializeSampler();
@@ -113,6 +117,7 @@ private:
     void WatcherLoop();
     void WatcherLoopIteration();
     void PerformDeadlockIntervention(const std::chrono::nanoseconds& ongoingStackSampleCollectionDurationNs);
+    void PerformBatchDeadlockIntervention(const std::chrono::nanoseconds& ongoingStackSampleCollectionDurationNs);
     void LogDeadlockIntervention(
         const std::chrono::nanoseconds& ongoingStackSampleCollectionDurationNs,
         bool wasThreadSafeForStackSampleCollection,
@@ -219,6 +224,8 @@ private:
     std::mutex _watcherActivityLock;
 
     std::shared_ptr<ManagedThreadInfo> _pTargetThread;
+    // a batch of threads is walked at once: there is no single target thread
+    bool _isBatchCollectionInProgress;
     std::int64_t _collectionStartNs;
     FILETIME _kernelTime, _userTime;
 
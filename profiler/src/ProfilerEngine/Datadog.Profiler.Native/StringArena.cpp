@@ -0,0 +1,112 @@
+// Unless explicitly stated otherwise all files in this repository are licensed under the Apache 2 License.
+// This product includes software developed at Datadog (https://www.datadoghq.com/). Copyright 2025 Datadog, Inc.
+
+#include "StringArena.h"
+
+#include <cstring>
+
+StringArena::StringArena(std::size_t blockSize) :
+    _blockSize{blockSize},
+    _current{nullptr},
+    _remaining{0},
+    _reservedSize{0},
+    _usedSize{0}
+{
+}
+
+std::string_view StringArena::Allocate(std::string_view value)
+{
+    std::lock_guard<std::mutex> lock(_lock);
+
+    return AllocateUnsafe(value);
+}
+
+std::string_view StringArena::Intern(std::string_view value)
+{
+    std::lock_guard<std::mutex> lock(_lock);
+
+    auto it = _interned.find(value);
+    if (it != _interned.end())
+    {
+        return *it;
+    }
+
+    auto stored = AllocateUnsafe(value);
+    _interned.insert(stored);
+    return stored;
+}
+
+std::string_view StringArena::AllocateUnsafe(std::string_view value)
+{
+    if (value.empty())
+    {
+        return {};
+    }
+
+    // keep a trailing '\0' so that the stored strings can also be used as C strings
+    auto size = value.size() + 1;
+
+    if (size > _remaining)
+    {
+        // large strings get their own block to avoid wasting the end of the current one
+        if (size > _blockSize / 4)
+        {
+            auto block = std::make_unique<char[]>(size);
+            auto* buffer = block.get();
+            _blocks.push_back(std::move(block));
+            _reservedSize += size;
+            _usedSize += size;
+
+            std::memcpy(buffer, value.data(), value.size());
+            buffer[value.size()] = '\0';
+            return {buffer, value.size()};
+        }
+
+        auto block = std::make_unique<char[]>(_blockSize);
+        _current = block.get();
+        _remaining = _blockSize;
+        _blocks.push_back(std::move(block));
+        _reservedSize += _blockSize;
+    }
+
+    auto* buffer = _current;
+    std::memcpy(buffer, value.data(), value.size());
+    buffer[value.size()] = '\0';
+
+    _current += size;
+    _remaining -= size;
+    _usedSize += size;
+
+    return {buffer, value.size()};
+}
+
+std::size_t StringArena::GetMemorySize() const
+{
+    std::lock_guard<std::mutex> lock(_lock);
+
+    return sizeof(StringArena) +
+           _reservedSize +
+           _blocks.capacity() * sizeof(std::unique_ptr<char[]>) +
+           _interned.bucket_count() * (sizeof(std::string_view) + sizeof(void*));
+}
+
+std::size_t StringArena::GetUsedSize() const
+{
+    std::lock_guard<std::mutex> lock(_lock);
+
+    return _usedSize;
+}
+
+std::size_t StringArena::GetBlocksCount() const
+{
+    std::lock_guard<std::mutex> lock(_lock);
+
+    return _blocks.size();
+}
+
+std::size_t StringArena::GetInternedCount() const
+{
+    std::lock_guard<std::mutex> lock(_lock);
+
+    return _interned.size();
+}
@@ -0,0 +1,51 @@
+// Unless explicitly stated otherwise all files in this repository are licensed under the Apache 2 License.
+// This product includes software developed at Datadog (https://www.datadoghq.com/). Copyright 2025 Datadog, Inc.
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+// Append-only pool of strings allocated in large blocks.
+// The returned string_views stay valid until the arena is destroyed: strings are never freed
+// one by one, which avoids the per-string heap allocations (and fragmentation) of std::string.
+class StringArena
+{
+public:
+    static constexpr std::size_t DefaultBlockSize = 64 * 1024;
+
+public:
+    explicit StringArena(std::size_t blockSize = DefaultBlockSize);
+
+    StringArena(StringArena const&) = delete;
+    StringArena& operator=(StringArena const&) = delete;
+
+    // copy the given string into the arena
+    std::string_view Allocate(std::string_view value);
+
+    // same as Allocate but the same string is stored only once
+    // (used for module/assembly names and namespaces shared by many frames)
+    std::string_view Intern(std::string_view value);
+
+    std::size_t GetMemorySize() const;
+    std::size_t GetUsedSize() const;
+    std::size_t GetBlocksCount() const;
+    std::size_t GetInternedCount() const;
+
+private:
+    std::string_view AllocateUnsafe(std::string_view value);
+
+private:
+    mutable std::mutex _lock;
+    std::size_t _blockSize;
+    std::vector<std::unique_ptr<char[]>> _blocks;
+    char* _current;
+    std::size_t _remaining;
+    std::size_t _reservedSize;
+    std::size_t _usedSize;
+    std::unordered_set<std::string_view> _interned;
+};
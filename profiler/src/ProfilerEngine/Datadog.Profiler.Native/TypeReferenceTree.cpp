@@ -0,0 +1,216 @@
+// Unless explicitly stated otherwise all files in this repository are licensed under the Apache 2 License.
+// This product includes software developed at Datadog (https://www.datadoghq.com/). Copyright 2022 Datadog, Inc.
+
+#include "TypeReferenceTree.h"
+
+#include <algorithm>
+#include <cassert>
+
+TypeReferenceTree::TypeReferenceTree() :
+    _nodeCount(0),
+    _childSlotsCount(0)
+{
+}
+
+TypeTreeNode* TypeReferenceTree::AddRoot(ClassID typeID, RootCategory category, uint64_t size, const WCHAR* fieldName)
+{
+    RootKey key{typeID, category};
+    auto [it, inserted] = _roots.try_emplace(key, nullptr);
+    if (inserted)
+    {
+        it->second = std::make_unique<TypeRootNode>(typeID, category);
+    }
+    it->second->AddInstance(size, fieldName);
+    return &it->second->node;
+}
+
+TypeTreeNode* TypeReferenceTree::GetOrCreateChild(TypeTreeNode* parent, ClassID childTypeID)
+{
+    if (parent->childCount <= MaxChainedChildren)
+    {
+        for (auto index = parent->firstChild; index != TypeTreeNode::NoNode;)
+        {
+            auto& child = NodeAt(index);
+            if (child.typeID == childTypeID)
+            {
+                return &child;
+            }
+            index = child.nextSibling;
+        }
+    }
+    else
+    {
+        auto* slot = FindChildSlot(parent, childTypeID);
+        if (slot->parent != nullptr)
+        {
+            return &NodeAt(slot->child);
+        }
+    }
+
+    auto childIndex = AllocateNode(childTypeID);
+    auto& child = NodeAt(childIndex);
+    child.nextSibling = parent->firstChild;
+    parent->firstChild = childIndex;
+    parent->childCount++;
+
+    if (parent->childCount == MaxChainedChildren + 1)
+    {
+        // too many children to walk the chain: index all of them
+        for (auto index = parent->firstChild; index != TypeTreeNode::NoNode; index = GetNode(index).nextSibling)
+        {
+            AddChildSlot(parent, GetNode(index).typeID, index);
+        }
+    }
+    else if (parent->childCount > MaxChainedChildren + 1)
+    {
+        AddChildSlot(parent, childTypeID, childIndex);
+    }
+
+    return &child;
+}
+
+const TypeTreeNode* TypeReferenceTree::GetChild(const TypeTreeNode* parent, ClassID childTypeID) const
+{
+    if (parent->childCount > MaxChainedChildren)
+    {
+        auto* slot = FindChildSlot(parent, childTypeID);
+        return (slot->parent != nullptr) ? &GetNode(slot->child) : nullptr;
+    }
+
+    for (auto index = parent->firstChild; index != TypeTreeNode::NoNode;)
+    {
+        auto& child = GetNode(index);
+        if (child.typeID == childTypeID)
+        {
+            return &child;
+        }
+        index = child.nextSibling;
+    }
+
+    return nullptr;
+}
+
+void TypeReferenceTree::Merge(const TypeReferenceTree& other)
+{
+    for (auto const& [key, otherRoot] : other._roots)
+    {
+        auto [it, inserted] = _roots.try_emplace(key, nullptr);
+        if (inserted)
+        {
+            it->second = std::make_unique<TypeRootNode>(key.typeID, key.category);
+        }
+
+        auto& root = *it->second;
+        if (root.fieldName.empty())
+        {
+            root.fieldName = otherRoot->fieldName;
+        }
+        MergeNode(&root.node, other, otherRoot->node);
+    }
+}
+
+void TypeReferenceTree::MergeNode(TypeTreeNode* node, const TypeReferenceTree& other, const TypeTreeNode& otherNode)
+{
+    node->instanceCount += otherNode.instanceCount;
+    node->totalSize += otherNode.totalSize;
+
+    // the depth is bounded by MaxTreeDepth (plus the inline value types levels)
+    for (auto index = otherNode.firstChild; index != TypeTreeNode::NoNode;)
+    {
+        auto const& otherChild = other.GetNode(index);
+        MergeNode(GetOrCreateChild(node, otherChild.typeID), other, otherChild);
+        index = otherChild.nextSibling;
+    }
+}
+
+uint32_t TypeReferenceTree::AllocateNode(ClassID typeID)
+{
+    assert(_nodeCount != TypeTreeNode::NoNode);
+
+    if ((_nodeCount & (ChunkSize - 1)) == 0)
+    {
+        auto& chunk = _chunks.emplace_back();
+        chunk.reserve(ChunkSize);
+    }
+
+    _chunks.back().emplace_back(typeID);
+    return _nodeCount++;
+}
+
+const TypeReferenceTree::ChildSlot* TypeReferenceTree::FindChildSlot(const TypeTreeNode* parent, ClassID typeID) const
+{
+    // called only for parents with indexed children: the table is never empty
+    auto mask = _childSlots.size() - 1;
+    // both the parent and the type are pointers: drop the alignment bits before mixing
+    uint64_t hash = (static_cast<uint64_t>(reinterpret_cast<uintptr_t>(parent)) >> 3) * 0x9E3779B97F4A7C15ull;
+    hash ^= (static_cast<uint64_t>(typeID) >> 3) * 0xC2B2AE3D27D4EB4Full;
+    auto index = static_cast<size_t>(hash ^ (hash >> 29)) & mask;
+
+    while (true)
+    {
+        auto const& slot = _childSlots[index];
+        if (slot.parent == nullptr || (slot.parent == parent && slot.typeID == typeID))
+        {
+            return &slot;
+        }
+        index = (index + 1) & mask;
+    }
+}
+
+void TypeReferenceTree::AddChildSlot(const TypeTreeNode* parent, ClassID typeID, uint32_t child)
+{
+    // keep the load factor under 50% to have short probe sequences
+    if ((_childSlotsCount + 1) * 2 > _childSlots.size())
+    {
+        GrowChildSlots();
+    }
+
+    auto* slot = const_cast<ChildSlot*>(FindChildSlot(parent, typeID));
+    *slot = ChildSlot{parent, typeID, child};
+    _childSlotsCount++;
+}
+
+void TypeReferenceTree::GrowChildSlots()
+{
+    std::vector<ChildSlot> oldSlots(std::max<size_t>(_childSlots.size() * 2, 256), ChildSlot{nullptr, 0, 0});
+    oldSlots.swap(_childSlots);
+
+    for (auto const& slot : oldSlots)
+    {
+        if (slot.parent != nullptr)
+        {
+            *const_cast<ChildSlot*>(FindChildSlot(slot.parent, slot.typeID)) = slot;
+        }
+    }
+}
+
+size_t TypeReferenceTree::GetMemorySize() const
+{
+    size_t size = sizeof(TypeReferenceTree);
+
+    size += _chunks.capacity() * sizeof(std::vector<TypeTreeNode>);
+    size += _chunks.size() * ChunkSize * sizeof(TypeTreeNode);
+    size += _childSlots.capacity() * sizeof(ChildSlot);
+
+    size += _roots.bucket_count() * sizeof(void*);
+    for (auto const& [key, root] : _roots)
+    {
+        size += sizeof(RootKey) + sizeof(std::unique_ptr<TypeRootNode>) + sizeof(TypeRootNode) + root->fieldName.capacity();
+    }
+
+    return size;
+}
+
+void TypeReferenceTree::Clear()
+{
+    _roots.clear();
+
+    // give the memory back between snapshots
+    _chunks.clear();
+    _chunks.shrink_to_fit();
+    _nodeCount = 0;
+
+    _childSlots.clear();
+    _childSlots.shrink_to_fit();
+    _childSlotsCount = 0;
+}
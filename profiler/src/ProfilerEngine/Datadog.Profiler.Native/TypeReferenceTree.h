@@ -10,6 +10,7 @@
 #include <unordered_map>
 #include <memory>
 #include <string>
+#include <vector>
 #include <cstdint>
 
 // Maximum depth for tree traversal to prevent pathological cases
@@ -21,17 +22,30 @@ static constexpr uint32_t MaxTreeDepth = 128;
 // Each node represents a type AT A SPECIFIC POSITION in a reference chain.
 // The same ClassID can appear at multiple positions (different nodes).
 // For example: TypeA -> TypeB -> TypeA -> TypeC produces 4 nodes.
+//
+// Nodes are allocated by the TypeReferenceTree in chunks (they never move) and refer to each
+// other by 32-bit index: the children of a node are chained through their nextSibling.
+// Use TypeReferenceTree::GetOrCreateChild/GetChild/GetNode to navigate the tree.
 struct TypeTreeNode
 {
+    static constexpr uint32_t NoNode = UINT32_MAX;
+
     ClassID typeID;
     uint64_t instanceCount;  // How many instances at this tree position
     uint64_t totalSize;      // Aggregate size of instances at this position
 
-    // Children keyed by ClassID.
     // Multiple instances flowing through the same type path merge into one child node.
-    std::unordered_map<ClassID, std::unique_ptr<TypeTreeNode>> children;
-
-    TypeTreeNode(ClassID id) : typeID(id), instanceCount(0), totalSize(0)
+    uint32_t firstChild;
+    uint32_t nextSibling;
+    uint32_t childCount;
+
+    TypeTreeNode(ClassID id) :
+        typeID(id),
+        instanceCount(0),
+        totalSize(0),
+        firstChild(NoNode),
+        nextSibling(NoNode),
+        childCount(0)
     {
     }
 
@@ -40,24 +54,6 @@ struct TypeTreeNode
         instanceCount++;
         totalSize += size;
     }
-
-    // Get or create a child node for the given type.
-    TypeTreeNode* GetOrCreateChild(ClassID childTypeID)
-    {
-        auto [it, inserted] = children.try_emplace(childTypeID, nullptr);
-        if (inserted)
-        {
-            it->second = std::make_unique<TypeTreeNode>(childTypeID);
-        }
-        return it->second.get();
-    }
-
-    // Get an existing child node (returns nullptr if not found).
-    const TypeTreeNode* GetChild(ClassID childTypeID) const
-    {
-        auto it = children.find(childTypeID);
-        return it != children.end() ? it->second.get() : nullptr;
-    }
 };
 
 
@@ -110,23 +106,36 @@ struct TypeRootNode
 // Complete type reference tree.
 // Roots are keyed by (ClassID, RootCategory) so the same type can appear
 // as distinct roots for different categories (e.g. byte[] as Pinning vs Stack).
+//
+// A heap snapshot creates millions of nodes while the runtime is suspended: instead of
+// a heap allocated node + children map per node, the nodes are bump allocated in chunks
+// and the children of a node are found by walking its sibling chain. Nodes with many
+// children (arrays of objects, dictionaries) are also indexed in an open addressing
+// table shared by the whole tree.
 class TypeReferenceTree
 {
 public:
     std::unordered_map<RootKey, std::unique_ptr<TypeRootNode>, RootKeyHash> _roots;
 
+    TypeReferenceTree();
+
     // Add or update a root for the given (type, category).
     // Returns a pointer to the root's TypeTreeNode for use during traversal.
-    TypeTreeNode* AddRoot(ClassID typeID, RootCategory category, uint64_t size, const WCHAR* fieldName = nullptr)
+    TypeTreeNode* AddRoot(ClassID typeID, RootCategory category, uint64_t size, const WCHAR* fieldName = nullptr);
+
+    // Get or create the child node of the given type.
+    // The returned pointer stays valid until the tree is cleared.
+    TypeTreeNode* GetOrCreateChild(TypeTreeNode* parent, ClassID childTypeID);
+
+    // Get an existing child node (returns nullptr if not found).
+    const TypeTreeNode* GetChild(const TypeTreeNode* parent, ClassID childTypeID) const;
+
+    // Add the roots and nodes of another tree (built by a traversal worker) to this one.
+    void Merge(const TypeReferenceTree& other);
+
+    const TypeTreeNode& GetNode(uint32_t index) const
     {
-        RootKey key{typeID, category};
-        auto [it, inserted] = _roots.try_emplace(key, nullptr);
-        if (inserted)
-        {
-            it->second = std::make_unique<TypeRootNode>(typeID, category);
-        }
-        it->second->AddInstance(size, fieldName);
-        return &it->second->node;
+        return _chunks[index >> ChunkShift][index & (ChunkSize - 1)];
     }
 
     bool IsEmpty() const
@@ -134,8 +143,48 @@ public:
         return _roots.empty();
     }
 
-    void Clear()
+    uint32_t GetNodeCount() const
     {
-        _roots.clear();
+        return _nodeCount;
     }
+
+    // Memory used by the tree (nodes, children index and roots)
+    size_t GetMemorySize() const;
+
+    void Clear();
+
+private:
+    // Each chunk holds 4096 nodes (160 KB)
+    static constexpr uint32_t ChunkShift = 12;
+    static constexpr uint32_t ChunkSize = 1 << ChunkShift;
+
+    // Beyond this number of children, a node is indexed in _childSlots
+    static constexpr uint32_t MaxChainedChildren = 8;
+
+    struct ChildSlot
+    {
+        const TypeTreeNode* parent; // nullptr for an empty slot
+        ClassID typeID;
+        uint32_t child;
+    };
+
+    TypeTreeNode& NodeAt(uint32_t index)
+    {
+        return _chunks[index >> ChunkShift][index & (ChunkSize - 1)];
+    }
+
+    uint32_t AllocateNode(ClassID typeID);
+    void MergeNode(TypeTreeNode* node, const TypeReferenceTree& other, const TypeTreeNode& otherNode);
+    const ChildSlot* FindChildSlot(const TypeTreeNode* parent, ClassID typeID) const;
+    void AddChildSlot(const TypeTreeNode* parent, ClassID typeID, uint32_t child);
+    void GrowChildSlots();
+
+private:
+    // never reallocated once created: the nodes do not move
+    std::vector<std::vector<TypeTreeNode>> _chunks;
+    uint32_t _nodeCount;
+
+    // open addressing (linear probing) table of (parent, type) -> child
+    std::vector<ChildSlot> _childSlots;
+    size_t _childSlotsCount;
 };
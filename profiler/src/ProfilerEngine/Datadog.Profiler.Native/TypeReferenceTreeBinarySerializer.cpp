@@ -39,11 +39,7 @@ std::vector<uint8_t> TypeReferenceTreeBinarySerializer::Serialize(const TypeRefe
 
         WriteString(body, rootNode->fieldName);
 
-        WriteVarint(body, rootNode->node.children.size());
-        for (const auto& [childTypeID, childNode] : rootNode->node.children)
-        {
-            WriteNode(*childNode, types, body);
-        }
+        WriteChildren(tree, rootNode->node, types, body);
     }
 
     // Phase 2: assemble header + string table + body
@@ -97,7 +93,7 @@ uint32_t TypeReferenceTreeBinarySerializer::RegisterType(StringTable& types, Cla
     return it->second;
 }
 
-void TypeReferenceTreeBinarySerializer::WriteNode(const TypeTreeNode& node, StringTable& types, std::vector<uint8_t>& out)
+void TypeReferenceTreeBinarySerializer::WriteNode(const TypeReferenceTree& tree, const TypeTreeNode& node, StringTable& types, std::vector<uint8_t>& out)
 {
     auto typeIndex = RegisterType(types, node.typeID);
 
@@ -105,10 +101,17 @@ void TypeReferenceTreeBinarySerializer::WriteNode(const TypeTreeNode& node, Stri
     WriteVarint(out, node.instanceCount);
     WriteVarint(out, node.totalSize);
 
-    WriteVarint(out, node.children.size());
-    for (const auto& [childTypeID, childNode] : node.children)
+    WriteChildren(tree, node, types, out);
+}
+
+void TypeReferenceTreeBinarySerializer::WriteChildren(const TypeReferenceTree& tree, const TypeTreeNode& node, StringTable& types, std::vector<uint8_t>& out)
+{
+    WriteVarint(out, node.childCount);
+    for (auto index = node.firstChild; index != TypeTreeNode::NoNode;)
     {
-        WriteNode(*childNode, types, out);
+        const auto& child = tree.GetNode(index);
+        WriteNode(tree, child, types, out);
+        index = child.nextSibling;
     }
 }
 
@@ -48,5 +48,6 @@ private:
     // qualified name to the already encoded string table on first encounter.
     static uint32_t RegisterType(StringTable& types, ClassID typeID);
 
-    static void WriteNode(const TypeTreeNode& node, StringTable& types, std::vector<uint8_t>& out);
+    static void WriteNode(const TypeReferenceTree& tree, const TypeTreeNode& node, StringTable& types, std::vector<uint8_t>& out);
+    static void WriteChildren(const TypeReferenceTree& tree, const TypeTreeNode& node, StringTable& types, std::vector<uint8_t>& out);
 };
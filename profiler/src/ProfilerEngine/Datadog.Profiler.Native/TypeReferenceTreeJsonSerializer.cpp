@@ -62,21 +62,7 @@ std::string TypeReferenceTreeJsonSerializer::Serialize(const TypeReferenceTree&
             rootsJson += '"';
         }
 
-        if (!rootNode->node.children.empty())
-        {
-            rootsJson += ",\"ch\":[";
-            bool firstChild = true;
-            for (const auto& [childTypeID, childNode] : rootNode->node.children)
-            {
-                if (!firstChild)
-                {
-                    rootsJson += ',';
-                }
-                firstChild = false;
-                OutputNode(*childNode, types, rootsJson);
-            }
-            rootsJson += ']';
-        }
+        OutputChildren(tree, rootNode->node, types, rootsJson);
         rootsJson += '}';
     }
 
@@ -143,7 +129,7 @@ uint32_t TypeReferenceTreeJsonSerializer::RegisterType(TypeTable& types, ClassID
     return it->second;
 }
 
-void TypeReferenceTreeJsonSerializer::OutputNode(const TypeTreeNode& node, TypeTable& types, std::string& out)
+void TypeReferenceTreeJsonSerializer::OutputNode(const TypeReferenceTree& tree, const TypeTreeNode& node, TypeTable& types, std::string& out)
 {
     // B3+B4: Lazily register type on first encounter (single lookup via try_emplace)
     auto typeIndex = RegisterType(types, node.typeID);
@@ -162,23 +148,31 @@ void TypeReferenceTreeJsonSerializer::OutputNode(const TypeTreeNode& node, TypeT
         AppendUInt64(out, node.totalSize);
     }
 
-    if (!node.children.empty())
+    OutputChildren(tree, node, types, out);
+
+    out += '}';
+}
+
+void TypeReferenceTreeJsonSerializer::OutputChildren(const TypeReferenceTree& tree, const TypeTreeNode& node, TypeTable& types, std::string& out)
+{
+    if (node.firstChild == TypeTreeNode::NoNode)
     {
-        out += ",\"ch\":[";
-        bool firstChild = true;
-        for (const auto& [childTypeID, childNode] : node.children)
+        return;
+    }
+
+    out += ",\"ch\":[";
+    for (auto index = node.firstChild; index != TypeTreeNode::NoNode;)
+    {
+        if (index != node.firstChild)
         {
-            if (!firstChild)
-            {
-                out += ',';
-            }
-            firstChild = false;
-            OutputNode(*childNode, types, out);
+            out += ',';
         }
-        out += ']';
-    }
 
-    out += '}';
+        const auto& child = tree.GetNode(index);
+        OutputNode(tree, child, types, out);
+        index = child.nextSibling;
+    }
+    out += ']';
 }
 
 // Single-letter root category codes in JSON ("c" field). K=stack, S=static, O=other (see RootCategory).
@@ -44,7 +44,10 @@ private:
     static uint32_t RegisterType(TypeTable& types, ClassID typeID);
 
     // Single-pass tree walk: collects types lazily and emits JSON in one traversal.
-    static void OutputNode(const TypeTreeNode& node, TypeTable& types, std::string& out);
+    static void OutputNode(const TypeReferenceTree& tree, const TypeTreeNode& node, TypeTable& types, std::string& out);
+
+    // Emits the "ch" array of the node (nothing for a leaf).
+    static void OutputChildren(const TypeReferenceTree& tree, const TypeTreeNode& node, TypeTable& types, std::string& out);
 
     static const char* GetRootCategoryCode(RootCategory category);
 
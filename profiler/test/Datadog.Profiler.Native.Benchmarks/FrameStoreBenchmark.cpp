@@ -0,0 +1,52 @@
+// Unless explicitly stated otherwise all files in this repository are licensed under the Apache 2 License.
+// This product includes software developed at Datadog (https://www.datadoghq.com/). Copyright 2025 Datadog, Inc.
+
+#include "benchmark/benchmark.h"
+
+#include "FrameStore.h"
+#include "JittedCodeFixture.h"
+
+#include <vector>
+
+namespace {
+
+constexpr std::size_t FunctionsCount = 20'000;
+constexpr std::size_t InstructionPointersCount = 4096;
+
+} // namespace
+
+// Resolution of the frames of a callstack by the samples collector thread.
+// The mocked ICorProfilerInfo does not provide metadata: a managed frame goes through the
+// ManagedCodeCache lookup and the FrameStore cache miss path and native frames are filtered out.
+static void BM_FrameStore_GetFrame(benchmark::State& state)
+{
+    JittedCodeFixture jittedCode(FunctionsCount);
+    FrameStore frameStore(jittedCode.GetProfilerInfo(), nullptr, nullptr, &jittedCode.GetCache());
+
+    auto ips = JittedCodeFixture::CreateInstructionPointers(FunctionsCount, InstructionPointersCount, state.range(0));
+
+    std::size_t current = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(frameStore.GetFrame(ips[current]));
+        current = (current + 1) % InstructionPointersCount;
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FrameStore_GetFrame)->ArgName("native%")->Arg(0)->Arg(20)->Arg(100);
+
+// Synthetic frames (lock contention, allocation, ...) added to the callstacks
+static void BM_FrameStore_GetFrame_FakeIP(benchmark::State& state)
+{
+    JittedCodeFixture jittedCode(1);
+    FrameStore frameStore(jittedCode.GetProfilerInfo(), nullptr, nullptr, &jittedCode.GetCache());
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(frameStore.GetFrame(FrameStore::FakeLockContentionIP));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FrameStore_GetFrame_FakeIP);
@@ -0,0 +1,135 @@
+// Unless explicitly stated otherwise all files in this repository are licensed under the Apache 2 License.
+// This product includes software developed at Datadog (https://www.datadoghq.com/). Copyright 2025 Datadog, Inc.
+
+#include "JittedCodeFixture.h"
+
+#include <chrono>
+#include <random>
+
+using namespace std::chrono_literals;
+using ::testing::_;
+
+namespace {
+
+// FunctionIDs are addresses of MethodDesc in the runtime
+constexpr FunctionID FirstFunctionId = 0x7f2000000000;
+constexpr FunctionID FunctionIdStep = 0x40;
+
+// Methods code is between 64 bytes and 4KB, aligned on 16 bytes
+constexpr uintptr_t MaxCodeSize = 4096;
+
+FunctionID GetFunctionId(std::size_t index)
+{
+    return FirstFunctionId + index * FunctionIdStep;
+}
+
+std::size_t GetFunctionIndex(FunctionID functionId)
+{
+    return (functionId - FirstFunctionId) / FunctionIdStep;
+}
+
+} // namespace
+
+JittedCodeFixture::JittedCodeFixture(std::size_t functionsCount) :
+    _pProfilerInfo{new ::testing::NiceMock<MockProfilerInfo>()},
+    _functionsCount{functionsCount},
+    _stopJitting{false}
+{
+    ON_CALL(*_pProfilerInfo, GetCodeInfo2(_, _, _, _))
+        .WillByDefault([this](FunctionID functionId, ULONG32 cCodeInfos, ULONG32* pcCodeInfos, COR_PRF_CODE_INFO codeInfos[]) {
+            *pcCodeInfos = 1;
+            if (cCodeInfos != 0)
+            {
+                auto range = GetCodeRange(functionId);
+                codeInfos[0].startAddress = range.Start;
+                codeInfos[0].size = range.Size;
+            }
+            return S_OK;
+        });
+
+    _cache = std::make_unique<ManagedCodeCache>(_pProfilerInfo);
+    _cache->Initialize();
+
+    AddFunctionsAndWait(0, functionsCount);
+}
+
+JittedCodeFixture::~JittedCodeFixture()
+{
+    StopJitting();
+
+    _cache.reset();
+    _pProfilerInfo->Release();
+}
+
+JittedCodeFixture::CodeRange JittedCodeFixture::GetCodeRange(FunctionID functionId)
+{
+    // deterministic layout: the size of a method only depends on its index
+    auto index = GetFunctionIndex(functionId);
+    auto size = static_cast<ULONG32>((64 + (index * 2654435761u) % (MaxCodeSize - 64)) & ~uintptr_t{0xF});
+    return {CodeHeapStart + index * MaxCodeSize, size};
+}
+
+void JittedCodeFixture::AddFunctionsAndWait(FunctionID first, FunctionID last)
+{
+    for (auto i = first; i < last; i++)
+    {
+        _cache->AddFunction(GetFunctionId(i));
+    }
+
+    // the code ranges are added to the cache by its worker thread
+    auto lastRange = GetCodeRange(GetFunctionId(last - 1));
+    while (!_cache->IsManaged(lastRange.Start).value_or(false))
+    {
+        std::this_thread::yield();
+    }
+}
+
+std::vector<uintptr_t> JittedCodeFixture::CreateInstructionPointers(std::size_t functionsCount, std::size_t count, std::size_t nativePercent)
+{
+    std::mt19937_64 random(42);
+    std::uniform_int_distribution<std::size_t> functions(0, functionsCount - 1);
+    std::uniform_int_distribution<std::size_t> percent(0, 99);
+    std::uniform_int_distribution<uintptr_t> nativeCode(0x7f3000000000, 0x7f3100000000);
+
+    std::vector<uintptr_t> ips;
+    ips.reserve(count);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        if (percent(random) < nativePercent)
+        {
+            ips.push_back(nativeCode(random));
+        }
+        else
+        {
+            auto range = GetCodeRange(GetFunctionId(functions(random)));
+            ips.push_back(range.Start + (random() % range.Size));
+        }
+    }
+
+    return ips;
+}
+
+void JittedCodeFixture::StartJitting()
+{
+    _stopJitting = false;
+    _jitThread = std::thread([this] {
+        // new methods are jitted after the ones added by the constructor
+        auto index = _functionsCount;
+        while (!_stopJitting)
+        {
+            _cache->AddFunction(GetFunctionId(index++));
+            std::this_thread::sleep_for(100us);
+        }
+    });
+}
+
+void JittedCodeFixture::StopJitting()
+{
+    if (!_jitThread.joinable())
+    {
+        return;
+    }
+
+    _stopJitting = true;
+    _jitThread.join();
+}
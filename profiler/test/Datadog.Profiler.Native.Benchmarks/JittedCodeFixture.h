@@ -0,0 +1,65 @@
+// Unless explicitly stated otherwise all files in this repository are licensed under the Apache 2 License.
+// This product includes software developed at Datadog (https://www.datadoghq.com/). Copyright 2025 Datadog, Inc.
+
+#pragma once
+
+#include "ManagedCodeCache.h"
+#include "MockProfilerInfo.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+// ManagedCodeCache filled with the code of jitted methods laid out like in the runtime code heap:
+// methods of a few hundreds of bytes allocated one after the other.
+// The ICorProfilerInfo mock returns the code range of each FunctionID from this layout.
+class JittedCodeFixture
+{
+public:
+    static constexpr uintptr_t CodeHeapStart = 0x7f1000000000;
+
+    explicit JittedCodeFixture(std::size_t functionsCount);
+    ~JittedCodeFixture();
+
+    JittedCodeFixture(JittedCodeFixture const&) = delete;
+    JittedCodeFixture& operator=(JittedCodeFixture const&) = delete;
+
+    ManagedCodeCache& GetCache()
+    {
+        return *_cache;
+    }
+
+    ICorProfilerInfo4* GetProfilerInfo()
+    {
+        return _pProfilerInfo;
+    }
+
+    // Instruction pointers seen in callstacks: most of them are in jitted code and the others
+    // in native code (runtime, libc, ...) outside of the code heap
+    static std::vector<uintptr_t> CreateInstructionPointers(std::size_t functionsCount, std::size_t count, std::size_t nativePercent);
+
+    // Simulates the JIT compilation of new methods (tiered compilation) from another thread
+    // until StopJitting is called
+    void StartJitting();
+    void StopJitting();
+
+private:
+    struct CodeRange
+    {
+        uintptr_t Start;
+        ULONG32 Size;
+    };
+
+    static CodeRange GetCodeRange(FunctionID functionId);
+    void AddFunctionsAndWait(FunctionID first, FunctionID last);
+
+private:
+    ::testing::NiceMock<MockProfilerInfo>* _pProfilerInfo;
+    std::unique_ptr<ManagedCodeCache> _cache;
+    std::size_t _functionsCount;
+
+    std::atomic<bool> _stopJitting;
+    std::thread _jitThread;
+};
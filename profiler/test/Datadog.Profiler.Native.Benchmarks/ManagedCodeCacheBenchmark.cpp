@@ -0,0 +1,92 @@
+// Unless explicitly stated otherwise all files in this repository are licensed under the Apache 2 License.
+// This product includes software developed at Datadog (https://www.datadoghq.com/). Copyright 2025 Datadog, Inc.
+
+#include "benchmark/benchmark.h"
+
+#include "JittedCodeFixture.h"
+
+#include <memory>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t FunctionsCount = 20'000;
+constexpr std::size_t InstructionPointersCount = 4096;
+
+// One in five frames is native (hybrid unwinding walks the native frames before the managed ones)
+constexpr std::size_t NativePercent = 20;
+
+// Shared by the benchmark threads: created and destroyed by the first thread
+// (the benchmark loop starts and ends with a barrier)
+std::unique_ptr<JittedCodeFixture> fixture;
+
+} // namespace
+
+// Called from the signal handler for each frame when walking the stack
+static void BM_ManagedCodeCache_IsManaged(benchmark::State& state)
+{
+    if (state.thread_index() == 0)
+    {
+        fixture = std::make_unique<JittedCodeFixture>(FunctionsCount);
+        if (state.range(0) != 0)
+        {
+            fixture->StartJitting();
+        }
+    }
+
+    auto ips = JittedCodeFixture::CreateInstructionPointers(FunctionsCount, InstructionPointersCount, NativePercent);
+
+    std::size_t current = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(fixture->GetCache().IsManaged(ips[current]));
+        current = (current + 1) % InstructionPointersCount;
+    }
+
+    state.SetItemsProcessed(state.iterations());
+
+    if (state.thread_index() == 0)
+    {
+        fixture.reset();
+    }
+}
+BENCHMARK(BM_ManagedCodeCache_IsManaged)
+    ->ArgName("jitting")
+    ->Arg(0)
+    ->Arg(1)
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
+
+// Called when the callstacks are resolved by the samples collector thread
+static void BM_ManagedCodeCache_GetFunctionId(benchmark::State& state)
+{
+    JittedCodeFixture jittedCode(FunctionsCount);
+    auto ips = JittedCodeFixture::CreateInstructionPointers(FunctionsCount, InstructionPointersCount, NativePercent);
+
+    std::size_t current = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(jittedCode.GetCache().GetFunctionId(ips[current]));
+        current = (current + 1) % InstructionPointersCount;
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ManagedCodeCache_GetFunctionId);
+
+// Cost paid by the cache worker thread for each jitted method (a new snapshot is published)
+static void BM_ManagedCodeCache_AddFunction(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        auto jittedCode = std::make_unique<JittedCodeFixture>(state.range(0));
+
+        // destroying the cache is not part of the measurement
+        state.PauseTiming();
+        jittedCode.reset();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ManagedCodeCache_AddFunction)->ArgName("functions")->Arg(1000)->Arg(FunctionsCount)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,111 @@
+// Unless explicitly stated otherwise all files in this repository are licensed under the Apache 2 License.
+// This product includes software developed at Datadog (https://www.datadoghq.com/). Copyright 2025 Datadog, Inc.
+
+#include "benchmark/benchmark.h"
+
+#include "Profile.h"
+#include "ProfilerMockedInterface.h"
+
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+constexpr std::size_t FramesCount = 10'000;
+constexpr std::size_t CallstackDepth = 40;
+constexpr std::size_t SamplesCount = 1024;
+
+// Frames in the format generated by FrameStore
+class Frames
+{
+public:
+    Frames()
+    {
+        for (std::size_t i = 0; i < FramesCount; i++)
+        {
+            auto module = "My.Assembly" + std::to_string(i % 50);
+            _modules.push_back(module);
+            _frames.push_back("|lm:" + module + " |ns:My.Namespace |ct:MyType" + std::to_string(i / 10) +
+                              " |cg: |fn:MyMethod" + std::to_string(i) + " |fg: |sg:(int32 value, string name)");
+        }
+    }
+
+    FrameInfoView Get(std::size_t index) const
+    {
+        return {_modules[index], _frames[index], "", 0};
+    }
+
+private:
+    std::vector<std::string> _modules;
+    std::vector<std::string> _frames;
+};
+
+std::vector<std::shared_ptr<Sample>> CreateSamples(Frames const& frames, std::size_t distinctCallstacks)
+{
+    std::mt19937_64 random(42);
+    std::uniform_int_distribution<std::size_t> indexes(0, FramesCount - 1);
+
+    std::vector<std::vector<std::size_t>> callstacks(distinctCallstacks);
+    for (auto& callstack : callstacks)
+    {
+        for (std::size_t i = 0; i < CallstackDepth; i++)
+        {
+            callstack.push_back(indexes(random));
+        }
+    }
+
+    Sample::ValuesCount = 1;
+
+    std::vector<std::shared_ptr<Sample>> samples;
+    for (std::size_t i = 0; i < SamplesCount; i++)
+    {
+        auto sample = std::make_shared<Sample>(1ns, "runtime-id", CallstackDepth);
+        for (auto index : callstacks[i % distinctCallstacks])
+        {
+            sample->AddFrame(frames.Get(index));
+        }
+        sample->AddValue(10'000'000, 0);
+        sample->SetPid(42);
+        sample->SetAppDomainName("my app");
+        sample->SetThreadId("<0> [#" + std::to_string(i % 32) + "]");
+        sample->SetThreadName("Managed thread " + std::to_string(i % 32));
+        samples.push_back(std::move(sample));
+    }
+
+    return samples;
+}
+
+} // namespace
+
+// Samples added to the libdatadog profile when the samples are collected
+static void BM_Profile_Add(benchmark::State& state)
+{
+    ::testing::NiceMock<MockConfiguration> configuration;
+    ON_CALL(configuration, IsFrameInterningEnabled()).WillByDefault(::testing::Return(state.range(1) != 0));
+
+    Frames frames;
+    auto samples = CreateSamples(frames, state.range(0));
+
+    auto profile = libdatadog::Profile::Create(&configuration, {{"wall", "nanoseconds"}}, "RealTime", "Nanoseconds", "my app");
+
+    std::size_t current = 0;
+    for (auto _ : state)
+    {
+        auto success = profile->Add(samples[current]);
+        if (!success)
+        {
+            state.SkipWithError(success.message().c_str());
+            break;
+        }
+        current = (current + 1) % SamplesCount;
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Profile_Add)
+    ->ArgNames({"callstacks", "interning"})
+    ->ArgsProduct({{1, 64, SamplesCount}, {0, 1}});
@@ -0,0 +1,91 @@
+// Unless explicitly stated otherwise all files in this repository are licensed under the Apache 2 License.
+// This product includes software developed at Datadog (https://www.datadoghq.com/). Copyright 2025 Datadog, Inc.
+
+#include "benchmark/benchmark.h"
+
+#include "AppDomainStoreHelper.h"
+#include "CallstackProvider.h"
+#include "FrameStoreHelper.h"
+#include "MemoryResourceManager.h"
+#include "MetricsRegistry.h"
+#include "RawSampleTransformer.h"
+#include "RawWallTimeSample.h"
+#include "RuntimeIdStoreHelper.h"
+
+#include <random>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+constexpr std::size_t FramesCount = 10'000;
+constexpr std::size_t CallstackDepth = 40;
+constexpr std::size_t SamplesCount = 1024;
+
+CallstackProvider callstackProvider(MemoryResourceManager::GetDefault());
+
+// Threads of an application spend most of their time in a few callstacks: the samples are
+// built from distinctCallstacks callstacks sharing their root frames (Main, thread pool, ...)
+std::vector<RawWallTimeSample> CreateRawSamples(std::size_t distinctCallstacks)
+{
+    std::mt19937_64 random(42);
+    std::uniform_int_distribution<std::uintptr_t> frames(1, FramesCount);
+
+    std::vector<std::vector<std::uintptr_t>> callstacks(distinctCallstacks);
+    for (auto& callstack : callstacks)
+    {
+        for (std::size_t i = 0; i < CallstackDepth; i++)
+        {
+            // the same 10 root frames for every callstack
+            callstack.push_back((i >= CallstackDepth - 10) ? i : frames(random));
+        }
+    }
+
+    std::vector<RawWallTimeSample> samples(SamplesCount);
+    for (std::size_t i = 0; i < SamplesCount; i++)
+    {
+        auto& raw = samples[i];
+        raw.Timestamp = 1ns;
+        raw.Duration = 10ms;
+        raw.AppDomainId = 1;
+        raw.ThreadInfo = nullptr;
+        raw.Stack = callstackProvider.Get();
+        for (auto ip : callstacks[i % distinctCallstacks])
+        {
+            raw.Stack.Add(ip);
+        }
+    }
+
+    return samples;
+}
+
+} // namespace
+
+// Transformation of the raw samples by the samples collector thread
+static void BM_RawSampleTransformer_Transform(benchmark::State& state)
+{
+    FrameStoreHelper frameStore(true, "Frame", FramesCount);
+    AppDomainStoreHelper appDomainStore(1);
+    RuntimeIdStoreHelper runtimeIdStore;
+    MetricsRegistry metricsRegistry;
+    RawSampleTransformer transformer{&frameStore, &appDomainStore, &runtimeIdStore, metricsRegistry};
+    std::vector<SampleValueTypeProvider::Offset> offsets{0};
+    Sample::ValuesCount = 1;
+
+    auto samples = CreateRawSamples(state.range(0));
+
+    std::size_t current = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(transformer.Transform(samples[current], offsets));
+        current = (current + 1) % SamplesCount;
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_RawSampleTransformer_Transform)
+    ->ArgName("callstacks")
+    ->Arg(1)
+    ->Arg(64)
+    ->Arg(SamplesCount);
@@ -0,0 +1,176 @@
+// Unless explicitly stated otherwise all files in this repository are licensed under the Apache 2 License.
+// This product includes software developed at Datadog (https://www.datadoghq.com/). Copyright 2025 Datadog, Inc.
+
+#ifdef LINUX
+
+#include "benchmark/benchmark.h"
+
+#include "Callstack.h"
+#include "RawCpuSample.h"
+#include "RingBuffer.h"
+
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <thread>
+
+namespace {
+
+// Same sizing as the cpu profiler ring buffer (see CorProfilerCallback)
+constexpr std::size_t SampleSize = sizeof(RawCpuSample) + Callstack::MaxSize;
+constexpr std::size_t Capacity = 1024 * SampleSize;
+
+// The writers are the signal handlers of the sampled threads and the reader is the samples
+// collector thread: a background consumer drains the buffer while the benchmark threads write.
+class DrainedRingBuffer
+{
+public:
+    DrainedRingBuffer() :
+        _ringBuffer{Capacity, SampleSize},
+        _stopRequested{false},
+        _consumer{[this] { Consume(); }}
+    {
+    }
+
+    ~DrainedRingBuffer()
+    {
+        _stopRequested = true;
+        _consumer.join();
+    }
+
+    RingBuffer& Get()
+    {
+        return _ringBuffer;
+    }
+
+private:
+    void Consume()
+    {
+        while (!_stopRequested)
+        {
+            {
+                auto reader = _ringBuffer.GetReader();
+                auto count = reader.AvailableSamples();
+                for (std::size_t i = 0; i < count; i++)
+                {
+                    benchmark::DoNotOptimize(reader.GetNext().data());
+                }
+            }
+            std::this_thread::yield();
+        }
+    }
+
+    RingBuffer _ringBuffer;
+    std::atomic<bool> _stopRequested;
+    std::thread _consumer;
+};
+
+DrainedRingBuffer& GetDrainedRingBuffer()
+{
+    static DrainedRingBuffer ringBuffer;
+    return ringBuffer;
+}
+
+} // namespace
+
+// Reserve/Commit of a sample without contention nor consumer: the buffer is drained
+// by the benchmark thread itself when it is full
+static void BM_RingBuffer_ReserveCommit(benchmark::State& state)
+{
+    RingBuffer ringBuffer(Capacity, SampleSize);
+    auto writer = ringBuffer.GetWriter();
+
+    for (auto _ : state)
+    {
+        auto buffer = writer.Reserve();
+        if (buffer.empty())
+        {
+            state.PauseTiming();
+            {
+                auto reader = ringBuffer.GetReader();
+                auto count = reader.AvailableSamples();
+                for (std::size_t i = 0; i < count; i++)
+                {
+                    reader.GetNext();
+                }
+            }
+            state.ResumeTiming();
+            buffer = writer.Reserve();
+        }
+
+        // only the header of the sample is written by the signal handler in most cases
+        std::memset(buffer.data(), 0, sizeof(RawCpuSample));
+        writer.Commit(buffer);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_RingBuffer_ReserveCommit);
+
+// Concurrent writers with a consumer running in the background.
+// When the buffer is full or the cursor cannot be claimed, the writer retries: the time per
+// iteration includes the back pressure of the consumer and the contention between writers.
+static void BM_RingBuffer_ReserveCommit_Concurrent(benchmark::State& state)
+{
+    auto writer = GetDrainedRingBuffer().Get().GetWriter();
+
+    std::int64_t full = 0;
+    std::int64_t timeouts = 0;
+    for (auto _ : state)
+    {
+        bool timeout = false;
+        auto buffer = writer.Reserve(&timeout);
+        while (buffer.empty())
+        {
+            (timeout ? timeouts : full)++;
+            std::this_thread::yield();
+
+            timeout = false;
+            buffer = writer.Reserve(&timeout);
+        }
+
+        std::memset(buffer.data(), 0, sizeof(RawCpuSample));
+        writer.Commit(buffer);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    state.counters["full"] = benchmark::Counter(static_cast<double>(full), benchmark::Counter::kAvgIterations);
+    state.counters["timeouts"] = benchmark::Counter(static_cast<double>(timeouts), benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_RingBuffer_ReserveCommit_Concurrent)->ThreadRange(1, 16)->UseRealTime();
+
+// Reader side: GetNext over a full buffer
+static void BM_RingBuffer_GetNext(benchmark::State& state)
+{
+    RingBuffer ringBuffer(Capacity, SampleSize);
+    auto writer = ringBuffer.GetWriter();
+
+    std::int64_t samples = 0;
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        while (true)
+        {
+            auto buffer = writer.Reserve();
+            if (buffer.empty())
+            {
+                break;
+            }
+            writer.Commit(buffer);
+        }
+        state.ResumeTiming();
+
+        auto reader = ringBuffer.GetReader();
+        auto count = reader.AvailableSamples();
+        for (std::size_t i = 0; i < count; i++)
+        {
+            benchmark::DoNotOptimize(reader.GetNext().data());
+        }
+        samples += count;
+    }
+
+    state.SetItemsProcessed(samples);
+}
+BENCHMARK(BM_RingBuffer_GetNext);
+
+#endif
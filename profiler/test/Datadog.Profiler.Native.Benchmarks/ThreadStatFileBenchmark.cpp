@@ -0,0 +1,167 @@
+// Unless explicitly stated otherwise all files in this repository are licensed under the Apache 2 License.
+// This product includes software developed at Datadog (https://www.datadoghq.com/). Copyright 2025 Datadog, Inc.
+
+#ifdef LINUX
+
+#include "benchmark/benchmark.h"
+
+#include "OpSysTools.h"
+#include "ThreadStatFile.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <fcntl.h>
+#include <memory>
+#include <mutex>
+#include <pthread.h>
+#include <sys/syscall.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+namespace {
+
+// Threads of the application that are sampled by the cpu profiler: most of them are waiting
+class WaitingThreads
+{
+public:
+    explicit WaitingThreads(std::size_t count) :
+        _stopRequested{false},
+        _startedCount{0},
+        _tids(count)
+    {
+        // small stacks to be able to create thousands of threads
+        pthread_attr_t attributes;
+        pthread_attr_init(&attributes);
+        pthread_attr_setstacksize(&attributes, 64 * 1024);
+
+        _threads.reserve(count);
+        for (std::size_t i = 0; i < count; i++)
+        {
+            auto* context = new std::pair<WaitingThreads*, std::size_t>(this, i);
+            pthread_t thread;
+            if (pthread_create(&thread, &attributes, &WaitingThreads::Wait, context) != 0)
+            {
+                delete context;
+                break;
+            }
+            _threads.push_back(thread);
+        }
+        pthread_attr_destroy(&attributes);
+
+        _tids.resize(_threads.size());
+        while (_startedCount < _threads.size())
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    ~WaitingThreads()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stopRequested = true;
+        }
+        _stopped.notify_all();
+
+        for (auto thread : _threads)
+        {
+            pthread_join(thread, nullptr);
+        }
+    }
+
+    std::vector<pid_t> const& GetThreadIds() const
+    {
+        return _tids;
+    }
+
+private:
+    static void* Wait(void* parameter)
+    {
+        std::unique_ptr<std::pair<WaitingThreads*, std::size_t>> context(static_cast<std::pair<WaitingThreads*, std::size_t>*>(parameter));
+        auto* self = context->first;
+
+        self->_tids[context->second] = static_cast<pid_t>(syscall(SYS_gettid));
+        self->_startedCount++;
+
+        std::unique_lock<std::mutex> lock(self->_mutex);
+        self->_stopped.wait(lock, [self] { return self->_stopRequested; });
+        return nullptr;
+    }
+
+    std::mutex _mutex;
+    std::condition_variable _stopped;
+    bool _stopRequested;
+    std::atomic<std::size_t> _startedCount;
+    std::vector<pid_t> _tids;
+    std::vector<pthread_t> _threads;
+};
+
+bool ParseStat(char* line, ssize_t length)
+{
+    if (length <= 0)
+    {
+        return false;
+    }
+    line[length] = '\0';
+
+    char state = ' ';
+    int32_t userTime = 0;
+    int32_t kernelTime = 0;
+    return OpSysTools::ParseThreadInfo(line, state, userTime, kernelTime);
+}
+
+} // namespace
+
+// What the cpu profiler was doing for each thread at each tick: open/read/close of its stat file
+static void BM_ThreadStat_OpenReadClose(benchmark::State& state)
+{
+    WaitingThreads threads(state.range(0));
+    auto const& tids = threads.GetThreadIds();
+
+    char statPath[64];
+    char line[1024];
+    for (auto _ : state)
+    {
+        for (auto tid : tids)
+        {
+            ThreadStatFile::BuildPath(tid, statPath, sizeof(statPath));
+            auto fd = open(statPath, O_RDONLY);
+            if (fd == -1)
+            {
+                continue;
+            }
+            auto length = read(fd, line, sizeof(line) - 1);
+            close(fd);
+
+            benchmark::DoNotOptimize(ParseStat(line, length));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * tids.size());
+}
+BENCHMARK(BM_ThreadStat_OpenReadClose)->ArgName("threads")->Arg(100)->Arg(1000)->Arg(5000)->Unit(benchmark::kMicrosecond);
+
+// Stat files kept opened between ticks (one ThreadStatFile per ManagedThreadInfo)
+static void BM_ThreadStat_ThreadStatFile(benchmark::State& state)
+{
+    WaitingThreads threads(state.range(0));
+    auto const& tids = threads.GetThreadIds();
+    std::vector<ThreadStatFile> statFiles(tids.size());
+
+    char line[1024];
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < tids.size(); i++)
+        {
+            auto length = statFiles[i].Read(tids[i], line, sizeof(line) - 1);
+            benchmark::DoNotOptimize(ParseStat(line, length));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * tids.size());
+    state.counters["opened_files"] = ThreadStatFile::GetOpenedFilesCount();
+}
+BENCHMARK(BM_ThreadStat_ThreadStatFile)->ArgName("threads")->Arg(100)->Arg(1000)->Arg(5000)->Unit(benchmark::kMicrosecond);
+
+#endif
@@ -0,0 +1,123 @@
+// Unless explicitly stated otherwise all files in this repository are licensed under the Apache 2 License.
+// This product includes software developed at Datadog (https://www.datadoghq.com/). Copyright 2025 Datadog, Inc.
+
+#include "benchmark/benchmark.h"
+
+#include "VisitedObjectSet.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+
+// Addresses of objects allocated one after the other in the GC heap:
+// 8 bytes aligned, between 24 bytes (empty object) and a few hundreds of bytes
+std::vector<uintptr_t> CreateHeapAddresses(std::size_t count)
+{
+    std::mt19937_64 random(42);
+    std::uniform_int_distribution<uintptr_t> sizes(3, 64);
+
+    std::vector<uintptr_t> addresses;
+    addresses.reserve(count);
+
+    uintptr_t address = 0x7f0000000000;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        addresses.push_back(address);
+        address += sizes(random) * 8;
+    }
+
+    return addresses;
+}
+
+// Objects are not visited in allocation order when following the references
+std::vector<uintptr_t> CreateVisitOrder(std::vector<uintptr_t> const& addresses, std::size_t revisitPercent)
+{
+    std::mt19937_64 random(42);
+    std::vector<uintptr_t> visits(addresses);
+    std::shuffle(visits.begin(), visits.end(), random);
+
+    // objects referenced by several parents are found again during the traversal
+    std::uniform_int_distribution<std::size_t> indexes(0, addresses.size() - 1);
+    auto revisits = addresses.size() * revisitPercent / 100;
+    for (std::size_t i = 0; i < revisits; i++)
+    {
+        visits.push_back(addresses[indexes(random)]);
+    }
+    std::shuffle(visits.begin(), visits.end(), random);
+
+    return visits;
+}
+
+} // namespace
+
+// Visit of the objects reachable from a root: the set is cleared between roots (and keeps its capacity)
+static void BM_VisitedObjectSet_TryInsert(benchmark::State& state)
+{
+    auto visits = CreateVisitOrder(CreateHeapAddresses(state.range(0)), state.range(1));
+
+    VisitedObjectSet visited;
+    for (auto _ : state)
+    {
+        for (auto address : visits)
+        {
+            VisitedObjectSet::VisitedEntry* entry = nullptr;
+            if (visited.TryInsert(address, entry) == VisitedObjectSet::InsertResult::Inserted)
+            {
+                entry->classID = static_cast<ClassID>(address);
+            }
+            benchmark::DoNotOptimize(entry);
+        }
+
+        state.PauseTiming();
+        visited.Clear();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * visits.size());
+}
+BENCHMARK(BM_VisitedObjectSet_TryInsert)
+    ->ArgNames({"objects", "revisit%"})
+    ->ArgsProduct({{1 << 10, 1 << 16, 1 << 20}, {0, 25}});
+
+// Growth of the table from its default capacity (first roots of a dump)
+static void BM_VisitedObjectSet_TryInsert_Grow(benchmark::State& state)
+{
+    auto visits = CreateVisitOrder(CreateHeapAddresses(state.range(0)), 0);
+
+    for (auto _ : state)
+    {
+        VisitedObjectSet visited;
+        for (auto address : visits)
+        {
+            VisitedObjectSet::VisitedEntry* entry = nullptr;
+            visited.TryInsert(address, entry);
+            benchmark::DoNotOptimize(entry);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * visits.size());
+}
+BENCHMARK(BM_VisitedObjectSet_TryInsert_Grow)->ArgName("objects")->Arg(1 << 16)->Arg(1 << 20);
+
+static void BM_VisitedObjectSet_Clear(benchmark::State& state)
+{
+    auto addresses = CreateHeapAddresses(state.range(0));
+
+    VisitedObjectSet visited;
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        for (auto address : addresses)
+        {
+            VisitedObjectSet::VisitedEntry* entry = nullptr;
+            visited.TryInsert(address, entry);
+        }
+        state.ResumeTiming();
+
+        visited.Clear();
+    }
+}
+BENCHMARK(BM_VisitedObjectSet_Clear)->ArgName("objects")->Arg(1 << 10)->Arg(1 << 20);
@@ -171,4 +171,74 @@ TEST(AdaptiveSamplerTest, ConcurrentSampleAndRollWindow_NoDataRace)
     // The test passes if it completes without crashing or triggering TSAN.
     // No specific count assertion: sampling is probabilistic.
     SUCCEED();
-}
\ No newline at end of file
+}
+
+// Each thread uses its own random generator: the proportion of sampled events must be the same
+// as when the decisions were serialized on a shared generator, for all threads.
+TEST(AdaptiveSamplerTest, ConcurrentSample_KeepsSamplingProbability)
+{
+    AdaptiveSampler sampler(0ms, 100000, 1, 1, nullptr);
+
+    // 50000 sampled out of 200000 in the previous window: probability = 0.25 and budget = 50000
+    for (int i = 0; i < 50000; ++i)
+    {
+        sampler.Keep();
+    }
+    for (int i = 0; i < 150000; ++i)
+    {
+        sampler.Drop();
+    }
+    sampler.RollWindow();
+
+    auto state = sampler.GetInternalState();
+    ASSERT_DOUBLE_EQ(0.25, state.Probability);
+    ASSERT_EQ(50000, state.Budget);
+
+    const int numThreads = 4;
+    const int callsPerThread = 25000;
+    std::vector<int> sampledPerThread(numThreads);
+    std::vector<uint64_t> firstDecisions(numThreads);
+    std::vector<std::thread> threads;
+    threads.reserve(numThreads);
+    for (int i = 0; i < numThreads; ++i)
+    {
+        threads.emplace_back([&, i]() {
+            for (int j = 0; j < callsPerThread; ++j)
+            {
+                auto sampled = sampler.Sample();
+                if (sampled)
+                {
+                    sampledPerThread[i]++;
+                }
+                if (j < 64)
+                {
+                    firstDecisions[i] |= static_cast<uint64_t>(sampled) << j;
+                }
+            }
+        });
+    }
+
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+
+    // standard deviation is ~68 per thread and ~137 in total: the margins are > 7 standard deviations
+    int totalSampled = 0;
+    for (int i = 0; i < numThreads; ++i)
+    {
+        ASSERT_NEAR(0.25 * callsPerThread, sampledPerThread[i], 0.025 * callsPerThread);
+        totalSampled += sampledPerThread[i];
+    }
+    ASSERT_NEAR(0.25 * numThreads * callsPerThread, totalSampled, 0.01 * numThreads * callsPerThread);
+
+    state = sampler.GetInternalState();
+    ASSERT_EQ(numThreads * callsPerThread, state.TestCount);
+    ASSERT_EQ(totalSampled, state.SampleCount);
+
+    // the generators of the threads are not seeded the same way
+    for (int i = 1; i < numThreads; ++i)
+    {
+        ASSERT_NE(firstDecisions[0], firstDecisions[i]);
+    }
+}
@@ -167,4 +167,26 @@ TEST(ClrEventsParserTest, AllocationTickV4)
     EXPECT_CALL(mockAllocationListener, OnAllocation(0, 12, GenericStrEq(typeName), 123456789, 999, 42)).Times(1);
 
     parser.ParseEvent(12345ns, 4, KEYWORD_GC, EVENT_ALLOCATION_TICK, (ULONG)eventSize, buffer.get());
-}
\ No newline at end of file
+}
+TEST(ClrEventsParserTest, OnlyGcEventsCanBeParsedAsynchronously)
+{
+    EXPECT_TRUE(ClrEventsParser::CanBeParsedAsynchronously(ClrEventsParser::KEYWORD_GC, EVENT_GC_START));
+    EXPECT_TRUE(ClrEventsParser::CanBeParsedAsynchronously(ClrEventsParser::KEYWORD_GC, EVENT_GC_END));
+
+    // the callstack of the current thread is needed
+    EXPECT_FALSE(ClrEventsParser::CanBeParsedAsynchronously(ClrEventsParser::KEYWORD_GC, EVENT_ALLOCATION_TICK));
+    EXPECT_FALSE(ClrEventsParser::CanBeParsedAsynchronously(ClrEventsParser::KEYWORD_CONTENTION, EVENT_CONTENTION_STOP));
+}
+
+TEST(ClrEventsParserTest, GcHeapDumpEventsAreParsedSynchronously)
+{
+    // the heap is walked by the listeners of the bulk events: the GC must still be suspended
+    for (auto id : {EVENT_GC_BULK_NODE, EVENT_GC_BULK_EDGE, EVENT_GC_BULK_ROOT_EDGE, EVENT_GC_BULK_ROOT_STATIC_VAR})
+    {
+        EXPECT_TRUE(ClrEventsParser::IsGcHeapDumpEvent(ClrEventsParser::KEYWORD_GCHEAPDUMP));
+        EXPECT_FALSE(ClrEventsParser::CanBeParsedAsynchronously(ClrEventsParser::KEYWORD_GCHEAPDUMP, id));
+        EXPECT_FALSE(ClrEventsParser::CanBeParsedAsynchronously(ClrEventsParser::KEYWORD_GC | ClrEventsParser::KEYWORD_GCHEAPDUMP, id));
+    }
+
+    EXPECT_FALSE(ClrEventsParser::IsGcHeapDumpEvent(ClrEventsParser::KEYWORD_GC));
+}
@@ -1658,3 +1658,86 @@ TEST_F(ConfigurationTest, CheckReferenceTreeFormatFallsBackToBinaryWhenEnvVarSet
     ASSERT_THAT(configuration.GetReferenceTreeFormat(), ReferenceTreeFormat_Binary);
 }
 
+TEST_F(ConfigurationTest, CheckPerCpuRingBuffersEnabledIsDisabledByDefault)
+{
+    unsetenv(EnvironmentVariables::PerCpuRingBuffersEnabled);
+    auto configuration = Configuration{};
+    ASSERT_THAT(configuration.IsPerCpuRingBuffersEnabled(), false);
+}
+
+TEST_F(ConfigurationTest, CheckPerCpuRingBuffersEnabledIsEnabledIfEnvVarSetToTrue)
+{
+    EnvironmentHelper::EnvironmentVariable ar(EnvironmentVariables::PerCpuRingBuffersEnabled, WStr("1"));
+    auto configuration = Configuration{};
+    ASSERT_THAT(configuration.IsPerCpuRingBuffersEnabled(), true);
+}
+
+TEST_F(ConfigurationTest, CheckBatchedWalltimeSamplingEnabledIsDisabledByDefault)
+{
+    unsetenv(EnvironmentVariables::BatchedWalltimeSamplingEnabled);
+    auto configuration = Configuration{};
+    ASSERT_THAT(configuration.IsBatchedWalltimeSamplingEnabled(), false);
+}
+
+TEST_F(ConfigurationTest, CheckBatchedWalltimeSamplingEnabledIsEnabledIfEnvVarSetToTrue)
+{
+    EnvironmentHelper::EnvironmentVariable ar(EnvironmentVariables::BatchedWalltimeSamplingEnabled, WStr("1"));
+    auto configuration = Configuration{};
+    ASSERT_THAT(configuration.IsBatchedWalltimeSamplingEnabled(), true);
+}
+
+TEST_F(ConfigurationTest, CheckFrameInterningEnabledIsDisabledByDefault)
+{
+    unsetenv(EnvironmentVariables::FrameInterningEnabled);
+    auto configuration = Configuration{};
+    ASSERT_THAT(configuration.IsFrameInterningEnabled(), false);
+}
+
+TEST_F(ConfigurationTest, CheckFrameInterningEnabledIsEnabledIfEnvVarSetToTrue)
+{
+    EnvironmentHelper::EnvironmentVariable ar(EnvironmentVariables::FrameInterningEnabled, WStr("1"));
+    auto configuration = Configuration{};
+    ASSERT_THAT(configuration.IsFrameInterningEnabled(), true);
+}
+
+TEST_F(ConfigurationTest, CheckUnwindTablesEnabledIsDisabledByDefault)
+{
+    unsetenv(EnvironmentVariables::UnwindTablesEnabled);
+    auto configuration = Configuration{};
+    ASSERT_THAT(configuration.IsUnwindTablesEnabled(), false);
+}
+
+TEST_F(ConfigurationTest, CheckUnwindTablesEnabledIsEnabledIfEnvVarSetToTrue)
+{
+    EnvironmentHelper::EnvironmentVariable ar(EnvironmentVariables::UnwindTablesEnabled, WStr("1"));
+    auto configuration = Configuration{};
+    ASSERT_THAT(configuration.IsUnwindTablesEnabled(), true);
+}
+
+TEST_F(ConfigurationTest, CheckAsyncEventsParsingEnabledIsDisabledByDefault)
+{
+    unsetenv(EnvironmentVariables::AsyncEventsParsingEnabled);
+    auto configuration = Configuration{};
+    ASSERT_THAT(configuration.IsAsyncEventsParsingEnabled(), false);
+}
+
+TEST_F(ConfigurationTest, CheckAsyncEventsParsingEnabledIsEnabledIfEnvVarSetToTrue)
+{
+    EnvironmentHelper::EnvironmentVariable ar(EnvironmentVariables::AsyncEventsParsingEnabled, WStr("1"));
+    auto configuration = Configuration{};
+    ASSERT_THAT(configuration.IsAsyncEventsParsingEnabled(), true);
+}
+
+TEST_F(ConfigurationTest, CheckHeapSnapshotTraversalWorkersIsZeroByDefault)
+{
+    unsetenv(EnvironmentVariables::HeapSnapshotTraversalWorkers);
+    auto configuration = Configuration{};
+    ASSERT_THAT(configuration.GetHeapSnapshotTraversalWorkers(), 0);
+}
+
+TEST_F(ConfigurationTest, CheckHeapSnapshotTraversalWorkersIsSetFromEnvVar)
+{
+    EnvironmentHelper::EnvironmentVariable ar(EnvironmentVariables::HeapSnapshotTraversalWorkers, WStr("4"));
+    auto configuration = Configuration{};
+    ASSERT_THAT(configuration.GetHeapSnapshotTraversalWorkers(), 4);
+}
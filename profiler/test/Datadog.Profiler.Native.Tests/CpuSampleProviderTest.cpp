@@ -26,11 +26,11 @@ TEST(CpuSampleProviderTest, WriteAndReadSample)
     std::string anotherExpectedRuntimeId = "AnotherRid";
     EXPECT_CALL(runtimeIdStore, GetId(static_cast<AppDomainID>(2))).WillRepeatedly(::testing::Return(anotherExpectedRuntimeId.c_str()));
 
-    RawSampleTransformer rawSampleTransformer{&frameStore, &appDomainStore, &runtimeIdStore};
+    auto metricRegistry = MetricsRegistry();
+    RawSampleTransformer rawSampleTransformer{&frameStore, &appDomainStore, &runtimeIdStore, metricRegistry};
     auto valueTypes = SampleValueTypeProvider();
 
     auto const nbSamples = 11;
-    auto metricRegistry = MetricsRegistry();
     auto rb = std::make_unique<RingBuffer>(CpuSampleProvider::SampleSize * nbSamples, CpuSampleProvider::SampleSize);
     auto provider = CpuSampleProvider(valueTypes, &rawSampleTransformer, rb.get(), metricRegistry);
 
@@ -104,4 +104,65 @@ TEST(CpuSampleProviderTest, WriteAndReadSample)
         currentSampleIdx++;
     }
 }
+
+TEST(CpuSampleProviderTest, MergeShardsInTimestampOrder)
+{
+    auto const maxNbFrames = 2;
+    auto appDomainStore = AppDomainStoreHelper(1);
+    auto frameStore = FrameStoreHelper(true, "Frame", maxNbFrames);
+    MockRuntimeIdStore runtimeIdStore;
+
+    std::string expectedRuntimeId = "MyRid";
+    EXPECT_CALL(runtimeIdStore, GetId(static_cast<AppDomainID>(1))).WillRepeatedly(::testing::Return(expectedRuntimeId.c_str()));
+
+    auto metricRegistry = MetricsRegistry();
+    RawSampleTransformer rawSampleTransformer{&frameStore, &appDomainStore, &runtimeIdStore, metricRegistry};
+    auto valueTypes = SampleValueTypeProvider();
+
+    auto const nbShards = 3;
+    auto const nbSamplesPerShard = 5;
+    std::vector<std::unique_ptr<RingBuffer>> ringBuffers;
+    std::vector<RingBuffer*> shards;
+    for (auto i = 0; i < nbShards; i++)
+    {
+        ringBuffers.push_back(std::make_unique<RingBuffer>(CpuSampleProvider::SampleSize * (nbSamplesPerShard + 1), CpuSampleProvider::SampleSize));
+        shards.push_back(ringBuffers.back().get());
+    }
+
+    // Use a provider per shard to control in which shard each sample is written.
+    // Shard #i gets the timestamps i, i + nbShards, i + 2 * nbShards...
+    for (auto i = 0; i < nbShards; i++)
+    {
+        auto writer = CpuSampleProvider(valueTypes, &rawSampleTransformer, shards[i], metricRegistry);
+        for (auto j = 0; j < nbSamplesPerShard; j++)
+        {
+            auto rawSample = writer.GetRawSample();
+            ASSERT_TRUE(rawSample);
+
+            rawSample->Duration = std::chrono::nanoseconds(10);
+            rawSample->AppDomainId = static_cast<AppDomainID>(1);
+            rawSample->ThreadInfo = nullptr;
+            rawSample->Timestamp = std::chrono::nanoseconds(i + j * nbShards);
+            for (auto k = 1; k < maxNbFrames + 1; k++)
+            {
+                rawSample->Stack.Add(k);
+            }
+        }
+    }
+
+    auto provider = CpuSampleProvider(valueTypes, &rawSampleTransformer, shards, metricRegistry);
+    auto samples = provider.GetSamples();
+    ASSERT_EQ(samples->size(), nbShards * nbSamplesPerShard);
+
+    Sample::ValuesCount = 2; // Duration and CPU samples count
+    auto sample = std::make_shared<Sample>(0ns, std::string_view{}, 10);
+    auto currentTimestamp = 0;
+    while (samples->MoveNext(sample))
+    {
+        ASSERT_EQ(sample->GetTimeStamp(), std::chrono::nanoseconds(currentTimestamp));
+        ASSERT_EQ(sample->GetCallstack().size(), maxNbFrames);
+        currentTimestamp++;
+    }
+    ASSERT_EQ(currentTimestamp, nbShards * nbSamplesPerShard);
+}
 #endif // LINUX
\ No newline at end of file
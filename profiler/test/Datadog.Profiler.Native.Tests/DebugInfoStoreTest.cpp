@@ -4,11 +4,15 @@
 #include "gtest/gtest.h"
 
 #include "DebugInfoStore.h"
+#include "MockProfilerInfo.h"
 #include "ProfilerMockedInterface.h"
 
 #include "shared/src/native-src/dd_filesystem.hpp"
 #include "shared/src/native-src/string.h"
 
+#include <chrono>
+#include <thread>
+
 #ifdef _WINDOWS
 #include "..\Datadog.Profiler.Native.Windows\SymPdbParser.h"
 #include "..\Datadog.Profiler.Native.Windows\DbgHelpParser.h"
@@ -16,6 +20,7 @@
 #include <atlbase.h>
 #endif
 
+using ::testing::_;
 using ::testing::Return;
 using ::testing::ReturnRef;
 
@@ -282,3 +287,47 @@ TEST(DebugInfoStoreTest, ParseModuleDebugInfo_NetCorePortable)
     ASSERT_FALSE(moduleInfo.RidToDebugInfo.empty()) << "Expected RID to debug info mapping for Portable PDB";
     ASSERT_FALSE(moduleInfo.Files.empty()) << "Expected source files in debug info";
 }
+
+TEST(DebugInfoStoreTest, DebugInfoIsLoadedInTheBackground)
+{
+    testing::NiceMock<MockConfiguration> configuration;
+    EXPECT_CALL(configuration, IsDebugInfoEnabled()).WillRepeatedly(Return(true));
+
+    auto* profilerInfo = new MockProfilerInfo();
+    shared::WSTRING modulePath = WStr("NotExistingFolder/Module.dll");
+    EXPECT_CALL(*profilerInfo, GetModuleInfo2(1, _, _, _, _, _, _))
+        .WillRepeatedly([&modulePath](ModuleID, LPCBYTE*, ULONG cchName, ULONG* pcchName, WCHAR szName[], AssemblyID*, DWORD*) {
+            *pcchName = static_cast<ULONG>(modulePath.size() + 1);
+            if (cchName >= modulePath.size() + 1)
+            {
+                std::copy(modulePath.c_str(), modulePath.c_str() + modulePath.size() + 1, szName);
+            }
+            return S_OK;
+        });
+
+    {
+        DebugInfoStore store(profilerInfo, &configuration);
+
+        store.OnModuleLoaded(1);
+
+        // the lookups do not wait for the pdb file to be parsed
+        SymbolDebugInfo debugInfo;
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        do
+        {
+            debugInfo = store.Get(1, 0x06000001);
+            if (!debugInfo.IsPending)
+            {
+                break;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        } while (std::chrono::steady_clock::now() < deadline);
+
+        // no pdb file next to the module
+        ASSERT_FALSE(debugInfo.IsPending);
+        ASSERT_EQ(DebugInfoStore::NoFileFound, debugInfo.File);
+        ASSERT_EQ(DebugInfoStore::NoStartLine, debugInfo.StartLine);
+    }
+
+    profilerInfo->Release();
+}
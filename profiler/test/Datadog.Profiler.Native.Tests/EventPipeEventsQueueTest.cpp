@@ -0,0 +1,195 @@
+// Unless explicitly stated otherwise all files in this repository are licensed under the Apache 2 License.
+// This product includes software developed at Datadog (https://www.datadoghq.com/). Copyright 2025 Datadog, Inc.
+
+#include "gtest/gtest.h"
+
+#include "EventPipeEventsQueue.h"
+#include "MetricsRegistry.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+struct ReceivedEvent
+{
+    std::chrono::nanoseconds Timestamp;
+    DWORD Version;
+    INT64 Keywords;
+    DWORD Id;
+    std::vector<BYTE> Payload;
+};
+
+void SetRecordingHandler(EventPipeEventsQueue& queue, std::vector<ReceivedEvent>& events)
+{
+    queue.SetEventHandler(
+        [&events](std::chrono::nanoseconds timestamp, DWORD version, INT64 keywords, DWORD id, ULONG cbEventData, LPCBYTE eventData) {
+            events.push_back({timestamp, version, keywords, id, std::vector<BYTE>(eventData, eventData + cbEventData)});
+        });
+}
+
+} // namespace
+
+TEST(EventPipeEventsQueueTest, EventsAreNotQueuedIfNotStarted)
+{
+    MetricsRegistry metricsRegistry;
+    EventPipeEventsQueue queue(1024, metricsRegistry);
+    std::vector<ReceivedEvent> events;
+    SetRecordingHandler(queue, events);
+
+    BYTE payload[] = {1, 2, 3};
+    ASSERT_FALSE(queue.Enqueue(1ns, 1, 1, 1, sizeof(payload), payload));
+    ASSERT_TRUE(events.empty());
+}
+
+TEST(EventPipeEventsQueueTest, EventsAreProcessedInOrder)
+{
+    MetricsRegistry metricsRegistry;
+
+    // small queue to wrap around many times
+    EventPipeEventsQueue queue(1024, metricsRegistry);
+    std::vector<ReceivedEvent> events;
+    SetRecordingHandler(queue, events);
+    ASSERT_TRUE(queue.Start());
+
+    const int EventCount = 2000;
+    for (int i = 0; i < EventCount; i++)
+    {
+        // payloads of different sizes (including empty) to test the padding at the end of the buffer
+        std::vector<BYTE> payload(i % 97);
+        for (std::size_t j = 0; j < payload.size(); j++)
+        {
+            payload[j] = static_cast<BYTE>(i + j);
+        }
+
+        ASSERT_TRUE(queue.Enqueue(std::chrono::nanoseconds(i), 2, 0x100001, i, static_cast<ULONG>(payload.size()), payload.data()));
+    }
+
+    // queued events are processed when the queue is stopped
+    ASSERT_TRUE(queue.Stop());
+
+    ASSERT_EQ(EventCount, events.size());
+    for (int i = 0; i < EventCount; i++)
+    {
+        auto const& event = events[i];
+        ASSERT_EQ(std::chrono::nanoseconds(i), event.Timestamp);
+        ASSERT_EQ(2, event.Version);
+        ASSERT_EQ(0x100001, event.Keywords);
+        ASSERT_EQ(i, event.Id);
+        ASSERT_EQ(i % 97, event.Payload.size());
+        for (std::size_t j = 0; j < event.Payload.size(); j++)
+        {
+            ASSERT_EQ(static_cast<BYTE>(i + j), event.Payload[j]);
+        }
+    }
+}
+
+TEST(EventPipeEventsQueueTest, LargeEventIsParsedAfterQueuedEvents)
+{
+    MetricsRegistry metricsRegistry;
+    EventPipeEventsQueue queue(1024, metricsRegistry);
+    std::vector<ReceivedEvent> events;
+    SetRecordingHandler(queue, events);
+    ASSERT_TRUE(queue.Start());
+
+    BYTE payload[16] = {0};
+    for (int i = 0; i < 10; i++)
+    {
+        ASSERT_TRUE(queue.Enqueue(std::chrono::nanoseconds(i), 1, 1, i, sizeof(payload), payload));
+    }
+
+    // too large to be queued: it is parsed by the current thread but only after the queued events
+    std::vector<BYTE> largePayload(1024);
+    ASSERT_TRUE(queue.Enqueue(10ns, 1, 1, 10, static_cast<ULONG>(largePayload.size()), largePayload.data()));
+    ASSERT_EQ(11, events.size());
+    for (int i = 0; i < 11; i++)
+    {
+        ASSERT_EQ(i, events[i].Id);
+    }
+
+    ASSERT_TRUE(queue.Stop());
+
+    // stopped queue does not accept events anymore
+    ASSERT_FALSE(queue.Enqueue(11ns, 1, 1, 11, sizeof(payload), payload));
+    ASSERT_EQ(11, events.size());
+}
+
+TEST(EventPipeEventsQueueTest, EventIsParsedOnCurrentThreadAfterQueuedEvents)
+{
+    MetricsRegistry metricsRegistry;
+    EventPipeEventsQueue queue(1024, metricsRegistry);
+    std::vector<ReceivedEvent> events;
+    std::vector<std::thread::id> threads;
+    queue.SetEventHandler(
+        [&events, &threads](std::chrono::nanoseconds timestamp, DWORD version, INT64 keywords, DWORD id, ULONG cbEventData, LPCBYTE eventData) {
+            events.push_back({timestamp, version, keywords, id, std::vector<BYTE>(eventData, eventData + cbEventData)});
+            threads.push_back(std::this_thread::get_id());
+        });
+
+    BYTE payload[16] = {0};
+
+    // not started: the caller has to parse the event
+    ASSERT_FALSE(queue.ParseAfterQueuedEvents(0ns, 1, 1, 0, sizeof(payload), payload));
+    ASSERT_TRUE(events.empty());
+
+    ASSERT_TRUE(queue.Start());
+    for (int i = 0; i < 20; i++)
+    {
+        ASSERT_TRUE(queue.Enqueue(std::chrono::nanoseconds(i), 1, 1, i, sizeof(payload), payload));
+    }
+
+    // i.e. a GC heap dump event that must be parsed while the GC is suspended
+    ASSERT_TRUE(queue.ParseAfterQueuedEvents(20ns, 1, 1, 20, sizeof(payload), payload));
+    ASSERT_EQ(21, events.size());
+    for (int i = 0; i < 21; i++)
+    {
+        ASSERT_EQ(i, events[i].Id);
+    }
+    ASSERT_EQ(std::this_thread::get_id(), threads.back());
+    ASSERT_NE(std::this_thread::get_id(), threads.front());
+
+    ASSERT_TRUE(queue.Stop());
+    ASSERT_FALSE(queue.ParseAfterQueuedEvents(21ns, 1, 1, 21, sizeof(payload), payload));
+    ASSERT_EQ(21, events.size());
+}
+
+TEST(EventPipeEventsQueueTest, NoEventIsLostWhenStoppedWhileProducing)
+{
+    MetricsRegistry metricsRegistry;
+    EventPipeEventsQueue queue(1024, metricsRegistry);
+    std::atomic<int> parsedCount = 0;
+    queue.SetEventHandler(
+        [&parsedCount](std::chrono::nanoseconds timestamp, DWORD version, INT64 keywords, DWORD id, ULONG cbEventData, LPCBYTE eventData) {
+            parsedCount++;
+        });
+    ASSERT_TRUE(queue.Start());
+
+    // the events which are not queued are the ones the producer has to parse
+    std::atomic<int> rejectedCount = 0;
+    std::atomic<bool> isProducing = true;
+    std::thread producer([&queue, &rejectedCount, &isProducing]() {
+        BYTE payload[32] = {0};
+        for (int i = 0; i < 100000; i++)
+        {
+            if (!queue.Enqueue(std::chrono::nanoseconds(i), 1, 1, i, sizeof(payload), payload))
+            {
+                rejectedCount++;
+            }
+        }
+        isProducing = false;
+    });
+
+    while (isProducing && parsedCount < 100)
+    {
+        std::this_thread::yield();
+    }
+    ASSERT_TRUE(queue.Stop());
+    producer.join();
+
+    ASSERT_EQ(100000, parsedCount + rejectedCount);
+}
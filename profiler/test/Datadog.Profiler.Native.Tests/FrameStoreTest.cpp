@@ -27,6 +27,41 @@ constexpr const char* FakeAllocationFrameText =
 constexpr const char* UnknownManagedFrameText =
     "|lm:Unknown-Assembly |ns: |ct:Unknown-Type |cg: |fn:Unknown-Method |fg: |sg:(?)";
 
+// debug info of the modules still being loaded until LoadAll is called
+class LoadingDebugInfoStore : public IDebugInfoStore
+{
+public:
+    SymbolDebugInfo Get(ModuleID moduleId, mdMethodDef methodDef) override
+    {
+        if (!_isLoaded)
+        {
+            return {{}, 0, true};
+        }
+        return {"Program.cs", methodDef & 0xFFFF, false};
+    }
+
+    void OnModuleLoaded(ModuleID moduleId) override
+    {
+    }
+
+    size_t GetMemorySize() const override
+    {
+        return 0;
+    }
+
+    void LogMemoryBreakdown() const override
+    {
+    }
+
+    void LoadAll()
+    {
+        _isLoaded = true;
+    }
+
+private:
+    bool _isLoaded = false;
+};
+
 } // namespace
 
 // These tests guard the contract that FrameStore::GetFrame uses to tell
@@ -210,3 +245,55 @@ TEST(FrameStoreTest, GetFrame_WithCache_CachedPathNullopt_ReturnsResolvedPlaceho
 }
 #endif
 
+
+// Frames resolved while the debug info of their module is loading are kept as pending.
+// Once the debug info is available, they must be moved into the methods cache and
+// removed from the pending frames instead of being kept (and counted) twice.
+TEST(FrameStoreTest, GetFrame_PendingFramesAreRemovedOnceTheDebugInfoIsLoaded)
+{
+    auto mockProfiler = MockProfilerInfo{};
+    LoadingDebugInfoStore debugInfoStore;
+
+    EXPECT_CALL(mockProfiler, GetFunctionFromIP(_, _))
+        .WillRepeatedly([](LPCBYTE ip, FunctionID* pFunctionId) -> HRESULT {
+            *pFunctionId = reinterpret_cast<FunctionID>(ip) + 0x1000;
+            return S_OK;
+        });
+
+    FrameStore frameStore(
+        /*pCorProfilerInfo*/ &mockProfiler,
+        /*pConfiguration  */ nullptr,
+        /*pDebugInfoStore */ &debugInfoStore,
+        /*pManagedCodeCache*/ nullptr);
+
+    const uintptr_t ips[] = {0x10000, 0x20000, 0x30000};
+    for (auto ip : ips)
+    {
+        frameStore.AddPendingFrameForTests(ip + 0x1000, "|fn:Method" + std::to_string(ip), 0x42, 0x06000001);
+    }
+    ASSERT_EQ(3, frameStore.GetPendingFramesCountForTests());
+
+    // still loading: the frames are returned without file and line, and are kept as pending
+    auto [isPendingResolved, pendingFrame] = frameStore.GetFrame(ips[0]);
+    EXPECT_TRUE(isPendingResolved);
+    EXPECT_EQ(std::string(pendingFrame.Frame), "|fn:Method" + std::to_string(ips[0]));
+    EXPECT_TRUE(pendingFrame.Filename.empty());
+    EXPECT_EQ(3, frameStore.GetPendingFramesCountForTests());
+
+    debugInfoStore.LoadAll();
+    for (auto ip : ips)
+    {
+        auto [isResolved, frameInfo] = frameStore.GetFrame(ip);
+        EXPECT_TRUE(isResolved);
+        EXPECT_EQ(std::string(frameInfo.Frame), "|fn:Method" + std::to_string(ip));
+        EXPECT_EQ(std::string(frameInfo.Filename), "Program.cs");
+        EXPECT_EQ(frameInfo.StartLine, 1);
+    }
+    EXPECT_EQ(0, frameStore.GetPendingFramesCountForTests());
+
+    // the promoted frames are served from the methods cache
+    auto [isResolved, frameInfo] = frameStore.GetFrame(ips[1]);
+    EXPECT_TRUE(isResolved);
+    EXPECT_EQ(std::string(frameInfo.Filename), "Program.cs");
+    EXPECT_EQ(0, frameStore.GetPendingFramesCountForTests());
+}
@@ -0,0 +1,113 @@
+// Unless explicitly stated otherwise all files in this repository are licensed under the Apache 2 License.
+// This product includes software developed at Datadog (https://www.datadoghq.com/). Copyright 2025 Datadog, Inc.
+
+#include "GroupSampler.h"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+TEST(GroupSamplerTest, FirstSampleOfEachGroupIsKept)
+{
+    GroupSampler<std::string> sampler(0, 60s, true);
+
+    ASSERT_TRUE(sampler.Sample("System.InvalidOperationException"));
+    ASSERT_TRUE(sampler.Sample("System.ArgumentException"));
+
+    // no budget for the other ones
+    ASSERT_FALSE(sampler.Sample("System.InvalidOperationException"));
+
+    auto groups = sampler.GetGroups();
+    ASSERT_EQ(2, groups.size());
+    ASSERT_EQ(2, sampler.GetGroupsCount());
+
+    auto it = std::find_if(groups.begin(), groups.end(), [](auto const& g) { return g.Group == "System.InvalidOperationException"; });
+    ASSERT_NE(groups.end(), it);
+    ASSERT_EQ(2, it->RealCount);
+    ASSERT_EQ(1, it->SampledCount);
+
+    // counts are reset once read
+    ASSERT_TRUE(sampler.GetGroups().empty());
+}
+
+TEST(GroupSamplerTest, ConcurrentSample_CountsAllEvents)
+{
+    GroupSampler<std::string> sampler(100, 60s, true);
+
+    const int numThreads = 4;
+    const int callsPerThread = 10000;
+    const int groupsCount = 300; // more groups than buckets
+    std::vector<std::thread> threads;
+    threads.reserve(numThreads);
+    for (int i = 0; i < numThreads; ++i)
+    {
+        threads.emplace_back([&]() {
+            for (int j = 0; j < callsPerThread; ++j)
+            {
+                sampler.Sample("group #" + std::to_string(j % groupsCount), 10);
+            }
+        });
+    }
+
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+
+    ASSERT_EQ(groupsCount, sampler.GetGroupsCount());
+
+    // each group has been sampled at least once (first seen in the window)
+    auto groups = sampler.GetGroups();
+    ASSERT_EQ(groupsCount, groups.size());
+
+    uint64_t totalCount = 0;
+    for (auto const& group : groups)
+    {
+        ASSERT_GE(group.SampledCount, 1);
+        ASSERT_LE(group.SampledCount, group.RealCount);
+        ASSERT_EQ(group.RealCount * 10, group.RealValue);
+        ASSERT_EQ(group.SampledCount * 10, group.SampledValue);
+        totalCount += group.RealCount;
+    }
+    ASSERT_EQ(numThreads * callsPerThread, totalCount);
+}
+
+TEST(GroupSamplerTest, ConcurrentGetGroups_NeverDownscales)
+{
+    GroupSampler<std::string> sampler(1000000, 60s, true);
+
+    std::atomic<bool> stop{false};
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i)
+    {
+        threads.emplace_back([&]() {
+            while (!stop.load())
+            {
+                sampler.Sample("System.InvalidOperationException", 10);
+            }
+        });
+    }
+
+    // the counters are read while samples are added: a sample can be counted as real and
+    // as sampled in two different batches
+    for (int batch = 0; batch < 2000; ++batch)
+    {
+        for (auto const& group : sampler.GetGroups())
+        {
+            ASSERT_LE(group.SampledCount, group.RealCount);
+            ASSERT_LE(group.SampledValue, group.RealValue);
+        }
+    }
+
+    stop = true;
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+}
@@ -3,6 +3,7 @@
 
 #include "gtest/gtest.h"
 
+#include "CounterMetric.h"
 #include "MemoryResourceManager.h"
 #include "MetricsRegistry.h"
 #include "LibrariesInfoCache.h"
@@ -14,6 +15,14 @@
 #ifndef ARM64
 #include "Backtrace2Unwinder.h"
 #endif
+#ifdef AMD64
+#include "Callstack.h"
+#include "HybridUnwinder.h"
+#include "ManagedCodeCache.h"
+
+#include <pthread.h>
+#include <vector>
+#endif
 
 struct ServiceWrapper
 {
@@ -278,4 +287,108 @@ TEST(LibrariesInfoCacheTests, BuildSymbolCacheProducesNoDuplicates)
         }
     }
 }
-#endif
\ No newline at end of file
+#endif
+#ifdef AMD64
+__attribute__((noinline)) void KnownTestFunction_ForFindUnwindRowTest()
+{
+    asm volatile("");
+}
+
+static double_t GetCounterValue(MetricsRegistry& metricsRegistry, std::string const& name)
+{
+    auto metrics = metricsRegistry.GetOrRegister<CounterMetric>(name)->GetMetrics();
+    return metrics.front().second;
+}
+
+TEST(LibrariesInfoCacheTests, FindUnwindRowReturnsEntryRuleForKnownFunction)
+{
+    testing::NiceMock<MockConfiguration> config;
+    ON_CALL(config, IsUnwindTablesEnabled()).WillByDefault(testing::Return(true));
+    MetricsRegistry metricsRegistry;
+    LibrariesInfoCache libCache(&config, MemoryResourceManager::GetDefault(), metricsRegistry);
+    ServiceWrapper serviceWrapper(&libCache);
+
+    UnwindRow row;
+    ASSERT_TRUE(LibrariesInfoCache::FindUnwindRow(reinterpret_cast<std::uintptr_t>(&KnownTestFunction_ForFindUnwindRowTest), row));
+    ASSERT_EQ(CfaRegister::Sp, row.cfaRegister);
+    ASSERT_EQ(8, row.cfaOffset);
+
+    ASSERT_FALSE(LibrariesInfoCache::FindUnwindRow(0x1, row));
+
+    ASSERT_EQ(1, GetCounterValue(metricsRegistry, "dotnet_libs_cache_unwind_table_hits"));
+    ASSERT_EQ(1, GetCounterValue(metricsRegistry, "dotnet_libs_cache_unwind_table_misses"));
+}
+
+TEST(LibrariesInfoCacheTests, FindUnwindRowFailsIfUnwindTablesAreDisabled)
+{
+    testing::NiceMock<MockConfiguration> config;
+    MetricsRegistry metricsRegistry;
+    LibrariesInfoCache libCache(&config, MemoryResourceManager::GetDefault(), metricsRegistry);
+    ServiceWrapper serviceWrapper(&libCache);
+
+    UnwindRow row;
+    ASSERT_FALSE(LibrariesInfoCache::FindUnwindRow(reinterpret_cast<std::uintptr_t>(&KnownTestFunction_ForFindUnwindRowTest), row));
+}
+
+static std::pair<std::uintptr_t, std::uintptr_t> GetCurrentThreadStackBounds()
+{
+    std::uintptr_t stackBase = 0;
+    std::uintptr_t stackEnd = 0;
+
+    pthread_attr_t attr;
+    if (pthread_getattr_np(pthread_self(), &attr) == 0)
+    {
+        void* stackAddr;
+        size_t stackSize;
+        if (pthread_attr_getstack(&attr, &stackAddr, &stackSize) == 0)
+        {
+            stackBase = reinterpret_cast<std::uintptr_t>(stackAddr);
+            stackEnd = stackBase + stackSize;
+        }
+        pthread_attr_destroy(&attr);
+    }
+
+    return {stackBase, stackEnd};
+}
+
+__attribute__((noinline)) static std::vector<std::uintptr_t> UnwindCurrentThread(IUnwinder const& unwinder)
+{
+    std::vector<std::uintptr_t> frames(Callstack::MaxFrames);
+    Callstack callstack(shared::span<std::uintptr_t>(frames.data(), frames.size()));
+
+    auto [stackBase, stackEnd] = GetCurrentThreadStackBounds();
+    unwinder.Unwind(nullptr, callstack, stackBase, stackEnd);
+
+    frames.resize(callstack.Size());
+    return frames;
+}
+
+TEST(LibrariesInfoCacheTests, HybridUnwinderWithUnwindTablesFindsTheSameFramesAsLibunwind)
+{
+    testing::NiceMock<MockConfiguration> config;
+    ON_CALL(config, IsUnwindTablesEnabled()).WillByDefault(testing::Return(true));
+    MetricsRegistry metricsRegistry;
+    LibrariesInfoCache libCache(&config, MemoryResourceManager::GetDefault(), metricsRegistry);
+    ServiceWrapper serviceWrapper(&libCache);
+
+    // no managed code in this process: only native frames are walked
+    ManagedCodeCache managedCodeCache(nullptr);
+    HybridUnwinder libunwindOnly(&managedCodeCache);
+    HybridUnwinder withUnwindTables(&managedCodeCache, true);
+
+    // same call site: both walks start from the same return addresses
+    std::vector<std::vector<std::uintptr_t>> callstacks;
+    for (auto const* unwinder : {&libunwindOnly, &withUnwindTables})
+    {
+        callstacks.push_back(UnwindCurrentThread(*unwinder));
+    }
+
+    auto const& expected = callstacks[0];
+    auto const& frames = callstacks[1];
+    ASSERT_GT(expected.size(), 3);
+    ASSERT_EQ(expected, frames);
+
+    // the frames were walked with the tables, not by the libunwind fallback
+    ASSERT_GE(GetCounterValue(metricsRegistry, "dotnet_libs_cache_unwind_table_hits"), expected.size() - 1);
+}
+#endif
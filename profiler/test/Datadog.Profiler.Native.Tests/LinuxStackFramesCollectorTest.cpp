@@ -7,10 +7,11 @@
 #include "profiler/src/ProfilerEngine/Datadog.Profiler.Native.Linux/LinuxStackFramesCollector.h"
 #include "profiler/src/ProfilerEngine/Datadog.Profiler.Native.Linux/ProfilerSignalManager.h"
 
-#ifdef ARM64
+#if defined(ARM64) || defined(AMD64)
 #include "HybridUnwinder.h"
 #include "ManagedCodeCache.h"
-#else
+#endif
+#ifndef ARM64
 #include "Backtrace2Unwinder.h"
 #endif
 #include "CallstackProvider.h"
@@ -31,6 +32,7 @@
 #include <signal.h>
 #include <sys/syscall.h>
 #include <thread>
+#include <vector>
 #define _GNU_SOURCE
 #include <dlfcn.h>
 
@@ -240,6 +242,11 @@ public:
         return _workerThread->GetThreadInfo();
     }
 
+    std::shared_ptr<ManagedThreadInfo> GetSharedWorkerThreadInfo()
+    {
+        return _workerThread->GetSharedThreadInfo();
+    }
+
     void ValidateCallstack(const Callstack& callstack)
     {
         // Disable this check due to flackyness
@@ -314,6 +321,11 @@ private:
             return _threadInfo.get();
         }
 
+        std::shared_ptr<ManagedThreadInfo> GetSharedThreadInfo()
+        {
+            return _threadInfo;
+        }
+
     private:
         void Work()
         {
@@ -400,6 +412,193 @@ TEST_F(LinuxStackFramesCollectorFixture, CheckSamplingThreadCollectCallStack)
     ValidateCallstack(callstack);
 }
 
+#ifdef AMD64
+TEST_F(LinuxStackFramesCollectorFixture, CheckSamplingThreadCollectCallStackWithHybridUnwinder)
+{
+    auto* signalManager = GetSignalManager();
+
+    auto [configuration, mockConfiguration] = CreateConfiguration();
+
+    // no managed code in this process: the whole stack is walked with libunwind
+    ManagedCodeCache managedCodeCache(nullptr);
+    HybridUnwinder unwinder(&managedCodeCache);
+
+    CallstackProvider p(MemoryResourceManager::GetDefault());
+    MetricsRegistry metricsRegistry;
+    auto collector = CreateStackFramesCollector(signalManager, configuration.get(), &p, metricsRegistry, &unwinder);
+
+    auto* threadInfo = GetWorkerThreadInfo();
+
+    std::uint32_t hr;
+    StackSnapshotResultBuffer* buffer;
+
+    collector.PrepareForNextCollection();
+    ASSERT_DURATION_LE(100ms, buffer = collector.CollectStackSample(threadInfo, &hr));
+    EXPECT_EQ(hr, S_OK);
+
+    auto callstack = buffer->GetCallstack();
+
+    ValidateCallstack(callstack);
+}
+#endif
+
+TEST_F(LinuxStackFramesCollectorFixture, CheckBatchedSamplingCollectCallStack)
+{
+    auto* signalManager = GetSignalManager();
+
+    auto [configuration, mockConfiguration] = CreateConfiguration();
+
+    CallstackProvider p(MemoryResourceManager::GetDefault());
+    MetricsRegistry metricsRegistry;
+    auto collector = CreateStackFramesCollector(signalManager, configuration.get(), &p, metricsRegistry, GetUnwinder());
+
+    std::vector<StackSampleRequest> requests(1);
+    requests[0].ThreadInfo = GetSharedWorkerThreadInfo();
+
+    bool supported = false;
+    ASSERT_DURATION_LE(100ms, supported = collector.CollectStackSamples(requests));
+    ASSERT_TRUE(supported);
+    EXPECT_EQ(requests[0].ErrorCode, S_OK);
+
+    ValidateCallstack(requests[0].Stack);
+}
+
+// Simulate a thread stuck while walking its callstack (from its signal handler)
+class BlockingUnwinder : public IUnwinder
+{
+public:
+    explicit BlockingUnwinder(IUnwinder* pUnwinder) :
+        _pUnwinder{pUnwinder},
+        _isBlocked{true}
+    {
+    }
+
+    std::int32_t Unwind(void* ctx, Callstack& callstack, std::uintptr_t stackBase, std::uintptr_t stackEnd,
+                        UnwindingRecorder* recorder) const override
+    {
+        while (_isBlocked)
+        {
+        }
+
+        return _pUnwinder->Unwind(ctx, callstack, stackBase, stackEnd, recorder);
+    }
+
+    void Unblock()
+    {
+        _isBlocked = false;
+    }
+
+private:
+    IUnwinder* _pUnwinder;
+    std::atomic<bool> _isBlocked;
+};
+
+TEST_F(LinuxStackFramesCollectorFixture, CheckBatchedSamplingIsAbandonedIfAThreadIsStuck)
+{
+    auto* signalManager = GetSignalManager();
+
+    auto [configuration, mockConfiguration] = CreateConfiguration();
+
+    CallstackProvider p(MemoryResourceManager::GetDefault());
+    MetricsRegistry metricsRegistry;
+    BlockingUnwinder unwinder(GetUnwinder());
+    auto collector = CreateStackFramesCollector(signalManager, configuration.get(), &p, metricsRegistry, &unwinder);
+
+    std::vector<StackSampleRequest> requests(1);
+    requests[0].ThreadInfo = GetSharedWorkerThreadInfo();
+
+    // the sampler thread does not wait for ever for the signal handler of the stuck thread
+    bool supported = false;
+    ASSERT_DURATION_LE(3s, supported = collector.CollectStackSamples(requests));
+    ASSERT_TRUE(supported);
+    EXPECT_EQ(requests[0].ErrorCode, E_ABORT);
+    EXPECT_EQ(requests[0].Stack.Size(), 0);
+
+    // the next batch is not impacted by the abandoned one
+    unwinder.Unblock();
+    requests[0] = StackSampleRequest{GetSharedWorkerThreadInfo()};
+    ASSERT_DURATION_LE(100ms, supported = collector.CollectStackSamples(requests));
+    EXPECT_EQ(requests[0].ErrorCode, S_OK);
+
+    ValidateCallstack(requests[0].Stack);
+
+    // the abandoned batch was freed once its signal handler left
+    EXPECT_FALSE(collector.HasRetiredBatchForTests());
+}
+
+TEST_F(LinuxStackFramesCollectorFixture, CheckBatchedSamplingIsSkippedWhileASignalHandlerIsStuck)
+{
+    auto* signalManager = GetSignalManager();
+
+    auto [configuration, mockConfiguration] = CreateConfiguration();
+
+    CallstackProvider p(MemoryResourceManager::GetDefault());
+    MetricsRegistry metricsRegistry;
+    BlockingUnwinder unwinder(GetUnwinder());
+    auto collector = CreateStackFramesCollector(signalManager, configuration.get(), &p, metricsRegistry, &unwinder);
+
+    std::vector<StackSampleRequest> requests(1);
+    requests[0].ThreadInfo = GetSharedWorkerThreadInfo();
+
+    bool supported = false;
+    ASSERT_DURATION_LE(3s, supported = collector.CollectStackSamples(requests));
+    ASSERT_TRUE(supported);
+    EXPECT_EQ(requests[0].ErrorCode, E_ABORT);
+
+    // the signal handler is still running: its batch is kept alive
+    EXPECT_TRUE(collector.HasRetiredBatchForTests());
+
+    // and no other batch is published until it leaves
+    requests[0] = StackSampleRequest{GetSharedWorkerThreadInfo()};
+    ASSERT_DURATION_LE(1s, supported = collector.CollectStackSamples(requests));
+    ASSERT_TRUE(supported);
+    EXPECT_EQ(requests[0].ErrorCode, E_ABORT);
+    EXPECT_EQ(requests[0].Stack.Size(), 0);
+    EXPECT_TRUE(collector.HasRetiredBatchForTests());
+
+    unwinder.Unblock();
+    requests[0] = StackSampleRequest{GetSharedWorkerThreadInfo()};
+    ASSERT_DURATION_LE(100ms, supported = collector.CollectStackSamples(requests));
+    EXPECT_EQ(requests[0].ErrorCode, S_OK);
+    EXPECT_FALSE(collector.HasRetiredBatchForTests());
+
+    ValidateCallstack(requests[0].Stack);
+}
+
+TEST_F(LinuxStackFramesCollectorFixture, CheckBatchedSamplingIsAbandonedWhenAbortIsRequested)
+{
+    auto* signalManager = GetSignalManager();
+
+    auto [configuration, mockConfiguration] = CreateConfiguration();
+
+    CallstackProvider p(MemoryResourceManager::GetDefault());
+    MetricsRegistry metricsRegistry;
+    BlockingUnwinder unwinder(GetUnwinder());
+    auto collector = CreateStackFramesCollector(signalManager, configuration.get(), &p, metricsRegistry, &unwinder);
+
+    std::vector<StackSampleRequest> requests(1);
+    requests[0].ThreadInfo = GetSharedWorkerThreadInfo();
+
+    // same as the deadlock intervention of the StackSamplerLoopManager
+    collector.PrepareForNextCollection();
+    auto watcher = std::thread([&collector]() {
+        std::this_thread::sleep_for(100ms);
+        collector.RequestAbortCurrentCollection();
+    });
+
+    bool supported = false;
+    ASSERT_DURATION_LE(1s, supported = collector.CollectStackSamples(requests));
+    watcher.join();
+    ASSERT_TRUE(supported);
+    EXPECT_EQ(requests[0].ErrorCode, E_ABORT);
+
+    unwinder.Unblock();
+    collector.PrepareForNextCollection();
+    requests[0] = StackSampleRequest{GetSharedWorkerThreadInfo()};
+    ASSERT_DURATION_LE(100ms, supported = collector.CollectStackSamples(requests));
+    EXPECT_EQ(requests[0].ErrorCode, S_OK);
+}
+
 TEST_F(LinuxStackFramesCollectorFixture, CheckSamplingThreadCollectCallStackWithOldWay)
 {
     auto* signalManager = GetSignalManager();
@@ -6,6 +6,8 @@
 #include "Profile.h"
 #include "ProfilerMockedInterface.h"
 
+#include <random>
+
 namespace libdatadog {
 
 std::unique_ptr<Profile> CreateProfile(std::unique_ptr<IConfiguration> const& configuration)
@@ -39,6 +41,115 @@ TEST(ProfileTest, AddSample)
     ASSERT_TRUE(success) << success.message();
 }
 
+TEST(ProfileTest, AddSampleWithInternedFrames)
+{
+    auto [configuration, mockConfiguration] = CreateConfiguration();
+    EXPECT_CALL(mockConfiguration, IsFrameInterningEnabled()).WillRepeatedly(::testing::Return(true));
+    auto p = CreateProfile(configuration);
+    ASSERT_NE(p, nullptr);
+
+    static const std::string ModuleName = "My.Assembly";
+    static const std::string Frame = "|lm:My.Assembly |ns:My.Namespace |ct:MyType |cg: |fn:MyMethod |fg: |sg:()";
+    static const std::string Filename = "MyType.cs";
+
+    Sample::ValuesCount = 1;
+    // the same strings are added several times to exercise the interned strings cache
+    for (auto i = 0; i < 3; i++)
+    {
+        auto s = std::make_shared<Sample>(1ns, "1", 2);
+        s->AddFrame({ModuleName, Frame, Filename, 10});
+        s->AddFrame({ModuleName, Frame, "", 0});
+        s->AddValue(42, 0);
+        auto success = p->Add(s);
+        ASSERT_TRUE(success) << success.message();
+    }
+}
+
+TEST(ProfileTest, AddSampleWithInternedFramesFromReusedBuffer)
+{
+    auto [configuration, mockConfiguration] = CreateConfiguration();
+    EXPECT_CALL(mockConfiguration, IsFrameInterningEnabled()).WillRepeatedly(::testing::Return(true));
+    auto p = CreateProfile(configuration);
+    ASSERT_NE(p, nullptr);
+
+    // the interned strings are cached by content: a buffer reused for another string
+    // with the same size must not be mistaken for the previous one
+    std::string frame = "|fn:MethodA";
+    Sample::ValuesCount = 1;
+    for (auto name : {"|fn:MethodA", "|fn:MethodB", "|fn:MethodA"})
+    {
+        frame.assign(name);
+        auto s = std::make_shared<Sample>(1ns, "1", 2);
+        s->AddFrame({"My.Assembly", frame, "", 0});
+        s->AddValue(42, 0);
+        auto success = p->Add(s);
+        ASSERT_TRUE(success) << success.message();
+    }
+}
+
+// Random names do not compress: the serialized (compressed) profile is large only if they are written in it
+std::string CreateRandomName(std::size_t size)
+{
+    static std::mt19937 random(42);
+    static const char Alphabet[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
+
+    std::string name;
+    for (std::size_t i = 0; i < size; i++)
+    {
+        name.push_back(Alphabet[random() % (sizeof(Alphabet) - 1)]);
+    }
+    return name;
+}
+
+std::size_t GetSerializedSize(bool isFrameInterningEnabled, FrameInfoView const& frame, StringLabel const& label)
+{
+    auto [configuration, mockConfiguration] = CreateConfiguration();
+    EXPECT_CALL(mockConfiguration, IsFrameInterningEnabled()).WillRepeatedly(::testing::Return(isFrameInterningEnabled));
+    auto p = CreateProfile(configuration);
+    EXPECT_NE(p, nullptr);
+
+    Sample::ValuesCount = 1;
+    auto s = std::make_shared<Sample>(1ns, "1", 1);
+    s->AddFrame(frame);
+    s->AddLabel(label);
+    s->AddValue(42, 0);
+    auto success = p->Add(s);
+    EXPECT_TRUE(success) << success.message();
+
+    return p->SerializeForTests().size();
+}
+
+TEST(ProfileTest, SerializedProfileContainsTheInternedStrings)
+{
+    const std::size_t NameSize = 4096;
+    auto name = CreateRandomName(NameSize);
+    auto labelValue = CreateRandomName(NameSize);
+    StringLabel emptyLabel{"label", ""};
+    StringLabel label{"label", labelValue};
+
+    // each string is checked alone: mapping name, function name, file name and label value
+    struct TestCase
+    {
+        FrameInfoView Frame;
+        StringLabel Label;
+    };
+    for (auto const& [frame, frameLabel] : {
+             TestCase{{name, "", "", 0}, emptyLabel},
+             TestCase{{"", name, "", 0}, emptyLabel},
+             TestCase{{"", "", name, 0}, emptyLabel},
+             TestCase{{"", "", "", 0}, label},
+         })
+    {
+        auto expectedSize = GetSerializedSize(false, frame, frameLabel);
+        auto size = GetSerializedSize(true, frame, frameLabel);
+
+        // ~6 bits of entropy per character
+        ASSERT_GT(expectedSize, NameSize * 5 / 8);
+        ASSERT_GT(size, NameSize * 5 / 8);
+        ASSERT_NEAR(static_cast<double>(expectedSize), static_cast<double>(size), 512);
+    }
+}
+
 TEST(ProfileTest, AddUpscalingRule)
 {
     auto [configuration, mockConfiguration] = CreateConfiguration();
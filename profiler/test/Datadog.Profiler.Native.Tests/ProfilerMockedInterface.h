@@ -100,6 +100,7 @@ public:
     MOCK_METHOD(std::chrono::minutes, GetHeapSnapshotInterval, (), (const override));
     MOCK_METHOD(std::chrono::milliseconds, GetHeapSnapshotCheckInterval, (), (const override));
     MOCK_METHOD(uint32_t, GetHeapSnapshotMemoryPressureThreshold, (), (const override));
+    MOCK_METHOD(uint32_t, GetHeapSnapshotTraversalWorkers, (), (const override));
     MOCK_METHOD(std::chrono::seconds, GetTestHeapSnapshotInterval, (), (const override));
     // Deliberately not mocked: the gmock default of zero would make the services that wait
     // on it fail to start, and stubbing it with ON_CALL would register every instance with
@@ -114,6 +115,11 @@ public:
     MOCK_METHOD(bool, UseManagedCodeCache, (), (const override));
     MOCK_METHOD(bool, IsMemoryFootprintEnabled, (), (const override));
     MOCK_METHOD(uint32_t, GetReferenceTreeFormat, (), (const override));
+    MOCK_METHOD(bool, IsPerCpuRingBuffersEnabled, (), (const override));
+    MOCK_METHOD(bool, IsBatchedWalltimeSamplingEnabled, (), (const override));
+    MOCK_METHOD(bool, IsFrameInterningEnabled, (), (const override));
+    MOCK_METHOD(bool, IsUnwindTablesEnabled, (), (const override));
+    MOCK_METHOD(bool, IsAsyncEventsParsingEnabled, (), (const override));
 };
 
 class MockExporter : public IExporter
@@ -14,7 +14,9 @@
 #include "FrameStoreHelper.h"
 #include "IAppDomainStore.h"
 #include "IFrameStore.h"
+#include "ISamplesAvailableListener.h"
 #include "MemoryResourceManager.h"
+#include "MetricsRegistry.h"
 #include "OpSysTools.h"
 #include "ProfilerMockedInterface.h"
 #include "RawCpuSample.h"
@@ -98,7 +100,8 @@ TEST(WallTimeProviderTest, CheckNoMissingSample)
     std::string expectedRuntimeId = "MyRid";
     EXPECT_CALL(runtimeIdStore, GetId(::testing::_)).WillRepeatedly(::testing::Return(expectedRuntimeId.c_str()));
 
-    RawSampleTransformer rawSampleTransformer{&frameStore, &appDomainStore, &runtimeIdStore};
+    MetricsRegistry metricsRegistry;
+    RawSampleTransformer rawSampleTransformer{&frameStore, &appDomainStore, &runtimeIdStore, metricsRegistry};
     WallTimeProvider provider(valueTypeProvider, &rawSampleTransformer, shared::pmr::get_default_resource());
     Sample::ValuesCount = 1;
     provider.Start();
@@ -114,6 +117,55 @@ TEST(WallTimeProviderTest, CheckNoMissingSample)
     provider.Stop();
 }
 
+class SamplesAvailableListener : public ISamplesAvailableListener
+{
+public:
+    void OnSamplesAvailable() override
+    {
+        NotificationsCount++;
+    }
+
+    int NotificationsCount = 0;
+};
+
+TEST(WallTimeProviderTest, CheckListenerIsNotifiedWhenThresholdIsReached)
+{
+    auto frameStore = FrameStoreHelper(true, "Frame", 1);
+    auto appDomainStore = AppDomainStoreHelper(2);
+    auto valueTypeProvider = SampleValueTypeProvider();
+    MockRuntimeIdStore runtimeIdStore;
+
+    MetricsRegistry metricsRegistry;
+    RawSampleTransformer rawSampleTransformer{&frameStore, &appDomainStore, &runtimeIdStore, metricsRegistry};
+    WallTimeProvider provider(valueTypeProvider, &rawSampleTransformer, shared::pmr::get_default_resource());
+    SamplesAvailableListener listener;
+    provider.SetSamplesAvailableListener(&listener);
+    provider.Start();
+
+    for (std::size_t i = 0; i < WallTimeProvider::SamplesAvailableThreshold - 1; i++)
+    {
+        provider.Add(RawWallTimeSample());
+    }
+    ASSERT_EQ(0, listener.NotificationsCount);
+
+    // crossing the threshold notifies only once
+    provider.Add(RawWallTimeSample());
+    provider.Add(RawWallTimeSample());
+    ASSERT_EQ(1, listener.NotificationsCount);
+
+    // once the samples are collected, the next burst is notified again
+    auto samples = provider.GetSamples();
+    ASSERT_EQ(WallTimeProvider::SamplesAvailableThreshold + 1, samples->size());
+    for (std::size_t i = 0; i < WallTimeProvider::SamplesAvailableThreshold; i++)
+    {
+        provider.Add(RawWallTimeSample());
+    }
+    ASSERT_EQ(2, listener.NotificationsCount);
+
+    provider.SetSamplesAvailableListener(nullptr);
+    provider.Stop();
+}
+
 TEST(WallTimeProviderTest, CheckAppDomainInfoAndRuntimeId)
 {
     // add samples and check their appdomain, and pid labels
@@ -131,7 +183,8 @@ TEST(WallTimeProviderTest, CheckAppDomainInfoAndRuntimeId)
     std::string secondExpectedRuntimeId = "OtherRid";
     EXPECT_CALL(runtimeIdStore, GetId(static_cast<AppDomainID>(2))).WillRepeatedly(::testing::Return(secondExpectedRuntimeId.c_str()));
 
-    RawSampleTransformer rawSampleTransformer{&frameStore, &appDomainStore, &runtimeIdStore};
+    MetricsRegistry metricsRegistry;
+    RawSampleTransformer rawSampleTransformer{&frameStore, &appDomainStore, &runtimeIdStore, metricsRegistry};
     WallTimeProvider provider(valueTypeProvider, &rawSampleTransformer, shared::pmr::get_default_resource());
     Sample::ValuesCount = 1;
     provider.Start();
@@ -222,7 +275,8 @@ TEST(WallTimeProviderTest, CheckFrames)
     std::string expectedRuntimeId = "MyRid";
     EXPECT_CALL(runtimeIdStore, GetId(static_cast<AppDomainID>(1))).WillRepeatedly(::testing::Return(expectedRuntimeId.c_str()));
 
-    RawSampleTransformer rawSampleTransformer{&frameStore, &appDomainStore, &runtimeIdStore};
+    MetricsRegistry metricsRegistry;
+    RawSampleTransformer rawSampleTransformer{&frameStore, &appDomainStore, &runtimeIdStore, metricsRegistry};
     WallTimeProvider provider(valueTypeProvider, &rawSampleTransformer, shared::pmr::get_default_resource());
     Sample::ValuesCount = 1;
     provider.Start();
@@ -284,7 +338,8 @@ TEST(WallTimeProviderTest, CheckValuesAndTimestamp)
     std::string expectedRuntimeId = "MyRid";
     EXPECT_CALL(runtimeIdStore, GetId(::testing::_)).WillRepeatedly(::testing::Return(expectedRuntimeId.c_str()));
 
-    RawSampleTransformer rawSampleTransformer{&frameStore, &appDomainStore, &runtimeIdStore};
+    MetricsRegistry metricsRegistry;
+    RawSampleTransformer rawSampleTransformer{&frameStore, &appDomainStore, &runtimeIdStore, metricsRegistry};
     WallTimeProvider provider(valueTypeProvider, &rawSampleTransformer, shared::pmr::get_default_resource());
     Sample::ValuesCount = 1;
     provider.Start();
@@ -329,7 +384,8 @@ TEST(CpuTimeProviderTest, CheckValuesAndTimestamp)
     RuntimeIdStoreHelper runtimeIdStore;
     auto [configuration, mockConfiguration] = CreateConfiguration();
 
-    RawSampleTransformer rawSampleTransformer{&frameStore, &appDomainStore, &runtimeIdStore};
+    MetricsRegistry metricsRegistry;
+    RawSampleTransformer rawSampleTransformer{&frameStore, &appDomainStore, &runtimeIdStore, metricsRegistry};
     CpuTimeProvider provider(valueTypeProvider, &rawSampleTransformer, shared::pmr::get_default_resource());
     Sample::ValuesCount = 2;
     provider.Start();
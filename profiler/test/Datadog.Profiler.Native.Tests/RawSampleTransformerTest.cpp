@@ -0,0 +1,130 @@
+// Unless explicitly stated otherwise all files in this repository are licensed under the Apache 2 License.
+// This product includes software developed at Datadog (https://www.datadoghq.com/). Copyright 2025 Datadog, Inc.
+
+#include "gtest/gtest.h"
+
+#include "AppDomainStoreHelper.h"
+#include "CallstackProvider.h"
+#include "FrameStoreHelper.h"
+#include "MemoryResourceManager.h"
+#include "MetricsRegistry.h"
+#include "RawSampleTransformer.h"
+#include "RawWallTimeSample.h"
+#include "RuntimeIdStoreHelper.h"
+
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+class CountingFrameStore : public FrameStoreHelper
+{
+public:
+    CountingFrameStore(size_t count) :
+        FrameStoreHelper(true, "Frame", count)
+    {
+    }
+
+    std::pair<bool, FrameInfoView> GetFrame(uintptr_t instructionPointer) override
+    {
+        ResolvedFramesCount++;
+        return FrameStoreHelper::GetFrame(instructionPointer);
+    }
+
+    size_t ResolvedFramesCount = 0;
+};
+
+static CallstackProvider transformerCallstackProvider(MemoryResourceManager::GetDefault());
+
+static RawWallTimeSample CreateRawSample(std::initializer_list<std::uintptr_t> instructionPointers)
+{
+    RawWallTimeSample raw;
+    raw.Timestamp = 1ns;
+    raw.Duration = 10ns;
+    raw.AppDomainId = 1;
+    raw.Stack = transformerCallstackProvider.Get();
+    for (auto ip : instructionPointers)
+    {
+        raw.Stack.Add(ip);
+    }
+    raw.ThreadInfo = nullptr;
+    return raw;
+}
+
+static double GetMetricValue(MetricsRegistry& metricsRegistry, std::string const& name)
+{
+    for (auto const& [metricName, value] : metricsRegistry.Collect())
+    {
+        if (metricName == name)
+        {
+            return value;
+        }
+    }
+    return -1;
+}
+
+TEST(RawSampleTransformerTest, IdenticalCallstacksAreResolvedOnce)
+{
+    CountingFrameStore frameStore(3);
+    AppDomainStoreHelper appDomainStore(1);
+    RuntimeIdStoreHelper runtimeIdStore;
+    MetricsRegistry metricsRegistry;
+    RawSampleTransformer transformer{&frameStore, &appDomainStore, &runtimeIdStore, metricsRegistry};
+    std::vector<SampleValueTypeProvider::Offset> offsets{0};
+    Sample::ValuesCount = 1;
+
+    const int nbSamples = 10;
+    for (int i = 0; i < nbSamples; i++)
+    {
+        auto sample = transformer.Transform(CreateRawSample({1, 2, 3}), offsets);
+
+        auto const& frames = sample->GetCallstack();
+        ASSERT_EQ(3, frames.size());
+        ASSERT_EQ("Frame #1", frames[0].Frame);
+        ASSERT_EQ("Frame #2", frames[1].Frame);
+        ASSERT_EQ("Frame #3", frames[2].Frame);
+    }
+
+    ASSERT_EQ(3, frameStore.ResolvedFramesCount);
+
+    ASSERT_EQ(nbSamples - 1, GetMetricValue(metricsRegistry, "dotnet_callstack_cache_hits_count"));
+}
+
+TEST(RawSampleTransformerTest, DifferentCallstacksAreResolvedSeparately)
+{
+    CountingFrameStore frameStore(3);
+    AppDomainStoreHelper appDomainStore(1);
+    RuntimeIdStoreHelper runtimeIdStore;
+    MetricsRegistry metricsRegistry;
+    RawSampleTransformer transformer{&frameStore, &appDomainStore, &runtimeIdStore, metricsRegistry};
+    std::vector<SampleValueTypeProvider::Offset> offsets{0};
+    Sample::ValuesCount = 1;
+
+    auto first = transformer.Transform(CreateRawSample({1, 2}), offsets);
+    auto second = transformer.Transform(CreateRawSample({1, 3}), offsets);
+    auto third = transformer.Transform(CreateRawSample({1, 2}), offsets);
+
+    ASSERT_EQ(4, frameStore.ResolvedFramesCount);
+
+    ASSERT_EQ("Frame #2", first->GetCallstack()[1].Frame);
+    ASSERT_EQ("Frame #3", second->GetCallstack()[1].Frame);
+    ASSERT_EQ("Frame #2", third->GetCallstack()[1].Frame);
+}
+
+TEST(RawSampleTransformerTest, AddFrameDoesNotModifyCachedCallstack)
+{
+    CountingFrameStore frameStore(3);
+    AppDomainStoreHelper appDomainStore(1);
+    RuntimeIdStoreHelper runtimeIdStore;
+    MetricsRegistry metricsRegistry;
+    RawSampleTransformer transformer{&frameStore, &appDomainStore, &runtimeIdStore, metricsRegistry};
+    std::vector<SampleValueTypeProvider::Offset> offsets{0};
+    Sample::ValuesCount = 1;
+
+    auto first = transformer.Transform(CreateRawSample({1, 2}), offsets);
+    first->AddFrame({"module", "extra frame", "", 0});
+    ASSERT_EQ(3, first->GetCallstack().size());
+
+    auto second = transformer.Transform(CreateRawSample({1, 2}), offsets);
+    ASSERT_EQ(2, second->GetCallstack().size());
+    ASSERT_EQ(2, frameStore.ResolvedFramesCount);
+}
@@ -13,6 +13,7 @@
 #include <cstring>
 #include <string>
 #include <unordered_map>
+#include <vector>
 #include <sstream>
 
 // ============================================================================
@@ -368,7 +369,7 @@ TEST(TypeTreeNodeTest, InitialState)
     ASSERT_EQ(node.typeID, 100);
     ASSERT_EQ(node.instanceCount, 0);
     ASSERT_EQ(node.totalSize, 0);
-    ASSERT_TRUE(node.children.empty());
+    ASSERT_EQ(node.childCount, 0);
 }
 
 TEST(TypeTreeNodeTest, AddInstance)
@@ -383,46 +384,50 @@ TEST(TypeTreeNodeTest, AddInstance)
 
 TEST(TypeTreeNodeTest, GetOrCreateChildCreatesNew)
 {
+    TypeReferenceTree tree;
     TypeTreeNode node(100);
-    TypeTreeNode* child = node.GetOrCreateChild(200);
+    TypeTreeNode* child = tree.GetOrCreateChild(&node, 200);
 
     ASSERT_NE(child, nullptr);
     ASSERT_EQ(child->typeID, 200);
     ASSERT_EQ(child->instanceCount, 0);
-    ASSERT_EQ(node.children.size(), 1);
+    ASSERT_EQ(node.childCount, 1);
 }
 
 TEST(TypeTreeNodeTest, GetOrCreateChildReturnsExisting)
 {
+    TypeReferenceTree tree;
     TypeTreeNode node(100);
-    TypeTreeNode* child1 = node.GetOrCreateChild(200);
+    TypeTreeNode* child1 = tree.GetOrCreateChild(&node, 200);
     child1->AddInstance(64);
 
-    TypeTreeNode* child2 = node.GetOrCreateChild(200);
+    TypeTreeNode* child2 = tree.GetOrCreateChild(&node, 200);
 
     ASSERT_EQ(child1, child2); // Same pointer
     ASSERT_EQ(child2->instanceCount, 1); // Still has the instance we added
-    ASSERT_EQ(node.children.size(), 1); // Still only one child
+    ASSERT_EQ(node.childCount, 1); // Still only one child
 }
 
 TEST(TypeTreeNodeTest, MultipleChildrenCreated)
 {
+    TypeReferenceTree tree;
     TypeTreeNode node(100);
-    TypeTreeNode* childA = node.GetOrCreateChild(200);
-    TypeTreeNode* childB = node.GetOrCreateChild(300);
+    TypeTreeNode* childA = tree.GetOrCreateChild(&node, 200);
+    TypeTreeNode* childB = tree.GetOrCreateChild(&node, 300);
 
     ASSERT_NE(childA, childB);
     ASSERT_EQ(childA->typeID, 200);
     ASSERT_EQ(childB->typeID, 300);
-    ASSERT_EQ(node.children.size(), 2);
+    ASSERT_EQ(node.childCount, 2);
 }
 
 TEST(TypeTreeNodeTest, GetChildReturnsExisting)
 {
+    TypeReferenceTree tree;
     TypeTreeNode node(100);
-    node.GetOrCreateChild(200)->AddInstance(64);
+    tree.GetOrCreateChild(&node, 200)->AddInstance(64);
 
-    const TypeTreeNode* child = node.GetChild(200);
+    const TypeTreeNode* child = tree.GetChild(&node, 200);
     ASSERT_NE(child, nullptr);
     ASSERT_EQ(child->typeID, 200);
     ASSERT_EQ(child->instanceCount, 1);
@@ -430,8 +435,9 @@ TEST(TypeTreeNodeTest, GetChildReturnsExisting)
 
 TEST(TypeTreeNodeTest, GetChildReturnsNullForMissing)
 {
+    TypeReferenceTree tree;
     TypeTreeNode node(100);
-    const TypeTreeNode* child = node.GetChild(999);
+    const TypeTreeNode* child = tree.GetChild(&node, 999);
     ASSERT_EQ(child, nullptr);
 }
 
@@ -547,34 +553,34 @@ TEST(TypeReferenceTreeTest, TreeStructurePreservesPath)
     TypeTreeNode* rootA = tree.AddRoot(100, RootCategory::Stack, 64);
 
     // Root TypeA -> TypeB
-    TypeTreeNode* childB = rootA->GetOrCreateChild(200);
+    TypeTreeNode* childB = tree.GetOrCreateChild(rootA, 200);
     childB->AddInstance(48);
 
     // TypeB -> TypeA (different position in tree!)
-    TypeTreeNode* childA2 = childB->GetOrCreateChild(100);
+    TypeTreeNode* childA2 = tree.GetOrCreateChild(childB, 100);
     childA2->AddInstance(64);
 
     // TypeA (child of B) -> TypeC
-    TypeTreeNode* childC = childA2->GetOrCreateChild(300);
+    TypeTreeNode* childC = tree.GetOrCreateChild(childA2, 300);
     childC->AddInstance(32);
 
     // Verify the tree structure
-    ASSERT_EQ(rootA->children.size(), 1);
+    ASSERT_EQ(rootA->childCount, 1);
 
-    const TypeTreeNode* b = rootA->GetChild(200);
+    const TypeTreeNode* b = tree.GetChild(rootA, 200);
     ASSERT_NE(b, nullptr);
     ASSERT_EQ(b->instanceCount, 1);
-    ASSERT_EQ(b->children.size(), 1);
+    ASSERT_EQ(b->childCount, 1);
 
-    const TypeTreeNode* a2 = b->GetChild(100);
+    const TypeTreeNode* a2 = tree.GetChild(b, 100);
     ASSERT_NE(a2, nullptr);
     ASSERT_EQ(a2->instanceCount, 1);
-    ASSERT_EQ(a2->children.size(), 1);
+    ASSERT_EQ(a2->childCount, 1);
 
-    const TypeTreeNode* c = a2->GetChild(300);
+    const TypeTreeNode* c = tree.GetChild(a2, 300);
     ASSERT_NE(c, nullptr);
     ASSERT_EQ(c->instanceCount, 1);
-    ASSERT_TRUE(c->children.empty());
+    ASSERT_EQ(c->childCount, 0);
 }
 
 // ============================================================================
@@ -653,7 +659,7 @@ TEST(TypeReferenceTreeJsonSerializerTest, RootWithChildrenSerializes)
     TypeTreeNode* rootNode = tree.AddRoot(typeA, RootCategory::StaticVariable, 128);
 
     // Add child: Order -> Customer
-    TypeTreeNode* childNode = rootNode->GetOrCreateChild(typeB);
+    TypeTreeNode* childNode = tree.GetOrCreateChild(rootNode, typeB);
     childNode->AddInstance(64);
 
     auto json = TypeReferenceTreeJsonSerializer::Serialize(tree, &frameStore);
@@ -774,13 +780,13 @@ TEST(TypeReferenceTreeJsonSerializerTest, DeepHierarchySerializes)
     // Build tree: Root -> Level0 -> Level1 -> Level2
     TypeTreeNode* rootNode = tree.AddRoot(typeRoot, RootCategory::Stack, 64);
 
-    TypeTreeNode* l0 = rootNode->GetOrCreateChild(typeL0);
+    TypeTreeNode* l0 = tree.GetOrCreateChild(rootNode, typeL0);
     l0->AddInstance(48);
 
-    TypeTreeNode* l1 = l0->GetOrCreateChild(typeL1);
+    TypeTreeNode* l1 = tree.GetOrCreateChild(l0, typeL1);
     l1->AddInstance(32);
 
-    TypeTreeNode* l2 = l1->GetOrCreateChild(typeL2);
+    TypeTreeNode* l2 = tree.GetOrCreateChild(l1, typeL2);
     l2->AddInstance(16);
 
     auto json = TypeReferenceTreeJsonSerializer::Serialize(tree, &frameStore);
@@ -813,7 +819,7 @@ TEST(TypeReferenceTreeJsonSerializerTest, ValidJsonStructure)
     frameStore.RegisterType(typeB, "TypeB");
 
     TypeTreeNode* rootNode = tree.AddRoot(typeA, RootCategory::Stack, 100);
-    TypeTreeNode* childNode = rootNode->GetOrCreateChild(typeB);
+    TypeTreeNode* childNode = tree.GetOrCreateChild(rootNode, typeB);
     childNode->AddInstance(50);
 
     auto json = TypeReferenceTreeJsonSerializer::Serialize(tree, &frameStore);
@@ -856,13 +862,13 @@ TEST(TypeReferenceTreeJsonSerializerTest, SameTypeAtDifferentPositions)
     // Build tree: TypeA (root) -> TypeB -> TypeA -> TypeC
     TypeTreeNode* rootA = tree.AddRoot(typeA, RootCategory::Stack, 64);
 
-    TypeTreeNode* childB = rootA->GetOrCreateChild(typeB);
+    TypeTreeNode* childB = tree.GetOrCreateChild(rootA, typeB);
     childB->AddInstance(48);
 
-    TypeTreeNode* childA2 = childB->GetOrCreateChild(typeA);
+    TypeTreeNode* childA2 = tree.GetOrCreateChild(childB, typeA);
     childA2->AddInstance(64);
 
-    TypeTreeNode* childC = childA2->GetOrCreateChild(typeC);
+    TypeTreeNode* childC = tree.GetOrCreateChild(childA2, typeC);
     childC->AddInstance(32);
 
     auto json = TypeReferenceTreeJsonSerializer::Serialize(tree, &frameStore);
@@ -912,9 +918,9 @@ TEST(TypeReferenceTreeJsonSerializerTest, TreeHasNoInfiniteRecursion)
     // Build a tree: A (root) -> A -> B (simulates A1 -> A2 -> B,
     // where A2 was stopped by VisitedObjectSet before cycling back)
     TypeTreeNode* rootA = tree.AddRoot(typeA, RootCategory::Handle, 128);
-    TypeTreeNode* childA = rootA->GetOrCreateChild(typeA);
+    TypeTreeNode* childA = tree.GetOrCreateChild(rootA, typeA);
     childA->AddInstance(128);
-    TypeTreeNode* childB = childA->GetOrCreateChild(typeB);
+    TypeTreeNode* childB = tree.GetOrCreateChild(childA, typeB);
     childB->AddInstance(64);
 
     auto json = TypeReferenceTreeJsonSerializer::Serialize(tree, &frameStore);
@@ -947,7 +953,7 @@ TEST(TypeReferenceTreeTest, MergedRootsShareChildren)
 
     // First root instance of TypeA
     TypeTreeNode* rootA1 = tree.AddRoot(100, RootCategory::Stack, 64);
-    TypeTreeNode* childB1 = rootA1->GetOrCreateChild(200);
+    TypeTreeNode* childB1 = tree.GetOrCreateChild(rootA1, 200);
     childB1->AddInstance(32);
 
     // Second root instance of TypeA (merges into same root node)
@@ -955,7 +961,7 @@ TEST(TypeReferenceTreeTest, MergedRootsShareChildren)
     ASSERT_EQ(rootA1, rootA2); // Same root node pointer
 
     // Adding TypeB child again returns the existing child
-    TypeTreeNode* childB2 = rootA2->GetOrCreateChild(200);
+    TypeTreeNode* childB2 = tree.GetOrCreateChild(rootA2, 200);
     ASSERT_EQ(childB1, childB2); // Same child node
     childB2->AddInstance(48);
 
@@ -964,7 +970,7 @@ TEST(TypeReferenceTreeTest, MergedRootsShareChildren)
     ASSERT_EQ(rootA1->totalSize, 128);
     ASSERT_EQ(childB1->instanceCount, 2);
     ASSERT_EQ(childB1->totalSize, 80);
-    ASSERT_EQ(rootA1->children.size(), 1);
+    ASSERT_EQ(rootA1->childCount, 1);
 }
 
 // When two root instances of TypeA each add different child types,
@@ -974,16 +980,16 @@ TEST(TypeReferenceTreeTest, MergedRootsHaveDifferentChildren)
     TypeReferenceTree tree;
 
     TypeTreeNode* rootA1 = tree.AddRoot(100, RootCategory::Stack, 64);
-    TypeTreeNode* childB = rootA1->GetOrCreateChild(200);
+    TypeTreeNode* childB = tree.GetOrCreateChild(rootA1, 200);
     childB->AddInstance(32);
 
     TypeTreeNode* rootA2 = tree.AddRoot(100, RootCategory::Stack, 64);
-    TypeTreeNode* childC = rootA2->GetOrCreateChild(300);
+    TypeTreeNode* childC = tree.GetOrCreateChild(rootA2, 300);
     childC->AddInstance(48);
 
-    ASSERT_EQ(rootA1->children.size(), 2);
-    ASSERT_NE(rootA1->GetChild(200), nullptr);
-    ASSERT_NE(rootA1->GetChild(300), nullptr);
+    ASSERT_EQ(rootA1->childCount, 2);
+    ASSERT_NE(tree.GetChild(rootA1, 200), nullptr);
+    ASSERT_NE(tree.GetChild(rootA1, 300), nullptr);
 }
 
 // ============================================================================
@@ -997,17 +1003,17 @@ TEST(TypeReferenceTreeTest, DiamondPattern)
     TypeReferenceTree tree;
     TypeTreeNode* root = tree.AddRoot(100, RootCategory::Stack, 64);
 
-    TypeTreeNode* childB = root->GetOrCreateChild(200);
+    TypeTreeNode* childB = tree.GetOrCreateChild(root, 200);
     childB->AddInstance(32);
 
-    TypeTreeNode* childC = root->GetOrCreateChild(300);
+    TypeTreeNode* childC = tree.GetOrCreateChild(root, 300);
     childC->AddInstance(32);
 
     // Both B and C have a TypeD child
-    TypeTreeNode* dUnderB = childB->GetOrCreateChild(400);
+    TypeTreeNode* dUnderB = tree.GetOrCreateChild(childB, 400);
     dUnderB->AddInstance(16);
 
-    TypeTreeNode* dUnderC = childC->GetOrCreateChild(400);
+    TypeTreeNode* dUnderC = tree.GetOrCreateChild(childC, 400);
     dUnderC->AddInstance(24);
 
     // TypeD appears as SEPARATE nodes under B and C
@@ -1046,24 +1052,24 @@ TEST(TypeReferenceTreeTest, SharedObjectEdgeRecordedFromMultipleParents)
     TypeTreeNode* root = tree.AddRoot(typeRoot, RootCategory::Stack, 128);
 
     // Path 1 (visited first): Root -> List<Payload> -> Payload[] -> Payload
-    TypeTreeNode* listPayload = root->GetOrCreateChild(typeListPayload);
+    TypeTreeNode* listPayload = tree.GetOrCreateChild(root, typeListPayload);
     listPayload->AddInstance(64);
-    TypeTreeNode* payloadArr = listPayload->GetOrCreateChild(typePayloadArray);
+    TypeTreeNode* payloadArr = tree.GetOrCreateChild(listPayload, typePayloadArray);
     payloadArr->AddInstance(256);
-    TypeTreeNode* payloadUnderArr = payloadArr->GetOrCreateChild(typePayload);
+    TypeTreeNode* payloadUnderArr = tree.GetOrCreateChild(payloadArr, typePayload);
     payloadUnderArr->AddInstance(48);
 
     // Path 2: Root -> List<Holder> -> Holder[] -> Holder -> Payload (revisit)
-    TypeTreeNode* listHolder = root->GetOrCreateChild(typeListHolder);
+    TypeTreeNode* listHolder = tree.GetOrCreateChild(root, typeListHolder);
     listHolder->AddInstance(64);
-    TypeTreeNode* holderArr = listHolder->GetOrCreateChild(typeHolderArray);
+    TypeTreeNode* holderArr = tree.GetOrCreateChild(listHolder, typeHolderArray);
     holderArr->AddInstance(512);
-    TypeTreeNode* holder = holderArr->GetOrCreateChild(typeHolder);
+    TypeTreeNode* holder = tree.GetOrCreateChild(holderArr, typeHolder);
     holder->AddInstance(32);
 
     // The traverser records the type edge even though the Payload object was
     // already visited. Simulate that by adding a Payload child under Holder.
-    TypeTreeNode* payloadUnderHolder = holder->GetOrCreateChild(typePayload);
+    TypeTreeNode* payloadUnderHolder = tree.GetOrCreateChild(holder, typePayload);
     payloadUnderHolder->AddInstance(48);
 
     // Payload appears as a SEPARATE tree node under both parents
@@ -1076,8 +1082,8 @@ TEST(TypeReferenceTreeTest, SharedObjectEdgeRecordedFromMultipleParents)
     ASSERT_EQ(payloadUnderHolder->instanceCount, 1);
 
     // Holder has Payload as a child
-    ASSERT_NE(holder->GetChild(typePayload), nullptr);
-    ASSERT_EQ(holder->GetChild(typePayload)->instanceCount, 1);
+    ASSERT_NE(tree.GetChild(holder, typePayload), nullptr);
+    ASSERT_EQ(tree.GetChild(holder, typePayload)->instanceCount, 1);
 }
 
 // ============================================================================
@@ -1091,10 +1097,10 @@ TEST(TypeReferenceTreeTest, SelfReferencingTypeChain)
     TypeReferenceTree tree;
     TypeTreeNode* rootA = tree.AddRoot(100, RootCategory::Stack, 64);
 
-    TypeTreeNode* a2 = rootA->GetOrCreateChild(100);
+    TypeTreeNode* a2 = tree.GetOrCreateChild(rootA, 100);
     a2->AddInstance(64);
 
-    TypeTreeNode* a3 = a2->GetOrCreateChild(100);
+    TypeTreeNode* a3 = tree.GetOrCreateChild(a2, 100);
     a3->AddInstance(64);
 
     // All three are distinct nodes despite having the same typeID
@@ -1103,9 +1109,9 @@ TEST(TypeReferenceTreeTest, SelfReferencingTypeChain)
     ASSERT_NE(rootA, a3);
 
     // Each has the correct structure
-    ASSERT_EQ(rootA->children.size(), 1);
-    ASSERT_EQ(a2->children.size(), 1);
-    ASSERT_TRUE(a3->children.empty());
+    ASSERT_EQ(rootA->childCount, 1);
+    ASSERT_EQ(a2->childCount, 1);
+    ASSERT_EQ(a3->childCount, 0);
 
     ASSERT_EQ(rootA->typeID, 100);
     ASSERT_EQ(a2->typeID, 100);
@@ -1126,13 +1132,13 @@ TEST(TypeReferenceTreeTest, DeepChainBeyondMaxTreeDepth)
     for (uint32_t depth = 1; depth <= MaxTreeDepth + 10; depth++)
     {
         ClassID childType = static_cast<ClassID>(depth + 1);
-        TypeTreeNode* child = current->GetOrCreateChild(childType);
+        TypeTreeNode* child = tree.GetOrCreateChild(current, childType);
         child->AddInstance(16);
         current = child;
     }
 
     // The tree should be fully built (no limit in the tree structure)
-    ASSERT_TRUE(current->children.empty());
+    ASSERT_EQ(current->childCount, 0);
     ASSERT_EQ(current->instanceCount, 1);
 }
 
@@ -1149,20 +1155,114 @@ TEST(TypeReferenceTreeTest, WideTreeWithManyChildren)
     for (int i = 0; i < childCount; i++)
     {
         ClassID childType = static_cast<ClassID>(100 + i);
-        TypeTreeNode* child = root->GetOrCreateChild(childType);
+        TypeTreeNode* child = tree.GetOrCreateChild(root, childType);
         child->AddInstance(32);
     }
 
-    ASSERT_EQ(root->children.size(), childCount);
+    ASSERT_EQ(root->childCount, childCount);
 
     for (int i = 0; i < childCount; i++)
     {
-        const TypeTreeNode* child = root->GetChild(static_cast<ClassID>(100 + i));
+        const TypeTreeNode* child = tree.GetChild(root, static_cast<ClassID>(100 + i));
         ASSERT_NE(child, nullptr);
         ASSERT_EQ(child->instanceCount, 1);
     }
 }
 
+TEST(TypeReferenceTreeTest, WideNodesShareChildrenIndex)
+{
+    // enough nodes to span several chunks: the node pointers must stay valid
+    TypeReferenceTree tree;
+    const int parentCount = 100;
+    const int childCount = 100;
+
+    std::vector<TypeTreeNode*> parents;
+    std::vector<TypeTreeNode*> firstChildren;
+    TypeTreeNode* root = tree.AddRoot(1, RootCategory::Stack, 64);
+    for (int i = 0; i < parentCount; i++)
+    {
+        parents.push_back(tree.GetOrCreateChild(root, static_cast<ClassID>(0x1000 + i * 8)));
+    }
+
+    for (int i = 0; i < parentCount; i++)
+    {
+        for (int j = 0; j < childCount; j++)
+        {
+            // the same child types under each parent
+            TypeTreeNode* child = tree.GetOrCreateChild(parents[i], static_cast<ClassID>(0x100000 + j * 8));
+            child->AddInstance(i + j);
+            if (j == 0)
+            {
+                firstChildren.push_back(child);
+            }
+        }
+    }
+
+    ASSERT_EQ(tree.GetNodeCount(), parentCount + parentCount * childCount);
+
+    for (int i = 0; i < parentCount; i++)
+    {
+        ASSERT_EQ(parents[i]->childCount, childCount);
+        ASSERT_EQ(tree.GetChild(root, static_cast<ClassID>(0x1000 + i * 8)), parents[i]);
+        ASSERT_EQ(tree.GetOrCreateChild(parents[i], 0x100000), firstChildren[i]);
+
+        for (int j = 0; j < childCount; j++)
+        {
+            const TypeTreeNode* child = tree.GetChild(parents[i], static_cast<ClassID>(0x100000 + j * 8));
+            ASSERT_NE(child, nullptr);
+            ASSERT_EQ(child->totalSize, i + j);
+        }
+        ASSERT_EQ(tree.GetChild(parents[i], 0x1), nullptr);
+    }
+
+    // the children chain covers all the children
+    int chainedChildren = 0;
+    for (auto index = parents[0]->firstChild; index != TypeTreeNode::NoNode; index = tree.GetNode(index).nextSibling)
+    {
+        chainedChildren++;
+    }
+    ASSERT_EQ(chainedChildren, childCount);
+
+    tree.Clear();
+    ASSERT_EQ(tree.GetNodeCount(), 0);
+}
+
+TEST(TypeReferenceTreeTest, MergeAddsRootsAndChildren)
+{
+    TypeReferenceTree tree;
+    TypeTreeNode* root = tree.AddRoot(1, RootCategory::Stack, 64);
+    tree.GetOrCreateChild(root, 2)->AddInstance(32);
+
+    // subtree built by a traversal worker
+    TypeReferenceTree other;
+    TypeTreeNode* otherRoot = other.AddRoot(1, RootCategory::Stack, 64);
+    TypeTreeNode* otherChild = other.GetOrCreateChild(otherRoot, 2);
+    otherChild->AddInstance(32);
+    other.GetOrCreateChild(otherChild, 3)->AddInstance(16);
+    other.GetOrCreateChild(otherRoot, 4)->AddInstance(8);
+    other.AddRoot(5, RootCategory::Handle, 24);
+
+    tree.Merge(other);
+
+    ASSERT_EQ(tree._roots.size(), 2);
+    ASSERT_EQ(root->instanceCount, 2);
+    ASSERT_EQ(root->totalSize, 128);
+    ASSERT_EQ(root->childCount, 2);
+
+    const TypeTreeNode* child = tree.GetChild(root, 2);
+    ASSERT_NE(child, nullptr);
+    ASSERT_EQ(child->instanceCount, 2);
+    ASSERT_EQ(child->totalSize, 64);
+    ASSERT_NE(tree.GetChild(child, 3), nullptr);
+    ASSERT_EQ(tree.GetChild(child, 3)->totalSize, 16);
+    ASSERT_NE(tree.GetChild(root, 4), nullptr);
+
+    RootKey handleKey{5, RootCategory::Handle};
+    ASSERT_NE(tree._roots.find(handleKey), tree._roots.end());
+    ASSERT_EQ(tree._roots[handleKey]->node.totalSize, 24);
+    ASSERT_EQ(tree.GetNodeCount(), 3);
+}
+
 // ============================================================================
 // Edge Case: Serializer — Leaf root omits children array
 // ============================================================================
@@ -1202,7 +1302,7 @@ TEST(TypeReferenceTreeJsonSerializerTest, UnresolvableTypeIsNamedQuestionMark)
     // typeUnknown is NOT registered in frameStore
 
     TypeTreeNode* root = tree.AddRoot(typeA, RootCategory::Stack, 64);
-    TypeTreeNode* child = root->GetOrCreateChild(typeUnknown);
+    TypeTreeNode* child = tree.GetOrCreateChild(root, typeUnknown);
     child->AddInstance(32);
 
     auto json = TypeReferenceTreeJsonSerializer::Serialize(tree, &frameStore);
@@ -1235,9 +1335,9 @@ TEST(TypeReferenceTreeJsonSerializerTest, NodeTypeIndexMatchesTypeTablePosition)
     frameStore.RegisterType(leafType, "MyApp.Leaf");
 
     TypeTreeNode* root = tree.AddRoot(rootType, RootCategory::Stack, 64);
-    TypeTreeNode* middle = root->GetOrCreateChild(middleType);
+    TypeTreeNode* middle = tree.GetOrCreateChild(root, middleType);
     middle->AddInstance(32);
-    TypeTreeNode* leaf = middle->GetOrCreateChild(leafType);
+    TypeTreeNode* leaf = tree.GetOrCreateChild(middle, leafType);
     leaf->AddInstance(16);
 
     auto json = TypeReferenceTreeJsonSerializer::Serialize(tree, &frameStore);
@@ -1275,7 +1375,7 @@ TEST(TypeReferenceTreeJsonSerializerTest, WideTreeWithManyChildrenSerializes)
         std::string name = "Child" + std::to_string(i);
         frameStore.RegisterType(childType, name);
 
-        TypeTreeNode* child = root->GetOrCreateChild(childType);
+        TypeTreeNode* child = tree.GetOrCreateChild(root, childType);
         child->AddInstance(32 + i);
     }
 
@@ -1325,17 +1425,17 @@ TEST(TypeReferenceTreeJsonSerializerTest, DiamondPatternSerializes)
 
     TypeTreeNode* root = tree.AddRoot(typeRoot, RootCategory::Stack, 64);
 
-    TypeTreeNode* b = root->GetOrCreateChild(typeB);
+    TypeTreeNode* b = tree.GetOrCreateChild(root, typeB);
     b->AddInstance(32);
-    TypeTreeNode* c = root->GetOrCreateChild(typeC);
+    TypeTreeNode* c = tree.GetOrCreateChild(root, typeC);
     c->AddInstance(32);
 
     // D under B
-    TypeTreeNode* dB = b->GetOrCreateChild(typeD);
+    TypeTreeNode* dB = tree.GetOrCreateChild(b, typeD);
     dB->AddInstance(16);
 
     // D under C (separate node, same type)
-    TypeTreeNode* dC = c->GetOrCreateChild(typeD);
+    TypeTreeNode* dC = tree.GetOrCreateChild(c, typeD);
     dC->AddInstance(24);
 
     auto json = TypeReferenceTreeJsonSerializer::Serialize(tree, &frameStore);
@@ -1444,7 +1544,7 @@ TEST(TypeReferenceTreeJsonSerializerTest, ZeroInstanceCountOmittedFromJson)
     TypeTreeNode* root = tree.AddRoot(typeA, RootCategory::Stack, 64);
 
     // Create a child but never call AddInstance (ic=0, ts=0)
-    root->GetOrCreateChild(typeB);
+    tree.GetOrCreateChild(root, typeB);
 
     auto json = TypeReferenceTreeJsonSerializer::Serialize(tree, &frameStore);
 
@@ -1483,10 +1583,10 @@ TEST(TypeReferenceTreeJsonSerializerTest, SelfReferencingChainSerializes)
     // At the type level: LinkedNode (root) -> LinkedNode -> LinkedNode
     TypeTreeNode* root = tree.AddRoot(typeNode, RootCategory::Stack, 48);
 
-    TypeTreeNode* level2 = root->GetOrCreateChild(typeNode);
+    TypeTreeNode* level2 = tree.GetOrCreateChild(root, typeNode);
     level2->AddInstance(48);
 
-    TypeTreeNode* level3 = level2->GetOrCreateChild(typeNode);
+    TypeTreeNode* level3 = tree.GetOrCreateChild(level2, typeNode);
     level3->AddInstance(48);
 
     auto json = TypeReferenceTreeJsonSerializer::Serialize(tree, &frameStore);
@@ -1532,12 +1632,12 @@ TEST(TypeReferenceTreeJsonSerializerTest, MergedChildrenCountsSerialize)
 
     // First root traversal: Root -> Child (count=1, size=32)
     TypeTreeNode* root1 = tree.AddRoot(typeRoot, RootCategory::Stack, 64);
-    TypeTreeNode* child1 = root1->GetOrCreateChild(typeChild);
+    TypeTreeNode* child1 = tree.GetOrCreateChild(root1, typeChild);
     child1->AddInstance(32);
 
     // Second root traversal of same type: Root -> Child (count=1, size=48)
     TypeTreeNode* root2 = tree.AddRoot(typeRoot, RootCategory::Stack, 64);
-    TypeTreeNode* child2 = root2->GetOrCreateChild(typeChild);
+    TypeTreeNode* child2 = tree.GetOrCreateChild(root2, typeChild);
     child2->AddInstance(48);
 
     // child1 and child2 are the same node (merged)
@@ -1709,7 +1809,7 @@ TEST(TypeReferenceTreeBinarySerializerTest, RootWithChildrenRoundTrip)
     frameStore.RegisterType(typeB, "MyApp.Customer");
 
     TypeTreeNode* rootNode = tree.AddRoot(typeA, RootCategory::StaticVariable, 128);
-    TypeTreeNode* childNode = rootNode->GetOrCreateChild(typeB);
+    TypeTreeNode* childNode = tree.GetOrCreateChild(rootNode, typeB);
     childNode->AddInstance(64);
 
     auto bin = TypeReferenceTreeBinarySerializer::Serialize(tree, &frameStore);
@@ -1752,7 +1852,7 @@ TEST(TypeReferenceTreeBinarySerializerTest, UnresolvableTypeIsNamedQuestionMark)
     // typeUnknown is NOT registered in frameStore
 
     TypeTreeNode* root = tree.AddRoot(typeA, RootCategory::Stack, 64);
-    TypeTreeNode* child = root->GetOrCreateChild(typeUnknown);
+    TypeTreeNode* child = tree.GetOrCreateChild(root, typeUnknown);
     child->AddInstance(32);
 
     auto bin = TypeReferenceTreeBinarySerializer::Serialize(tree, &frameStore);
@@ -1795,9 +1895,9 @@ TEST(TypeReferenceTreeBinarySerializerTest, NodeTypeIndexMatchesStringTablePosit
     frameStore.RegisterType(leafType, "MyApp.Leaf");
 
     TypeTreeNode* root = tree.AddRoot(rootType, RootCategory::Stack, 64);
-    TypeTreeNode* middle = root->GetOrCreateChild(middleType);
+    TypeTreeNode* middle = tree.GetOrCreateChild(root, middleType);
     middle->AddInstance(32);
-    TypeTreeNode* leaf = middle->GetOrCreateChild(leafType);
+    TypeTreeNode* leaf = tree.GetOrCreateChild(middle, leafType);
     leaf->AddInstance(16);
 
     auto bin = TypeReferenceTreeBinarySerializer::Serialize(tree, &frameStore);
@@ -1902,7 +2002,7 @@ TEST(TypeReferenceTreeBinarySerializerTest, DeepHierarchyRoundTrip)
     TypeTreeNode* current = tree.AddRoot(100, RootCategory::Stack, 64);
     for (int i = 1; i <= depth; i++)
     {
-        TypeTreeNode* child = current->GetOrCreateChild(static_cast<ClassID>(100 + i));
+        TypeTreeNode* child = tree.GetOrCreateChild(current, static_cast<ClassID>(100 + i));
         child->AddInstance(32);
         current = child;
     }
@@ -1982,7 +2082,7 @@ TEST(TypeReferenceTreeBinarySerializerTest, BinarySmallerThanJson)
         {
             ClassID childType = static_cast<ClassID>(1000 + i * 10 + j);
             frameStore.RegisterType(childType, "Child" + std::to_string(i) + "_" + std::to_string(j));
-            TypeTreeNode* child = root->GetOrCreateChild(childType);
+            TypeTreeNode* child = tree.GetOrCreateChild(root, childType);
             child->AddInstance(32 + j);
         }
     }
@@ -2035,7 +2135,7 @@ TEST(TypeReferenceTreeBinarySerializerTest, TypeNamesAreNamespaceQualified)
     frameStore.RegisterType(typeB, "MyApp.Nested.Customer");
 
     TypeTreeNode* rootNode = tree.AddRoot(typeA, RootCategory::StaticVariable, 256);
-    rootNode->GetOrCreateChild(typeB)->AddInstance(64);
+    tree.GetOrCreateChild(rootNode, typeB)->AddInstance(64);
 
     auto bin = TypeReferenceTreeBinarySerializer::Serialize(tree, &frameStore);
     BinReader reader(bin);
@@ -2061,7 +2161,7 @@ TEST(TypeReferenceTreeJsonSerializerTest, TypeNamesAreNamespaceQualified)
     frameStore.RegisterType(typeB, "MyApp.Nested.Customer");
 
     TypeTreeNode* rootNode = tree.AddRoot(typeA, RootCategory::StaticVariable, 256);
-    rootNode->GetOrCreateChild(typeB)->AddInstance(64);
+    tree.GetOrCreateChild(rootNode, typeB)->AddInstance(64);
 
     auto json = TypeReferenceTreeJsonSerializer::Serialize(tree, &frameStore);
 
@@ -13,12 +13,14 @@
 #include "GCDescReader.h"
 #include "MemoryFaultGuard.h"
 
+#include <atomic>
 #include <cstdint>
 #include <cstring>
 #include <new>
 #include <stdexcept>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #ifdef LINUX
 #include <sys/mman.h>
@@ -439,9 +441,9 @@ TEST(ReferenceChainTraverserFaultTest, CachedInlineValueTypeSizeAvoidsTraversalL
     RootKey key{rootClass, RootCategory::Stack};
     auto rootIt = tree._roots.find(key);
     ASSERT_NE(rootIt, tree._roots.end());
-    const TypeTreeNode* valueTypeNode = rootIt->second->node.GetChild(valueTypeClass);
+    const TypeTreeNode* valueTypeNode = tree.GetChild(&rootIt->second->node, valueTypeClass);
     ASSERT_NE(valueTypeNode, nullptr);
-    ASSERT_NE(valueTypeNode->GetChild(childClass), nullptr);
+    ASSERT_NE(tree.GetChild(valueTypeNode, childClass), nullptr);
 }
 
 // The guard only recovers from memory access faults, so a C++ exception must pass straight
@@ -587,9 +589,9 @@ TEST(ReferenceChainTraverserFaultTest, TraversalResumesAfterFault)
     ASSERT_NE(it, tree._roots.end());
 
     const TypeTreeNode& rootNode = it->second->node;
-    const TypeTreeNode* childNode = rootNode.GetChild(childClass);
+    const TypeTreeNode* childNode = tree.GetChild(&rootNode, childClass);
     ASSERT_NE(childNode, nullptr);
-    ASSERT_NE(childNode->GetChild(grandChildClass), nullptr);
+    ASSERT_NE(tree.GetChild(childNode, grandChildClass), nullptr);
 
     UnmapPage(badPage);
 }
@@ -651,3 +653,240 @@ TEST(ReferenceChainTraverserFaultTest, SelfTestFailureStillDisablesPermanently)
 }
 
 #endif
+
+namespace
+{
+// Counts the profiling API calls: the traversal workers must not make any.
+class CountingGraphMockProfiler : public GraphMockProfiler
+{
+public:
+    HRESULT STDMETHODCALLTYPE GetClassFromObject(ObjectID objectId, ClassID* pClassId) override
+    {
+        GetClassFromObjectCallCount++;
+        return GraphMockProfiler::GetClassFromObject(objectId, pClassId);
+    }
+
+    std::atomic<size_t> GetClassFromObjectCallCount = 0;
+};
+
+// Objects laid out as in the CLR (MethodTable pointer first) so that the traversal workers
+// can read their class and size: each root references its own child and a shared one.
+// An array root (without references) is also needed to trust the component size.
+struct RootsWithRawLayout
+{
+    static constexpr size_t RootCount = 64;
+    static constexpr SIZE_T RootSize = 3 * sizeof(void*);
+    static constexpr SIZE_T ChildSize = 2 * sizeof(void*);
+    static constexpr SIZE_T ArrayBaseSize = 3 * sizeof(void*);
+    static constexpr uint32_t ArrayLength = 5;
+
+    alignas(64) std::uint8_t rootMt[4096]{};
+    alignas(64) std::uint8_t childMt[2][4096]{};
+    alignas(64) std::uint8_t arrayMt[4096]{};
+    alignas(8) uintptr_t roots[RootCount][3]{};
+    alignas(8) uintptr_t children[RootCount][2]{};
+    alignas(8) uintptr_t sharedChild[2]{};
+    alignas(8) uintptr_t arrayRoot[4]{};
+
+    ClassID rootClass = 0;
+    ClassID childClasses[2] = {};
+    ClassID arrayClass = 0;
+
+    void Build(GraphMockProfiler& profiler)
+    {
+        // two references after the MethodTable pointer
+        rootClass = BuildFakeMethodTableWithRefs(rootMt, sizeof(rootMt), 2, RootSize);
+        auto* seriesBase = reinterpret_cast<GCDesc::GCDescSeries*>(reinterpret_cast<ptrdiff_t*>(rootClass) - 1);
+        seriesBase[-1].offset = sizeof(void*);
+        reinterpret_cast<std::uint32_t*>(rootClass)[1] = static_cast<std::uint32_t>(RootSize);
+
+        for (int i = 0; i < 2; i++)
+        {
+            childClasses[i] = BuildFakeMethodTableNoPointers(childMt[i], sizeof(childMt[i]));
+            reinterpret_cast<std::uint32_t*>(childClasses[i])[1] = static_cast<std::uint32_t>(ChildSize);
+        }
+
+        sharedChild[0] = childClasses[1];
+        profiler.AddObject(reinterpret_cast<uintptr_t>(sharedChild), childClasses[1], ChildSize);
+
+        // byte array: the component size is the low WORD of the flags
+        arrayClass = BuildFakeMethodTableNoPointers(arrayMt, sizeof(arrayMt));
+        reinterpret_cast<std::uint32_t*>(arrayClass)[0] = GCDesc::Flag_HasComponentSize | 1;
+        reinterpret_cast<std::uint32_t*>(arrayClass)[1] = static_cast<std::uint32_t>(ArrayBaseSize);
+        arrayRoot[0] = arrayClass;
+        arrayRoot[1] = ArrayLength;
+        profiler.AddObject(reinterpret_cast<uintptr_t>(arrayRoot), arrayClass, GetArraySize());
+
+        for (size_t i = 0; i < RootCount; i++)
+        {
+            children[i][0] = childClasses[i % 2];
+            profiler.AddObject(reinterpret_cast<uintptr_t>(children[i]), childClasses[i % 2], ChildSize);
+
+            roots[i][0] = rootClass;
+            roots[i][1] = reinterpret_cast<uintptr_t>(children[i]);
+            roots[i][2] = reinterpret_cast<uintptr_t>(sharedChild);
+            profiler.AddObject(reinterpret_cast<uintptr_t>(roots[i]), rootClass, RootSize);
+        }
+    }
+
+    static SIZE_T GetArraySize()
+    {
+        return ArrayBaseSize + ArrayLength;
+    }
+
+    std::vector<RootInfo> GetRoots(bool withArrayRoot = true) const
+    {
+        std::vector<RootInfo> result;
+        if (withArrayRoot)
+        {
+            result.emplace_back(reinterpret_cast<uintptr_t>(arrayRoot), RootCategory::Stack, arrayClass, GetArraySize());
+        }
+        for (size_t i = 0; i < RootCount; i++)
+        {
+            result.emplace_back(reinterpret_cast<uintptr_t>(roots[i]), RootCategory::Stack, rootClass, RootSize);
+        }
+        return result;
+    }
+};
+
+void ExpectSameNodes(const TypeReferenceTree& expectedTree, const TypeTreeNode& expected, const TypeReferenceTree& tree, const TypeTreeNode& node)
+{
+    EXPECT_EQ(expected.instanceCount, node.instanceCount);
+    EXPECT_EQ(expected.totalSize, node.totalSize);
+    ASSERT_EQ(expected.childCount, node.childCount);
+
+    for (auto index = expected.firstChild; index != TypeTreeNode::NoNode; index = expectedTree.GetNode(index).nextSibling)
+    {
+        auto const& expectedChild = expectedTree.GetNode(index);
+        auto const* child = tree.GetChild(&node, expectedChild.typeID);
+        ASSERT_NE(child, nullptr);
+        ExpectSameNodes(expectedTree, expectedChild, tree, *child);
+    }
+}
+} // namespace
+
+TEST(ReferenceChainTraverserFaultTest, WorkersBuildTheSameTreeAsSequentialTraversal)
+{
+    RootsWithRawLayout graph;
+    CountingGraphMockProfiler sequentialProfiler;
+    graph.Build(sequentialProfiler);
+    auto roots = graph.GetRoots();
+
+    ICorProfilerInfo12* pSequentialInfo = reinterpret_cast<ICorProfilerInfo12*>(static_cast<ICorProfilerInfo4*>(&sequentialProfiler));
+    NullFrameStore frameStore;
+    TypeReferenceTree sequentialTree;
+    InlineVTCache sequentialVTCache(pSequentialInfo, nullptr);
+    {
+        ReferenceChainTraverser traverser(pSequentialInfo, &frameStore, sequentialTree, sequentialVTCache, 16);
+        traverser.TraverseRoots(roots);
+    }
+
+    CountingGraphMockProfiler profiler;
+    graph.Build(profiler);
+    ICorProfilerInfo12* pInfo = reinterpret_cast<ICorProfilerInfo12*>(static_cast<ICorProfilerInfo4*>(&profiler));
+    TypeReferenceTree tree;
+    InlineVTCache vtCache(pInfo, nullptr);
+    ReferenceChainTraverser traverser(pInfo, &frameStore, tree, vtCache, 16);
+    traverser.StartWorkers(4);
+
+    // several batches to reuse the workers
+    traverser.TraverseRoots(roots);
+    traverser.TraverseRoots(roots);
+    traverser.StopWorkers();
+
+    EXPECT_EQ(traverser.GetStopReason(), ReferenceChainTraverser::TraversalStopReason::None);
+    EXPECT_EQ(traverser.GetFaultCount(), 0u);
+
+    // the roots traversed by the workers did not call the profiling API
+    EXPECT_LT(profiler.GetClassFromObjectCallCount, 2 * sequentialProfiler.GetClassFromObjectCallCount);
+
+    RootKey key{graph.rootClass, RootCategory::Stack};
+    auto sequentialRoot = sequentialTree._roots.find(key);
+    auto root = tree._roots.find(key);
+    ASSERT_NE(sequentialRoot, sequentialTree._roots.end());
+    ASSERT_NE(root, tree._roots.end());
+    ASSERT_EQ(2 * RootsWithRawLayout::RootCount, root->second->node.instanceCount);
+
+    // the second batch counts twice as much as the sequential traversal
+    TypeReferenceTree doubledTree;
+    doubledTree.Merge(sequentialTree);
+    doubledTree.Merge(sequentialTree);
+    ExpectSameNodes(doubledTree, doubledTree._roots.find(key)->second->node, tree, root->second->node);
+}
+
+TEST(ReferenceChainTraverserFaultTest, WorkersAreNotUsedWhenTheRawLayoutDoesNotMatch)
+{
+    RootsWithRawLayout graph;
+    CountingGraphMockProfiler profiler;
+    graph.Build(profiler);
+
+    // the size read from the MethodTable is not the one returned by the profiling API
+    reinterpret_cast<std::uint32_t*>(graph.rootClass)[1] = 1024;
+
+    ICorProfilerInfo12* pInfo = reinterpret_cast<ICorProfilerInfo12*>(static_cast<ICorProfilerInfo4*>(&profiler));
+    NullFrameStore frameStore;
+    TypeReferenceTree tree;
+    InlineVTCache vtCache(pInfo, nullptr);
+    ReferenceChainTraverser traverser(pInfo, &frameStore, tree, vtCache, 16);
+    traverser.StartWorkers(4);
+
+    traverser.TraverseRoots(graph.GetRoots());
+    traverser.StopWorkers();
+
+    // every child was resolved by the profiling API
+    EXPECT_EQ(profiler.GetClassFromObjectCallCount, 2 * RootsWithRawLayout::RootCount);
+
+    RootKey key{graph.rootClass, RootCategory::Stack};
+    auto root = tree._roots.find(key);
+    ASSERT_NE(root, tree._roots.end());
+    EXPECT_EQ(RootsWithRawLayout::RootCount, root->second->node.instanceCount);
+    EXPECT_EQ(2u, root->second->node.childCount);
+}
+
+TEST(ReferenceChainTraverserFaultTest, WorkersAreNotUsedBeforeTheComponentSizeIsChecked)
+{
+    RootsWithRawLayout graph;
+    CountingGraphMockProfiler profiler;
+    graph.Build(profiler);
+
+    ICorProfilerInfo12* pInfo = reinterpret_cast<ICorProfilerInfo12*>(static_cast<ICorProfilerInfo4*>(&profiler));
+    NullFrameStore frameStore;
+    TypeReferenceTree tree;
+    InlineVTCache vtCache(pInfo, nullptr);
+    ReferenceChainTraverser traverser(pInfo, &frameStore, tree, vtCache, 16);
+    traverser.StartWorkers(4);
+
+    // no array among the roots: the size of the arrays read from the MethodTable is not trusted
+    traverser.TraverseRoots(graph.GetRoots(false));
+    traverser.StopWorkers();
+
+    // every child was resolved by the profiling API
+    EXPECT_EQ(profiler.GetClassFromObjectCallCount, 2 * RootsWithRawLayout::RootCount);
+}
+
+TEST(ReferenceChainTraverserFaultTest, StoppedWorkersAreNotWaitedFor)
+{
+    RootsWithRawLayout graph;
+    CountingGraphMockProfiler profiler;
+    graph.Build(profiler);
+    auto roots = graph.GetRoots();
+
+    ICorProfilerInfo12* pInfo = reinterpret_cast<ICorProfilerInfo12*>(static_cast<ICorProfilerInfo4*>(&profiler));
+    NullFrameStore frameStore;
+    TypeReferenceTree tree;
+    InlineVTCache vtCache(pInfo, nullptr);
+    ReferenceChainTraverser traverser(pInfo, &frameStore, tree, vtCache, 16);
+    traverser.StartWorkers(4);
+
+    // the workers are used for the second half of the roots
+    traverser.TraverseRoots(roots);
+    traverser.StopWorkers();
+
+    // the roots are traversed sequentially instead of waiting for ever for the stopped workers
+    traverser.TraverseRoots(roots);
+
+    RootKey key{graph.rootClass, RootCategory::Stack};
+    auto root = tree._roots.find(key);
+    ASSERT_NE(root, tree._roots.end());
+    EXPECT_EQ(2 * RootsWithRawLayout::RootCount, root->second->node.instanceCount);
+}
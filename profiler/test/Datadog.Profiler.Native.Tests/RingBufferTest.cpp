@@ -6,10 +6,11 @@
 #include "gtest/gtest.h"
 
 #include "RingBuffer.h"
-#include "SpinningMutex.hpp"
 
 #include "OpSysTools.h"
 
+#include <algorithm>
+
 TEST(RingBufferTest, CheckRingBufferSizing)
 {
     // RingBuffer size = data size + metadata size
@@ -139,18 +140,96 @@ TEST(RingBufferTest, AddFakeSamplesAsMuchAsPossible)
     ASSERT_EQ(r.AvailableSamples(), 0);
 }
 
-TEST(RingBufferTest, StaleLock)
+TEST(RingBufferTest, PendingReservationDoesNotBlockOtherWriters)
 {
-    auto rb = RingBuffer(42, 4);
-    auto w = rb.GetWriter();
+    auto sampleSize = 16;
+    auto rb = RingBuffer(4096, sampleSize);
 
-    rb.GetLock()->lock();
+    // the first writer reserves but does not commit (e.g. interrupted signal handler)
+    auto w1 = rb.GetWriter();
     auto timeout = false;
+    auto buffer1 = w1.Reserve(&timeout);
+    ASSERT_FALSE(buffer1.empty());
+    ASSERT_FALSE(timeout);
+
+    // another writer must still be able to reserve and commit
+    auto w2 = rb.GetWriter();
+    auto buffer2 = w2.Reserve(&timeout);
+    ASSERT_FALSE(buffer2.empty());
+    ASSERT_FALSE(timeout);
+    buffer2[0] = (std::byte)2;
+    w2.Commit(buffer2);
 
-    ASSERT_TRUE(w.Reserve(&timeout).empty());
-    ASSERT_TRUE(timeout);
+    {
+        // the reader stops at the first sample that is not committed yet
+        auto r = rb.GetReader();
+        ASSERT_EQ(r.AvailableSamples(), 2);
+        ASSERT_TRUE(r.GetNext().empty());
+    }
+
+    buffer1[0] = (std::byte)1;
+    w1.Commit(buffer1);
+
+    auto r = rb.GetReader();
+    auto readBuffer = r.GetNext();
+    ASSERT_FALSE(readBuffer.empty());
+    ASSERT_EQ(readBuffer[0], (std::byte)1);
+    readBuffer = r.GetNext();
+    ASSERT_FALSE(readBuffer.empty());
+    ASSERT_EQ(readBuffer[0], (std::byte)2);
+    ASSERT_TRUE(r.GetNext().empty());
 }
 
+TEST(RingBufferTest, ReuseConsumedSpaceAcrossLaps)
+{
+    // sample size + header is not a divisor of the buffer size: headers of the next laps
+    // land in the middle of the previously consumed samples
+    auto sampleSize = 37;
+    auto rb = RingBuffer(4096, sampleSize);
+
+    for (int lap = 0; lap < 50; lap++)
+    {
+        auto nbSamples = 0;
+        while (true)
+        {
+            auto w = rb.GetWriter();
+            auto buffer = w.Reserve();
+            if (buffer.empty())
+            {
+                break;
+            }
+
+            // fill the payload with non-zero bytes that could be mistaken for a header
+            std::fill(buffer.begin(), buffer.end(), (std::byte)0xFF);
+            buffer[0] = (std::byte)(nbSamples % 256);
+            w.Commit(buffer);
+            nbSamples++;
+        }
+        ASSERT_GT(nbSamples, 0);
+
+        auto r = rb.GetReader();
+        ASSERT_EQ(r.AvailableSamples(), nbSamples);
+        for (int i = 0; i < nbSamples; i++)
+        {
+            auto buffer = r.GetNext();
+            ASSERT_EQ(buffer.size(), sampleSize);
+            ASSERT_EQ(buffer[0], (std::byte)(i % 256));
+        }
+        ASSERT_TRUE(r.GetNext().empty());
+    }
+
+    // a slot reserved but not yet committed must not expose stale data to the reader
+    auto w = rb.GetWriter();
+    auto buffer = w.Reserve();
+    ASSERT_FALSE(buffer.empty());
+    {
+        auto r = rb.GetReader();
+        ASSERT_TRUE(r.GetNext().empty());
+    }
+    w.Commit(buffer);
+    auto r = rb.GetReader();
+    ASSERT_FALSE(r.GetNext().empty());
+}
 
 TEST(RingBufferTest, CheckDiscard)
 {
@@ -10,11 +10,13 @@
 #include "FakeSamples.h"
 #include "IExporter.h"
 #include "ISamplesProvider.h"
+#include "MetricsRegistry.h"
 #include "ProfilerMockedInterface.h"
 #include "Sample.h"
 #include "SamplesEnumerator.h"
 #include "ThreadsCpuManagerHelper.h"
 
+#include <atomic>
 #include <chrono>
 #include <list>
 #include <tuple>
@@ -121,8 +123,9 @@ TEST(SamplesCollectorTest, MustCollectSamplesFromTwoProviders)
 
     auto exporter = CreateTransparentExporter(pendingSamples, exportedSamples);
     auto metricsSender = MockMetricsSender();
+    MetricsRegistry metricsRegistry;
 
-    auto collector = SamplesCollector(configuration.get(), &threadsCpuManagerHelper, exporter.get(), &metricsSender);
+    auto collector = SamplesCollector(configuration.get(), &threadsCpuManagerHelper, exporter.get(), &metricsSender, metricsRegistry);
     collector.Register(&samplesProvider);
     collector.Register(&samplesProvider2);
 
@@ -186,8 +189,9 @@ TEST(SamplesCollectorTest, MustCollectSamplesFromProviderAndBatchedProvider)
 
     auto exporter = CreateTransparentExporter(pendingSamples, exportedSamples);
     auto metricsSender = MockMetricsSender();
+    MetricsRegistry metricsRegistry;
 
-    auto collector = SamplesCollector(configuration.get(), &threadsCpuManagerHelper, exporter.get(), &metricsSender);
+    auto collector = SamplesCollector(configuration.get(), &threadsCpuManagerHelper, exporter.get(), &metricsSender, metricsRegistry);
     collector.Register(&samplesProvider);
     collector.RegisterBatchedProvider(&batchedSamplesProvider);
 
@@ -246,8 +250,9 @@ TEST(SamplesCollectorTest, MustStopCollectingSamples)
 
     auto [exporter, mockExporter] = CreateExporter();
     auto metricsSender = MockMetricsSender();
+    MetricsRegistry metricsRegistry;
 
-    auto collector = SamplesCollector(configuration.get(), &threadsCpuManagerHelper, exporter.get(), &metricsSender);
+    auto collector = SamplesCollector(configuration.get(), &threadsCpuManagerHelper, exporter.get(), &metricsSender, metricsRegistry);
     collector.Register(&samplesProvider);
 
     collector.Start();
@@ -267,6 +272,48 @@ TEST(SamplesCollectorTest, MustStopCollectingSamples)
     ASSERT_EQ(newExportsCount, exportsCount);
 }
 
+TEST(SamplesCollectorTest, MustKeepCollectingSamplesWhileExporting)
+{
+    auto [configuration, mockConfiguration] = CreateConfiguration();
+    EXPECT_CALL(mockConfiguration, GetUploadInterval()).Times(1).WillOnce(Return(1000s));
+
+    std::atomic<int> addedSamples = 0;
+    int addedSamplesDuringExport = 0;
+
+    auto [exporter, mockExporter] = CreateExporter();
+    EXPECT_CALL(mockExporter, Add(_))
+        .WillRepeatedly(InvokeWithoutArgs([&addedSamples] { addedSamples++; }));
+    EXPECT_CALL(mockExporter, Export(_))
+        .WillOnce(Invoke([&addedSamples, &addedSamplesDuringExport] {
+            // simulate a slow upload: the worker thread must still be able to add samples
+            auto before = addedSamples.load();
+            auto deadline = std::chrono::steady_clock::now() + 2s;
+            while ((addedSamples.load() < before + 2) && (std::chrono::steady_clock::now() < deadline))
+            {
+                std::this_thread::sleep_for(10ms);
+            }
+            addedSamplesDuringExport = addedSamples.load() - before;
+            return true;
+        }))
+        .WillRepeatedly(Return(true)); // last export when stopping
+
+    const std::string runtimeId = "MyRid";
+    FakeSamplesProvider<ISamplesProvider> samplesProvider(runtimeId, 1);
+
+    auto metricsSender = MockMetricsSender();
+    MetricsRegistry metricsRegistry;
+    auto threadsCpuManagerHelper = ThreadsCpuManagerHelper();
+
+    auto collector = SamplesCollector(configuration.get(), &threadsCpuManagerHelper, exporter.get(), &metricsSender, metricsRegistry);
+    collector.Register(&samplesProvider);
+
+    collector.Start();
+    collector.Export();
+    collector.Stop();
+
+    ASSERT_GE(addedSamplesDuringExport, 2);
+}
+
 TEST(SamplesCollectorTest, MustNotFailWhenSendingProfileThrows)
 {
     auto [configuration, mockConfiguration] = CreateConfiguration();
@@ -280,9 +327,10 @@ TEST(SamplesCollectorTest, MustNotFailWhenSendingProfileThrows)
     FakeSamplesProvider<ISamplesProvider> samplesProvider(runtimeId, 1);
 
     auto metricsSender = MockMetricsSender();
+    MetricsRegistry metricsRegistry;
     auto threadsCpuManagerHelper = ThreadsCpuManagerHelper();
 
-    auto collector = SamplesCollector(&mockConfiguration, &threadsCpuManagerHelper, &mockExporter, &metricsSender);
+    auto collector = SamplesCollector(&mockConfiguration, &threadsCpuManagerHelper, &mockExporter, &metricsSender, metricsRegistry);
 
     collector.Register(&samplesProvider);
 
@@ -306,12 +354,13 @@ TEST(SamplesCollectorTest, MustExportAfterStop)
     EXPECT_CALL(mockExporter, Export(_)).Times(1).WillRepeatedly(Return(true));
 
     auto metricsSender = MockMetricsSender();
+    MetricsRegistry metricsRegistry;
     auto threadsCpuManagerHelper = ThreadsCpuManagerHelper();
 
     const std::string runtimeId = "MyRid";
     FakeSamplesProvider<ISamplesProvider> samplesProvider(runtimeId, 1);
 
-    auto collector = SamplesCollector(&mockConfiguration, &threadsCpuManagerHelper, &mockExporter, &metricsSender);
+    auto collector = SamplesCollector(&mockConfiguration, &threadsCpuManagerHelper, &mockExporter, &metricsSender, metricsRegistry);
 
     collector.Register(&samplesProvider);
 
@@ -338,9 +387,10 @@ TEST(SamplesCollectorTest, MustNotFailWhenAddingSampleThrows)
     EXPECT_CALL(mockExporter, Export(_)).Times(1); // Called once when stopping
 
     auto metricsSender = MockMetricsSender();
+    MetricsRegistry metricsRegistry;
     auto threadsCpuManagerHelper = ThreadsCpuManagerHelper();
 
-    auto collector = SamplesCollector(&mockConfiguration, &threadsCpuManagerHelper, &mockExporter, &metricsSender);
+    auto collector = SamplesCollector(&mockConfiguration, &threadsCpuManagerHelper, &mockExporter, &metricsSender, metricsRegistry);
 
     collector.Register(&samplesProvider);
 
@@ -378,9 +428,10 @@ TEST(SamplesCollectorTest, MustdNotAddSampleInExporterIfEmptyCallstack)
     EXPECT_CALL(mockExporter, Add(_)).Times(0);
 
     auto metricsSender = MockMetricsSender();
+    MetricsRegistry metricsRegistry;
     auto threadsCpuManagerHelper = ThreadsCpuManagerHelper();
 
-    auto collector = SamplesCollector(&mockConfiguration, &threadsCpuManagerHelper, &mockExporter, &metricsSender);
+    auto collector = SamplesCollector(&mockConfiguration, &threadsCpuManagerHelper, &mockExporter, &metricsSender, metricsRegistry);
 
     collector.Register(samplesProvider.get());
 
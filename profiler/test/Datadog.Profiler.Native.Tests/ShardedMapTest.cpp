@@ -0,0 +1,128 @@
+// Unless explicitly stated otherwise all files in this repository are licensed under the Apache 2 License.
+// This product includes software developed at Datadog (https://www.datadoghq.com/). Copyright 2025 Datadog, Inc.
+
+#include "gtest/gtest.h"
+
+#include "ShardedMap.h"
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(ShardedMapTest, FindReturnsNullWhenKeyIsMissing)
+{
+    ShardedMap<std::uintptr_t, std::string> map;
+
+    ASSERT_EQ(nullptr, map.Find(42));
+    ASSERT_EQ(0, map.Size());
+}
+
+TEST(ShardedMapTest, EmplaceDoesNotOverwriteExistingElement)
+{
+    ShardedMap<std::uintptr_t, std::string> map;
+
+    auto [first, firstInserted] = map.Emplace(42, "first");
+    ASSERT_TRUE(firstInserted);
+    ASSERT_EQ("first", *first);
+
+    auto [second, secondInserted] = map.Emplace(42, "second");
+    ASSERT_FALSE(secondInserted);
+    ASSERT_EQ(first, second);
+    ASSERT_EQ("first", *second);
+
+    ASSERT_EQ(first, map.Find(42));
+    ASSERT_EQ(1, map.Size());
+}
+
+TEST(ShardedMapTest, EraseRemovesOnlyTheGivenKey)
+{
+    ShardedMap<std::uintptr_t, std::string> map;
+    map.Emplace(42, "first");
+    auto [other, inserted] = map.Emplace(43, "other");
+
+    ASSERT_TRUE(map.Erase(42));
+    ASSERT_FALSE(map.Erase(42));
+
+    std::string value;
+    ASSERT_FALSE(map.TryGet(42, value));
+    ASSERT_EQ(nullptr, map.Find(42));
+    ASSERT_EQ(1, map.Size());
+
+    // the other elements are not moved
+    ASSERT_EQ(other, map.Find(43));
+    ASSERT_TRUE(map.TryGet(43, value));
+    ASSERT_EQ("other", value);
+
+    // an erased key can be added again
+    auto [again, insertedAgain] = map.Emplace(42, "again");
+    ASSERT_TRUE(insertedAgain);
+    ASSERT_EQ("again", *again);
+}
+
+TEST(ShardedMapTest, ElementsAreStableWhenMapGrows)
+{
+    ShardedMap<std::uintptr_t, std::string> map;
+
+    auto [element, _] = map.Emplace(0x1000, "stable");
+    for (std::uintptr_t i = 1; i < 10000; i++)
+    {
+        map.Emplace(0x1000 + i * 16, std::to_string(i));
+    }
+
+    ASSERT_EQ(element, map.Find(0x1000));
+    ASSERT_EQ("stable", *element);
+    ASSERT_EQ(10000, map.Size());
+
+    std::size_t count = 0;
+    map.ForEach([&count](std::uintptr_t, std::string const&) { count++; });
+    ASSERT_EQ(10000, count);
+}
+
+TEST(ShardedMapTest, ConcurrentThreadsResolveOverlappingKeysOnce)
+{
+    ShardedMap<std::uintptr_t, std::uintptr_t> map;
+    std::atomic<std::size_t> insertions = 0;
+    std::atomic<std::size_t> errors = 0;
+
+    const std::size_t nbThreads = 8;
+    const std::uintptr_t nbKeys = 2000;
+
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < nbThreads; t++)
+    {
+        threads.emplace_back([&]() {
+            for (std::uintptr_t i = 0; i < nbKeys; i++)
+            {
+                // addresses like FunctionIDs are aligned
+                auto key = 0x7f0000000000 + i * 8;
+
+                auto* value = map.Find(key);
+                if (value == nullptr)
+                {
+                    auto [inserted, isNew] = map.Emplace(key, i);
+                    if (isNew)
+                    {
+                        insertions++;
+                    }
+                    value = inserted;
+                }
+
+                if (*value != i)
+                {
+                    errors++;
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    ASSERT_EQ(0, errors.load());
+    ASSERT_EQ(nbKeys, insertions.load());
+    ASSERT_EQ(nbKeys, map.Size());
+}
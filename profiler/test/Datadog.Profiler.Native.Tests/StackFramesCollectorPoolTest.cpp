@@ -0,0 +1,110 @@
+// Unless explicitly stated otherwise all files in this repository are licensed under the Apache 2 License.
+// This product includes software developed at Datadog (https://www.datadoghq.com/). Copyright 2025 Datadog, Inc.
+
+#include "gtest/gtest.h"
+
+#include "MetricsRegistry.h"
+#include "StackFramesCollectorPool.h"
+
+#include "MockProfilerInfo.h"
+#include "ProfilerMockedInterface.h"
+
+#ifdef LINUX
+#include "profiler/src/ProfilerEngine/Datadog.Profiler.Native.Linux/ProfilerSignalManager.h"
+
+#include <signal.h>
+#endif
+
+#include <set>
+
+class StackFramesCollectorPoolTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+#ifdef LINUX
+        // the Linux collectors install the profiler signal handler
+        sigaction(SIGUSR1, nullptr, &_oldAction);
+#endif
+        auto [configuration, mockConfiguration] = CreateConfiguration();
+        _configuration = std::move(configuration);
+        _pool = std::make_unique<StackFramesCollectorPool>(&_profilerInfo, _configuration.get(), nullptr, _metricsRegistry);
+    }
+
+    void TearDown() override
+    {
+        _pool.reset();
+#ifdef LINUX
+        ProfilerSignalManager::Get(SIGUSR1)->Reset();
+        sigaction(SIGUSR1, &_oldAction, nullptr);
+#endif
+    }
+
+    MockProfilerInfo _profilerInfo;
+    MetricsRegistry _metricsRegistry;
+    std::unique_ptr<IConfiguration> _configuration;
+    std::unique_ptr<StackFramesCollectorPool> _pool;
+#ifdef LINUX
+    struct sigaction _oldAction;
+#endif
+};
+
+TEST_F(StackFramesCollectorPoolTest, CollectorIsReusedAcrossLeases)
+{
+    ASSERT_EQ(0u, _pool->GetCreatedCount());
+
+    StackFramesCollectorBase* collector = nullptr;
+    {
+        auto lease = _pool->Acquire();
+        collector = lease.Get();
+        ASSERT_NE(nullptr, collector);
+        ASSERT_EQ(1u, _pool->GetCreatedCount());
+    }
+
+    // the collector was given back when the lease was destroyed
+    for (auto i = 0; i < 10; i++)
+    {
+        auto lease = _pool->Acquire();
+        ASSERT_EQ(collector, lease.Get());
+    }
+    ASSERT_EQ(1u, _pool->GetCreatedCount());
+}
+
+TEST_F(StackFramesCollectorPoolTest, ConcurrentLeasesGetTheirOwnCollector)
+{
+    std::set<StackFramesCollectorBase*> collectors;
+    {
+        auto lease1 = _pool->Acquire();
+        auto lease2 = _pool->Acquire();
+        ASSERT_NE(lease1.Get(), lease2.Get());
+        ASSERT_EQ(2u, _pool->GetCreatedCount());
+
+        collectors = {lease1.Get(), lease2.Get()};
+    }
+
+    // both collectors are available again
+    auto lease1 = _pool->Acquire();
+    auto lease2 = _pool->Acquire();
+    ASSERT_EQ(collectors, (std::set<StackFramesCollectorBase*>{lease1.Get(), lease2.Get()}));
+    ASSERT_EQ(2u, _pool->GetCreatedCount());
+}
+
+TEST_F(StackFramesCollectorPoolTest, MovedLeaseGivesBackTheCollectorOnce)
+{
+    StackFramesCollectorBase* collector = nullptr;
+    {
+        auto lease = _pool->Acquire();
+        collector = lease.Get();
+
+        StackFramesCollectorPool::Lease movedLease(std::move(lease));
+        ASSERT_EQ(collector, movedLease.Get());
+        ASSERT_EQ(nullptr, lease.Get());
+    }
+
+    // the moved-from lease must not give back the collector a second time
+    auto lease1 = _pool->Acquire();
+    auto lease2 = _pool->Acquire();
+    ASSERT_EQ(collector, lease1.Get());
+    ASSERT_NE(collector, lease2.Get());
+    ASSERT_EQ(2u, _pool->GetCreatedCount());
+}
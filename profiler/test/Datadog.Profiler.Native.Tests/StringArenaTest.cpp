@@ -0,0 +1,70 @@
+// Unless explicitly stated otherwise all files in this repository are licensed under the Apache 2 License.
+// This product includes software developed at Datadog (https://www.datadoghq.com/). Copyright 2025 Datadog, Inc.
+
+#include "gtest/gtest.h"
+
+#include "StringArena.h"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+TEST(StringArenaTest, AllocatedStringsAreCopied)
+{
+    StringArena arena;
+
+    std::string value = "|lm:MyAssembly |ns:MyNamespace |ct:MyType |cg: |fn:MyMethod |fg: |sg:()";
+    auto stored = arena.Allocate(value);
+    value = "modified";
+
+    ASSERT_EQ("|lm:MyAssembly |ns:MyNamespace |ct:MyType |cg: |fn:MyMethod |fg: |sg:()", stored);
+    // stored strings are null terminated
+    ASSERT_EQ('\0', stored.data()[stored.size()]);
+}
+
+TEST(StringArenaTest, EmptyStringDoesNotUseMemory)
+{
+    StringArena arena;
+
+    auto stored = arena.Allocate("");
+
+    ASSERT_TRUE(stored.empty());
+    ASSERT_EQ(0, arena.GetUsedSize());
+    ASSERT_EQ(0, arena.GetBlocksCount());
+}
+
+TEST(StringArenaTest, InternedStringsAreStoredOnce)
+{
+    StringArena arena;
+
+    auto first = arena.Intern(std::string("System.Private.CoreLib"));
+    auto second = arena.Intern(std::string("System.Private.CoreLib"));
+    auto other = arena.Intern(std::string("System.Runtime"));
+
+    ASSERT_EQ(first.data(), second.data());
+    ASSERT_NE(first.data(), other.data());
+    ASSERT_EQ(2, arena.GetInternedCount());
+}
+
+TEST(StringArenaTest, StringsStayValidWhenNewBlocksAreAllocated)
+{
+    StringArena arena(128);
+
+    std::vector<std::string_view> stored;
+    for (int i = 0; i < 1000; i++)
+    {
+        stored.push_back(arena.Allocate("frame #" + std::to_string(i)));
+    }
+
+    // larger than a quarter of a block: gets its own block
+    std::string large(100, 'x');
+    auto storedLarge = arena.Allocate(large);
+
+    for (int i = 0; i < 1000; i++)
+    {
+        ASSERT_EQ("frame #" + std::to_string(i), stored[i]);
+    }
+    ASSERT_EQ(large, storedLarge);
+    ASSERT_GT(arena.GetBlocksCount(), 1);
+    ASSERT_GE(arena.GetMemorySize(), arena.GetUsedSize());
+}
@@ -0,0 +1,146 @@
+// Unless explicitly stated otherwise all files in this repository are licensed under the Apache 2 License.
+// This product includes software developed at Datadog (https://www.datadoghq.com/). Copyright 2025 Datadog, Inc.
+
+#ifdef LINUX
+
+#include "gtest/gtest.h"
+
+#include "OpSysTools.h"
+#include "ThreadStatFile.h"
+
+#include <chrono>
+#include <future>
+#include <sys/syscall.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+pid_t GetCurrentTid()
+{
+    return static_cast<pid_t>(syscall(SYS_gettid));
+}
+
+bool ReadState(ThreadStatFile& statFile, pid_t tid, char& state)
+{
+    char line[1024];
+    auto length = statFile.Read(tid, line, sizeof(line) - 1);
+    if (length <= 0)
+    {
+        return false;
+    }
+    line[length] = '\0';
+
+    int32_t userTime = 0;
+    int32_t kernelTime = 0;
+    return OpSysTools::ParseThreadInfo(line, state, userTime, kernelTime);
+}
+
+} // namespace
+
+TEST(ThreadStatFileTest, CheckBuildPath)
+{
+    char statPath[64] = {0};
+    ASSERT_TRUE(ThreadStatFile::BuildPath(1234, statPath, sizeof(statPath)));
+    ASSERT_STREQ("/proc/self/task/1234/stat", statPath);
+}
+
+TEST(ThreadStatFileTest, FileIsKeptOpenedBetweenReads)
+{
+    auto openedFiles = ThreadStatFile::GetOpenedFilesCount();
+    {
+        ThreadStatFile statFile;
+
+        char state = ' ';
+        ASSERT_TRUE(ReadState(statFile, GetCurrentTid(), state));
+        ASSERT_EQ('R', state);
+        ASSERT_EQ(openedFiles + 1, ThreadStatFile::GetOpenedFilesCount());
+
+        ASSERT_TRUE(ReadState(statFile, GetCurrentTid(), state));
+        ASSERT_EQ('R', state);
+        ASSERT_EQ(openedFiles + 1, ThreadStatFile::GetOpenedFilesCount());
+    }
+
+    ASSERT_EQ(openedFiles, ThreadStatFile::GetOpenedFilesCount());
+}
+
+TEST(ThreadStatFileTest, OpenedFilesAreCapped)
+{
+    auto openedFiles = ThreadStatFile::GetOpenedFilesCount();
+    {
+        std::vector<ThreadStatFile> statFiles(ThreadStatFile::MaxOpenedFiles + 10);
+        for (auto& statFile : statFiles)
+        {
+            // the files beyond the limit are still read but not kept opened
+            char state = ' ';
+            ASSERT_TRUE(ReadState(statFile, GetCurrentTid(), state));
+        }
+
+        ASSERT_LE(ThreadStatFile::GetOpenedFilesCount(), ThreadStatFile::MaxOpenedFiles);
+        ASSERT_GT(ThreadStatFile::GetOpenedFilesCount(), openedFiles);
+    }
+
+    ASSERT_EQ(openedFiles, ThreadStatFile::GetOpenedFilesCount());
+}
+
+TEST(ThreadStatFileTest, FileIsReopenedWhenThreadIdChanges)
+{
+    auto openedFiles = ThreadStatFile::GetOpenedFilesCount();
+    ThreadStatFile statFile;
+
+    std::promise<pid_t> threadId;
+    std::promise<void> stopThread;
+    std::thread t([&threadId, stopFuture = stopThread.get_future()]() {
+        threadId.set_value(GetCurrentTid());
+        stopFuture.wait();
+    });
+    auto tid = threadId.get_future().get();
+
+    // the other thread may still be running until it starts waiting: poll its state for a while
+    char state = 'R';
+    for (auto i = 0; i < 500 && state == 'R'; i++)
+    {
+        if (i > 0)
+        {
+            std::this_thread::sleep_for(10ms);
+        }
+        ASSERT_TRUE(ReadState(statFile, tid, state));
+        ASSERT_EQ(openedFiles + 1, ThreadStatFile::GetOpenedFilesCount());
+    }
+    ASSERT_NE('R', state);
+
+    ASSERT_TRUE(ReadState(statFile, GetCurrentTid(), state));
+    ASSERT_EQ('R', state);
+    ASSERT_EQ(openedFiles + 1, ThreadStatFile::GetOpenedFilesCount());
+
+    stopThread.set_value();
+    t.join();
+}
+
+TEST(ThreadStatFileTest, ReadFailsWhenThreadIsDead)
+{
+    auto openedFiles = ThreadStatFile::GetOpenedFilesCount();
+    ThreadStatFile statFile;
+
+    std::promise<void> stopThread;
+    std::promise<pid_t> threadId;
+    std::thread t([&threadId, stopFuture = stopThread.get_future()]() {
+        threadId.set_value(GetCurrentTid());
+        stopFuture.wait();
+    });
+    auto tid = threadId.get_future().get();
+
+    char state = ' ';
+    ASSERT_TRUE(ReadState(statFile, tid, state));
+
+    stopThread.set_value();
+    t.join();
+
+    ASSERT_FALSE(ReadState(statFile, tid, state));
+    ASSERT_EQ(openedFiles, ThreadStatFile::GetOpenedFilesCount());
+}
+
+#endif
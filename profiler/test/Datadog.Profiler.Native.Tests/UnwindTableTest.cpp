@@ -0,0 +1,210 @@
+// Unless explicitly stated otherwise all files in this repository are licensed under the Apache 2 License.
+// This product includes software developed at Datadog (https://www.datadoghq.com/). Copyright 2025 Datadog, Inc.
+
+#ifdef AMD64
+
+#include "gtest/gtest.h"
+
+#include "MemoryResourceManager.h"
+#include "UnwindTable.h"
+
+#include <algorithm>
+#include <execinfo.h>
+#include <link.h>
+#include <ucontext.h>
+#include <vector>
+
+namespace {
+
+struct UnwindTables
+{
+    UnwindTables() :
+        Rows(MemoryResourceManager::GetDefault())
+    {
+        dl_iterate_phdr(
+            [](struct dl_phdr_info* info, std::size_t, void* data) {
+                auto* tables = static_cast<UnwindTables*>(data);
+                UnwindTableRegion region{};
+                if (UnwindTableBuilder::Build(info, tables->Rows, region))
+                {
+                    tables->Regions.push_back(region);
+                }
+                return 0;
+            },
+            this);
+    }
+
+    UnwindRow const* Find(std::uintptr_t ip) const
+    {
+        for (auto const& region : Regions)
+        {
+            if (ip >= region.addrLow && ip < region.addrHigh)
+            {
+                return UnwindTableBuilder::Find(region, Rows.data(), ip);
+            }
+        }
+        return nullptr;
+    }
+
+    UnwindTableBuilder::RowsVector Rows;
+    std::vector<UnwindTableRegion> Regions;
+};
+
+// Walk the current stack with the tables only
+__attribute__((noinline)) std::vector<std::uintptr_t> WalkStackWithTables(UnwindTables const& tables)
+{
+    std::vector<std::uintptr_t> frames;
+
+    ucontext_t context;
+    getcontext(&context);
+    std::uintptr_t ip = context.uc_mcontext.gregs[REG_RIP];
+    std::uintptr_t sp = context.uc_mcontext.gregs[REG_RSP];
+    std::uintptr_t fp = context.uc_mcontext.gregs[REG_RBP];
+
+    bool isReturnAddress = false;
+    while (ip != 0 && frames.size() < 64)
+    {
+        frames.push_back(ip);
+
+        auto const* row = tables.Find(isReturnAddress ? ip - 1 : ip);
+        if (row == nullptr)
+        {
+            break;
+        }
+
+        auto cfa = (row->cfaRegister == CfaRegister::Sp ? sp : fp) + row->cfaOffset;
+        if (row->fpOffset != 0)
+        {
+            fp = *reinterpret_cast<std::uintptr_t*>(cfa + row->fpOffset);
+        }
+        ip = *reinterpret_cast<std::uintptr_t*>(cfa - sizeof(void*));
+        sp = cfa;
+        isReturnAddress = true;
+    }
+
+    return frames;
+}
+
+__attribute__((noinline)) std::vector<std::uintptr_t> RecursiveWalk(UnwindTables const& tables, int depth)
+{
+    // force a stack frame with locals
+    volatile char buffer[64];
+    buffer[0] = static_cast<char>(depth);
+    if (depth == 0)
+    {
+        return WalkStackWithTables(tables);
+    }
+    auto frames = RecursiveWalk(tables, depth - 1);
+    frames.push_back(buffer[0]);
+    frames.pop_back();
+    return frames;
+}
+
+__attribute__((noinline)) void KnownTestFunction_ForUnwindTableTest()
+{
+    asm volatile("");
+}
+
+} // namespace
+
+TEST(UnwindTableTest, RuleAtFunctionEntryIsReturnAddressOnTopOfStack)
+{
+    UnwindTables tables;
+
+    ASSERT_FALSE(tables.Regions.empty());
+
+    // at the first instruction of a function, the return address was just pushed by the call
+    auto const* row = tables.Find(reinterpret_cast<std::uintptr_t>(&KnownTestFunction_ForUnwindTableTest));
+    ASSERT_NE(nullptr, row);
+    ASSERT_EQ(CfaRegister::Sp, row->cfaRegister);
+    ASSERT_EQ(8, row->cfaOffset);
+    ASSERT_EQ(0, row->fpOffset);
+}
+
+TEST(UnwindTableTest, UnknownAddressIsNotCovered)
+{
+    UnwindTables tables;
+
+    ASSERT_EQ(nullptr, tables.Find(0x10));
+}
+
+TEST(UnwindTableTest, RowsAreSortedInEachRegion)
+{
+    UnwindTables tables;
+
+    for (auto const& region : tables.Regions)
+    {
+        auto* begin = tables.Rows.data() + region.rowOffset;
+        auto* end = begin + region.rowCount;
+        ASSERT_TRUE(std::is_sorted(begin, end, [](UnwindRow const& a, UnwindRow const& b) { return a.offset < b.offset; }));
+        ASSERT_EQ(end, std::adjacent_find(begin, end, [](UnwindRow const& a, UnwindRow const& b) { return a.offset == b.offset; }));
+    }
+}
+
+TEST(UnwindTableTest, WalkingTheStackWithTablesFindsTheCallers)
+{
+    UnwindTables tables;
+
+    void* expected[64];
+    auto nbExpected = backtrace(expected, 64);
+    auto frames = RecursiveWalk(tables, 5);
+
+    // the frames of this test body and its callers (gtest, main, libc) must be found by the tables walk
+    ASSERT_GT(frames.size(), 7);
+    for (auto i = 1; i < nbExpected - 1; i++)
+    {
+        auto ip = reinterpret_cast<std::uintptr_t>(expected[i]);
+        ASSERT_NE(frames.end(), std::find(frames.begin(), frames.end(), ip)) << "frame #" << i << " not found";
+    }
+}
+
+
+TEST(UnwindTableTest, LoadedLibrariesFindTheirRegion)
+{
+    UnwindTables tables;
+    auto regions = tables.Regions;
+    std::sort(regions.begin(), regions.end(),
+              [](UnwindTableRegion const& a, UnwindTableRegion const& b) { return a.addrLow < b.addrLow; });
+
+    struct Lookup
+    {
+        std::vector<UnwindTableRegion> const* Regions;
+        std::vector<UnwindTableRegion const*> Found;
+        std::size_t NotFoundInEmptyRegions;
+    } lookup{&regions, {}, 0};
+
+    dl_iterate_phdr(
+        [](struct dl_phdr_info* info, std::size_t, void* data) {
+            auto* lookup = static_cast<Lookup*>(data);
+            auto const* region = UnwindTableBuilder::FindSameLibrary(lookup->Regions->data(), lookup->Regions->size(), info);
+            if (region != nullptr)
+            {
+                lookup->Found.push_back(region);
+            }
+            if (UnwindTableBuilder::FindSameLibrary(lookup->Regions->data(), 0, info) == nullptr)
+            {
+                lookup->NotFoundInEmptyRegions++;
+            }
+            return 0;
+        },
+        &lookup);
+
+    // each library with unwind tables finds its own region
+    ASSERT_EQ(regions.size(), lookup.Found.size());
+    std::sort(lookup.Found.begin(), lookup.Found.end());
+    ASSERT_EQ(lookup.Found.end(), std::adjacent_find(lookup.Found.begin(), lookup.Found.end()));
+    ASSERT_GE(lookup.NotFoundInEmptyRegions, regions.size());
+
+    // a library loaded at another address is not the same library
+    auto moved = regions.front();
+    moved.ehFrameHdr += 0x1000;
+    dl_iterate_phdr(
+        [](struct dl_phdr_info* info, std::size_t, void* data) {
+            auto const* moved = static_cast<UnwindTableRegion const*>(data);
+            EXPECT_EQ(nullptr, UnwindTableBuilder::FindSameLibrary(moved, 1, info));
+            return 0;
+        },
+        &moved);
+}
+
+#endif
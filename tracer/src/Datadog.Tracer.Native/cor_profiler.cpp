@@ -828,6 +828,7 @@ HRESULT CorProfiler::TryRejitModule(ModuleID module_id, std::vector<ModuleID>& m
 
         Logger::Info("ModuleLoadFinished: ", managed_profiler_name, " v", assemblyVersion, " - Fix PInvoke maps");
         managedInternalModules_.push_back(module_id);
+        tracked_modules_.Add(module_id, TrackedModules::Internal);
 
         RewritingPInvokeMaps(module_metadata, nativemethods_type);
         RewritingPInvokeMaps(module_metadata, appsec_nativemethods_type);
@@ -950,12 +951,14 @@ HRESULT CorProfiler::TryRejitModule(ModuleID module_id, std::vector<ModuleID>& m
 
         Logger::Info("ModuleLoadFinished: ", manual_instrumentation_name, " v", assemblyVersion, " - RewriteIsManualInstrumentationOnly");
         managedInternalModules_.push_back(module_id);
+        tracked_modules_.Add(module_id, TrackedModules::Internal);
 
         // Rewrite Instrumentation.IsManualInstrumentationOnly()
         RewriteIsManualInstrumentationOnly(module_metadata, module_id);
     }
 
     modules.push_back(module_id);
+    tracked_modules_.Add(module_id, TrackedModules::HasMetadata);
 
     bool searchForTraceAttribute = trace_annotations_enabled;
     if (searchForTraceAttribute)
@@ -1259,6 +1262,7 @@ HRESULT STDMETHODCALLTYPE CorProfiler::ModuleUnloadStarted(ModuleID module_id)
 
     auto new_internal_end = std::remove(managedInternalModules_.begin(), managedInternalModules_.end(), module_id);
     managedInternalModules_.erase(new_internal_end, managedInternalModules_.end());
+    tracked_modules_.Remove(module_id);
 
     // Clear the cached domain-neutral Datadog.Trace.dll module id if this is it.
     if (managed_profiler_domain_neutral_module_id == module_id)
@@ -4379,20 +4383,8 @@ HRESULT STDMETHODCALLTYPE CorProfiler::JITCachedFunctionSearchStarted(FunctionID
         return S_OK;
     }
 
-    // keep this lock until we are done using the module,
-    // to prevent it from unloading while in use
-    auto modulesOpt = module_ids.TryGet();
-    if (!modulesOpt.has_value())
-    {
-        Logger::Error(
-            "JITCachedFunctionSearchStarted: Failed on exception while tried to acquire the lock for the module_ids collection for functionId ",
-            functionId);
-        return S_OK;
-    }
-
-    auto& modules = modulesOpt.value();
-
     // Call RequestRejitOrRevert for register inliners and current NGEN module.
+    // (like in JITInlining, the rejit handler and the dataflow are protected by their own locks)
     if (rejit_handler != nullptr)
     {
         // Process the current module to detect inliners.
@@ -4408,44 +4400,66 @@ HRESULT STDMETHODCALLTYPE CorProfiler::JITCachedFunctionSearchStarted(FunctionID
         return S_OK;
     }
 
-    bool isAnInternalModule = false;
-
-    // Verify that we have the metadata for this module
-    if (!shared::Contains(modules.Ref(), module_id))
+    // Verify that we have the metadata for this module without taking the module_ids lock:
+    // this is the case for most of the methods.
+    if (tracked_modules_.GetFlags(module_id) == TrackedModules::None)
     {
-        isAnInternalModule = shared::Contains(managedInternalModules_, module_id);
-        if (!isAnInternalModule)
-        {
-            // we haven't stored a ModuleMetadata for this module,
-            // so there's nothing to do here, we accept the NGEN image.
-            *pbUseCachedFunction = true;
-            return S_OK;
-        }
+        // we haven't stored a ModuleMetadata for this module,
+        // so there's nothing to do here, we accept the NGEN image.
+        *pbUseCachedFunction = true;
+        return S_OK;
     }
 
-    // let's get the AssemblyID
-    DWORD module_path_len = 0;
-    AssemblyID assembly_id = 0;
-    hr = this->info_->GetModuleInfo(module_id, nullptr, 0, &module_path_len,
-                                            nullptr, &assembly_id);
-    if (FAILED(hr) || module_path_len == 0)
+    // keep this lock until we are done using the module,
+    // to prevent it from unloading while in use
+    auto modulesOpt = module_ids.TryGet();
+    if (!modulesOpt.has_value())
     {
-        Logger::Warn("JITCachedFunctionSearchStarted: Call to ICorProfilerInfo.GetModuleInfo() failed for ",
-                        functionId);
+        Logger::Error(
+            "JITCachedFunctionSearchStarted: Failed on exception while tried to acquire the lock for the module_ids collection for functionId ",
+            functionId);
         return S_OK;
     }
 
-    // now the assembly info
-    DWORD assembly_name_len = 0;
-    AppDomainID app_domain_id;
-    hr = this->info_->GetAssemblyInfo(assembly_id, 0, &assembly_name_len, nullptr, &app_domain_id, nullptr);
-    if (FAILED(hr) || assembly_name_len == 0)
+    // Check again under the lock: the module could have been unloaded in the meantime
+    const auto moduleFlags = tracked_modules_.GetFlags(module_id);
+    if (moduleFlags == TrackedModules::None)
     {
-        Logger::Warn("JITCachedFunctionSearchStarted: Call to ICorProfilerInfo.GetAssemblyInfo() failed for ",
-                        functionId);
+        *pbUseCachedFunction = true;
         return S_OK;
     }
 
+    const bool isAnInternalModule = (moduleFlags & TrackedModules::HasMetadata) == 0;
+
+    // The AppDomain of the module is cached after the first lookup
+    AppDomainID app_domain_id = tracked_modules_.GetAppDomain(module_id);
+    if (app_domain_id == 0)
+    {
+        // let's get the AssemblyID
+        DWORD module_path_len = 0;
+        AssemblyID assembly_id = 0;
+        hr = this->info_->GetModuleInfo(module_id, nullptr, 0, &module_path_len,
+                                                nullptr, &assembly_id);
+        if (FAILED(hr) || module_path_len == 0)
+        {
+            Logger::Warn("JITCachedFunctionSearchStarted: Call to ICorProfilerInfo.GetModuleInfo() failed for ",
+                            functionId);
+            return S_OK;
+        }
+
+        // now the assembly info
+        DWORD assembly_name_len = 0;
+        hr = this->info_->GetAssemblyInfo(assembly_id, 0, &assembly_name_len, nullptr, &app_domain_id, nullptr);
+        if (FAILED(hr) || assembly_name_len == 0)
+        {
+            Logger::Warn("JITCachedFunctionSearchStarted: Call to ICorProfilerInfo.GetAssemblyInfo() failed for ",
+                            functionId);
+            return S_OK;
+        }
+
+        tracked_modules_.SetAppDomain(module_id, app_domain_id);
+    }
+
     const bool has_loader_injected_in_appdomain =
         first_jit_compilation_app_domains.find(app_domain_id) != first_jit_compilation_app_domains.end();
 
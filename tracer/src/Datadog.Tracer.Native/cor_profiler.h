@@ -21,6 +21,7 @@
 #include "clr_helpers.h"
 #include "debugger_probes_instrumentation_requester.h"
 #include "Synchronized.hpp"
+#include "tracked_modules.h"
 #include "fault_tolerant_method_duplicator.h"
 #include "fault_tolerant_rewriter.h"
 
@@ -107,6 +108,8 @@ private:
     //
     Synchronized<std::vector<ModuleID>> module_ids;
     std::vector<ModuleID> managedInternalModules_;
+    // Lock free copy of module_ids and managedInternalModules_ for JITCachedFunctionSearchStarted
+    TrackedModules tracked_modules_;
     mdMethodDef getDistributedTraceMethodDef_;
     mdMethodDef getNativeTracerVersionMethodDef_;
     mdMethodDef isManualInstrumentationOnlyMethodDef_;
@@ -495,4 +495,10 @@ bool DebuggerRejitPreprocessor::ShouldSkipModule(const ModuleInfo& moduleInfo, c
     return false;
 }
 
+bool DebuggerRejitPreprocessor::GetIsTargetAssemblySpecific(const std::shared_ptr<MethodProbeDefinition>& methodProbe)
+{
+    // The probes are matched against every module
+    return false;
+}
+
 } // namespace debugger
\ No newline at end of file
@@ -56,6 +56,7 @@ protected:
         mdMethodDef methodDef,
         const FunctionInfo& functionInfo) const;
     bool ShouldSkipModule(const ModuleInfo& moduleInfo, const std::shared_ptr<MethodProbeDefinition>& methodProbe) final;
+    bool GetIsTargetAssemblySpecific(const std::shared_ptr<MethodProbeDefinition>& methodProbe) final;
     void EnqueueNewMethod(const std::shared_ptr<MethodProbeDefinition>& definition,
                           ComPtr<IMetaDataImport2>& metadataImport,
                           ComPtr<IMetaDataEmit2>& metadataEmit, const ModuleInfo& moduleInfo, mdTypeDef typeDef,
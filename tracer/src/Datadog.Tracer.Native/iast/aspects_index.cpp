@@ -0,0 +1,33 @@
+#include "aspects_index.h"
+#include <algorithm>
+
+namespace iast
+{
+    void AspectsIndex::Add(mdToken token, size_t position)
+    {
+        auto& positions = _positions[token];
+        auto it = std::lower_bound(positions.begin(), positions.end(), position);
+        if (it == positions.end() || *it != position)
+        {
+            positions.insert(it, position);
+        }
+    }
+
+    void AspectsIndex::GetCandidates(mdToken token, std::vector<size_t>& candidates) const
+    {
+        auto it = _positions.find(token);
+        if (it != _positions.end())
+        {
+            candidates.insert(candidates.end(), it->second.begin(), it->second.end());
+        }
+    }
+
+    void AspectsIndex::Normalize(std::vector<size_t>& candidates)
+    {
+        if (candidates.size() > 1)
+        {
+            std::sort(candidates.begin(), candidates.end());
+            candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+        }
+    }
+}
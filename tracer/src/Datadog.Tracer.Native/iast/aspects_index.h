@@ -0,0 +1,25 @@
+#pragma once
+#include "../../../../shared/src/native-src/pal.h"
+#include <unordered_map>
+#include <vector>
+
+namespace iast
+{
+    // Positions of the aspects of a module indexed by the tokens (target method, aspect member ref) an instruction
+    // operand must match for the aspect to apply, so that each call instruction only tries its candidate aspects
+    // instead of all of them. The positions are kept in the order of the aspects.
+    class AspectsIndex
+    {
+    private:
+        std::unordered_map<mdToken, std::vector<size_t>> _positions;
+
+    public:
+        void Add(mdToken token, size_t position);
+
+        // Appends the positions of the aspects of the token (in no particular order with the existing ones)
+        void GetCandidates(mdToken token, std::vector<size_t>& candidates) const;
+
+        // Sorts the candidates in the aspects order and removes the duplicates
+        static void Normalize(std::vector<size_t>& candidates);
+    };
+}
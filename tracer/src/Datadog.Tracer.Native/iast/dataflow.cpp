@@ -1,5 +1,6 @@
 #include "dataflow.h"
 #include "iast_util.h"
+#include "filter_matcher.h"
 #include "module_info.h"
 #include "method_info.h"
 #include "method_analyzers.h"
@@ -8,6 +9,7 @@
 #include "aspect_filter_factory.h"
 #include "../cor_profiler.h"
 #include "../function_control_wrapper.h"
+#include <algorithm>
 #include <fstream>
 #include <chrono>
 #include "../../../../shared/src/native-src/com_ptr.h"
@@ -122,6 +124,16 @@ static std::vector<WSTRING> _methodAttributeIncludeFilters = {
 static std::vector<WSTRING> _methodAttributeExcludeFilters = {
 };
 
+// Compiled once: the filters are matched for every loaded assembly and JIT compiled method
+static const FilterMatcher _domainIncludeMatcher(_domainIncludeFilters);
+static const FilterMatcher _domainExcludeMatcher(_domainExcludeFilters);
+static const FilterMatcher _assemblyIncludeMatcher(_assemblyIncludeFilters);
+static const FilterMatcher _assemblyExcludeMatcher(_assemblyExcludeFilters);
+static const FilterMatcher _methodIncludeMatcher(_methodIncludeFilters);
+static const FilterMatcher _methodExcludeMatcher(_methodExcludeFilters);
+static const FilterMatcher _methodAttributeIncludeMatcher(_methodAttributeIncludeFilters);
+static const FilterMatcher _methodAttributeExcludeMatcher(_methodAttributeExcludeFilters);
+
 ModuleAspects::ModuleAspects(Dataflow* dataflow, ModuleInfo* module)
 {
     this->_module = module;
@@ -132,7 +144,7 @@ ModuleAspects::ModuleAspects(Dataflow* dataflow, ModuleInfo* module)
         auto aspectReference = a->GetAspectReference(this);
         if (aspectReference)
         {
-            _aspects.push_back(aspectReference);
+            AddAspect(aspectReference);
         }
     }
 }
@@ -156,6 +168,42 @@ AspectFilter* ModuleAspects::GetFilter(DataflowAspectFilterValue filterValue)
     _filters[filterValue] = res;
     return res;
 }
+void ModuleAspects::AddAspect(DataflowAspectReference* aspect)
+{
+    // Index the aspects by target method so that each instruction only tries its candidates
+    _aspectsIndex.Add(aspect->_targetMethodRef, _aspects.size());
+    _aspects.push_back(aspect);
+}
+void ModuleAspects::IndexAspectToken(mdToken token, DataflowAspectReference* aspect)
+{
+    auto it = std::find(_aspects.begin(), _aspects.end(), aspect);
+    if (it != _aspects.end())
+    {
+        _aspectsIndex.Add(token, it - _aspects.begin());
+    }
+}
+void ModuleAspects::GetCandidateAspects(mdToken operand, std::vector<DataflowAspectReference*>& aspects)
+{
+    aspects.clear();
+    _candidatePositions.clear();
+    _aspectsIndex.GetCandidates(operand, _candidatePositions);
+
+    // Generic method instantiations also match the aspects of their generic method (see DataflowAspectReference::Apply)
+    if (TypeFromToken(operand) == mdtMethodSpec)
+    {
+        auto methodSpec = _module->GetMethodSpec(operand);
+        if (methodSpec != nullptr && methodSpec->GetGenericMethod() != nullptr)
+        {
+            _aspectsIndex.GetCandidates(methodSpec->GetGenericMethod()->GetMemberId(), _candidatePositions);
+        }
+    }
+
+    AspectsIndex::Normalize(_candidatePositions);
+    for (auto position : _candidatePositions)
+    {
+        aspects.push_back(_aspects[position]);
+    }
+}
 
 //--------------------
 
@@ -530,20 +578,20 @@ HRESULT Dataflow::GetModuleEmitInterfaces(ModuleID moduleId, IMetaDataEmit2** pp
 
 bool Dataflow::IsAppDomainExcluded(const WSTRING& appDomainName, MatchResult* includedMatch, MatchResult* excludedMatch)
 {
-    return IsExcluded(_domainIncludeFilters, _domainExcludeFilters, appDomainName, includedMatch, excludedMatch);
+    return IsExcluded(_domainIncludeMatcher, _domainExcludeMatcher, appDomainName, includedMatch, excludedMatch);
 }
 bool Dataflow::IsAssemblyExcluded(const WSTRING& assemblyName, MatchResult* includedMatch, MatchResult* excludedMatch)
 {
-    return IsExcluded(_assemblyIncludeFilters, _assemblyExcludeFilters, assemblyName, includedMatch, excludedMatch);
+    return IsExcluded(_assemblyIncludeMatcher, _assemblyExcludeMatcher, assemblyName, includedMatch, excludedMatch);
 }
 bool Dataflow::IsMethodExcluded(const WSTRING& methodSignature, MatchResult* includedMatch, MatchResult* excludedMatch)
 {
-    return IsExcluded(_methodIncludeFilters, _methodExcludeFilters, methodSignature, includedMatch, excludedMatch);
+    return IsExcluded(_methodIncludeMatcher, _methodExcludeMatcher, methodSignature, includedMatch, excludedMatch);
 }
 bool Dataflow::IsMethodAttributeExcluded(const WSTRING& attributeName, MatchResult* includedMatch,
                                          MatchResult* excludedMatch)
 {
-    return IsExcluded(_methodAttributeIncludeFilters, _methodAttributeExcludeFilters, attributeName, includedMatch,
+    return IsExcluded(_methodAttributeIncludeMatcher, _methodAttributeExcludeMatcher, attributeName, includedMatch,
                       excludedMatch);
 }
 bool Dataflow::HasMethodAttributeExclusions()
@@ -732,9 +780,10 @@ HRESULT Dataflow::RewriteMethod(MethodInfo* method, trace::FunctionControlWrappe
     }
 
     auto module = method->GetModuleInfo();
-    auto moduleAspectRefs = GetAspects(module);
-    if (moduleAspectRefs.size() > 0)
+    auto moduleAspects = GetModuleAspects(module);
+    if (moduleAspects->_aspects.size() > 0)
     {
+        std::vector<DataflowAspectReference*> candidates;
         bool written = false;
         ILRewriter* rewriter;
         hr = method->GetILRewriter(&rewriter, (ICorProfilerInfo*) pFunctionControl);
@@ -747,7 +796,7 @@ HRESULT Dataflow::RewriteMethod(MethodInfo* method, trace::FunctionControlWrappe
                 if (IsCandidate(context.instruction->m_opcode))
                 {
                     // Instrument instruction
-                    written |= InstrumentInstruction(context, moduleAspectRefs);
+                    written |= InstrumentInstruction(context, moduleAspects, candidates);
                     if (context.aborted)
                     {
                         break;
@@ -761,6 +810,12 @@ HRESULT Dataflow::RewriteMethod(MethodInfo* method, trace::FunctionControlWrappe
             }
             method->SetInstrumented(written);
             method->CommitILRewriter(context.aborted);
+
+            if (written && m_rejitHandler != nullptr)
+            {
+                // Instrumented methods are not inlined: let JITInlining know without calling IsInlineEnabled
+                m_rejitHandler->AddInstrumentedMethod(module->_id, method->GetMemberId());
+            }
         }
 
         if (written)
@@ -786,21 +841,24 @@ HRESULT Dataflow::RewriteMethod(MethodInfo* method, trace::FunctionControlWrappe
     return hr;
 }
 
-std::vector<DataflowAspectReference*> Dataflow::GetAspects(ModuleInfo* module)
+ModuleAspects* Dataflow::GetModuleAspects(ModuleInfo* module)
 {
     auto value = _moduleAspects.find(module->_id);
     if (value != _moduleAspects.end())
     {
-        return value->second->_aspects;
+        return value->second;
     }
     auto res = new ModuleAspects(this, module);
     _moduleAspects[module->_id] = res;
-    return res->_aspects;
+    return res;
 }
 
-bool Dataflow::InstrumentInstruction(DataflowContext& context, std::vector<DataflowAspectReference*>& aspects)
+bool Dataflow::InstrumentInstruction(DataflowContext& context, ModuleAspects* moduleAspects,
+                                     std::vector<DataflowAspectReference*>& candidates)
 {
-    for (auto const& aspect : aspects)
+    // The aspects which are not candidates would not apply to this instruction
+    moduleAspects->GetCandidateAspects(context.instruction->m_Arg32, candidates);
+    for (auto const& aspect : candidates)
     {
         if (aspect->Apply(context))
         {
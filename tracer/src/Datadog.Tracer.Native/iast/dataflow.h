@@ -2,6 +2,7 @@
 #include "../../../../shared/src/native-src/pal.h"
 #include "iast_util.h"
 #include "aspect.h"
+#include "aspects_index.h"
 #include "../rejit_handler.h"
 #include "../rejit_preprocessor.h"
 
@@ -39,12 +40,21 @@ namespace iast
 
     private:
         std::unordered_map<DataflowAspectFilterValue, AspectFilter*> _filters;
+        AspectsIndex _aspectsIndex;
+        std::vector<size_t> _candidatePositions;
 
     public:
         ModuleAspects(Dataflow* dataflow, ModuleInfo* module);
         virtual ~ModuleAspects();
 
         AspectFilter* GetFilter(DataflowAspectFilterValue filterValue);
+
+        // Adds an aspect that applies to this module, indexed by its target method
+        void AddAspect(DataflowAspectReference* aspect);
+        // Called when the aspect method is imported in the module, to find the calls already instrumented
+        void IndexAspectToken(mdToken token, DataflowAspectReference* aspect);
+        // Aspects (in their order) that could apply to a call instruction with the given operand
+        void GetCandidateAspects(mdToken operand, std::vector<DataflowAspectReference*>& aspects);
     };
 
     class Dataflow : public trace::Rejitter
@@ -76,8 +86,9 @@ namespace iast
         HRESULT RewriteMethod(MethodInfo* method, trace::FunctionControlWrapper* pFunctionControl = nullptr);
         MethodInfo* JITProcessMethod(ModuleID moduleId, mdToken methodId, trace::FunctionControlWrapper* pFunctionControl = nullptr);
 
-        std::vector<DataflowAspectReference*> GetAspects(ModuleInfo* module);
-        static bool InstrumentInstruction(DataflowContext& context, std::vector<DataflowAspectReference*>& aspects);
+        ModuleAspects* GetModuleAspects(ModuleInfo* module);
+        static bool InstrumentInstruction(DataflowContext& context, ModuleAspects* moduleAspects,
+                                          std::vector<DataflowAspectReference*>& candidates);
 
     public:
         HRESULT AppDomainShutdown(AppDomainID appDomainId);
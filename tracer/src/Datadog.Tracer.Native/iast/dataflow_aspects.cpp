@@ -541,6 +541,11 @@ namespace iast
             // Import aspect
             _aspectMemberRef = _module->DefineAspectMemberRef(_aspect->_aspectClass->_aspectTypeName,
                                                               _aspect->_aspectMethodName, _aspect->_aspectMethodParams);
+            if (_aspectMemberRef != 0)
+            {
+                // Calls to the aspect are found by the index when the method is instrumented again
+                _moduleAspects->IndexAspectToken(_aspectMemberRef, this);
+            }
         }
 
         if (_aspect->IsGeneric() && _aspectMemberRef != 0 && methodSpec != nullptr)
@@ -0,0 +1,154 @@
+#include "filter_matcher.h"
+#include <algorithm>
+
+using namespace shared;
+
+namespace iast
+{
+    static bool CompareChild(const std::pair<WCHAR, uint32_t>& child, WCHAR c)
+    {
+        return child.first < c;
+    }
+
+    FilterMatcher::FilterMatcher(const std::vector<WSTRING>& filters)
+    {
+        _prefixes.emplace_back();
+        _suffixes.emplace_back();
+
+        for (auto const& filter : filters)
+        {
+            auto exp = Trim(filter);
+            auto wcPos = exp.rfind('*');
+            if (wcPos == std::string::npos)
+            {
+                uint32_t node = 0;
+                for (auto c : exp)
+                {
+                    node = AddChild(_prefixes, node, c);
+                }
+                _prefixes[node].exact = true;
+                if (exp.length() == 0)
+                {
+                    // IsMatch handles an empty filter as an empty prefix
+                    _prefixes[0].wildcard = true;
+                }
+            }
+            else if (wcPos == exp.length() - 1)
+            {
+                uint32_t node = 0;
+                for (size_t x = 0; x < wcPos; x++)
+                {
+                    node = AddChild(_prefixes, node, exp[x]);
+                }
+                _prefixes[node].wildcard = true;
+            }
+            else if (wcPos == 0)
+            {
+                uint32_t node = 0;
+                for (size_t x = exp.length() - 1; x > 0; x--)
+                {
+                    node = AddChild(_suffixes, node, exp[x]);
+                }
+                _suffixes[node].wildcard = true;
+            }
+        }
+    }
+
+    uint32_t FilterMatcher::AddChild(std::vector<Node>& nodes, uint32_t node, WCHAR c)
+    {
+        auto& children = nodes[node].children;
+        auto it = std::lower_bound(children.begin(), children.end(), c, CompareChild);
+        if (it != children.end() && it->first == c)
+        {
+            return it->second;
+        }
+
+        auto child = static_cast<uint32_t>(nodes.size());
+        children.insert(it, {c, child});
+        nodes.emplace_back(); // Invalidates children
+        return child;
+    }
+
+    int64_t FilterMatcher::GetChild(const std::vector<Node>& nodes, uint32_t node, WCHAR c)
+    {
+        auto const& children = nodes[node].children;
+        auto it = std::lower_bound(children.begin(), children.end(), c, CompareChild);
+        if (it != children.end() && it->first == c)
+        {
+            return it->second;
+        }
+        return -1;
+    }
+
+    MatchResult FilterMatcher::Match(const WSTRING& value, unsigned int* pMatchLen) const
+    {
+        // Same bounds as shared::Trim (a value with only white spaces is kept as is)
+        size_t begin = 0;
+        size_t end = value.length();
+        auto lpos = value.find_first_not_of(WStr(" \f\n\r\t\v"));
+        if (lpos != WSTRING::npos)
+        {
+            begin = lpos;
+            end = value.find_last_not_of(WStr(" \f\n\r\t\v")) + 1;
+        }
+
+        MatchResult match = _prefixes[0].wildcard ? MatchResult::Wildcard : MatchResult::NoMatch;
+        int64_t node = 0;
+        for (size_t x = begin; x < end && node >= 0; x++)
+        {
+            node = GetChild(_prefixes, static_cast<uint32_t>(node), value[x]);
+            if (node >= 0 && _prefixes[node].wildcard)
+            {
+                match = MatchResult::Wildcard;
+            }
+        }
+        if (node >= 0 && _prefixes[node].exact)
+        {
+            match = MatchResult::Exact;
+        }
+
+        if (match == MatchResult::NoMatch && _suffixes.size() > 1)
+        {
+            node = 0;
+            for (size_t x = end; x > begin && node >= 0; x--)
+            {
+                node = GetChild(_suffixes, static_cast<uint32_t>(node), value[x - 1]);
+                if (node >= 0 && _suffixes[node].wildcard)
+                {
+                    match = MatchResult::Wildcard;
+                    break;
+                }
+            }
+        }
+
+        if (match != MatchResult::NoMatch && pMatchLen != nullptr)
+        {
+            // IsMatch reports the length of the value, +1 for the exact matches
+            *pMatchLen = static_cast<unsigned int>(end - begin) + (match == MatchResult::Exact ? 1 : 0);
+        }
+        return match;
+    }
+
+    bool IsExcluded(const FilterMatcher& includeFilters, const FilterMatcher& excludeFilters, const WSTRING& value,
+                    MatchResult* includedMatch, MatchResult* excludedMatch)
+    {
+        if (includedMatch) { *includedMatch = MatchResult::NoMatch; }
+        if (excludedMatch) { *excludedMatch = MatchResult::NoMatch; }
+
+        unsigned int includedLen;
+        MatchResult included = includeFilters.Match(value, &includedLen);
+        if (includedMatch) { *includedMatch = included; }
+        if (included == MatchResult::Exact)
+        {
+            return false;
+        }
+        unsigned int excludedLen;
+        MatchResult excluded = excludeFilters.Match(value, &excludedLen);
+        if (excludedMatch) { *excludedMatch = excluded; }
+        if (included == MatchResult::Wildcard && excluded == MatchResult::Wildcard)
+        {
+            return excludedLen >= includedLen;
+        }
+        return ((included == MatchResult::Wildcard && excluded == MatchResult::Exact) || (included == MatchResult::NoMatch && excluded != MatchResult::NoMatch));
+    }
+}
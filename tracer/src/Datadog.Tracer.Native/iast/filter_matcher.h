@@ -0,0 +1,39 @@
+#pragma once
+#include "iast_util.h"
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace iast
+{
+    // Include/exclude filters (as in IsMatch) compiled into tries, built once so that matching a value only walks
+    // its characters instead of comparing it with each filter:
+    // - "Name" (exact) and "Name*" (wildcard) filters are stored in a trie of the prefixes
+    // - "*Name" (wildcard) filters are stored in a trie of the reversed suffixes
+    // Filters with a wildcard in the middle never match (as in IsMatch) and are not stored.
+    class FilterMatcher
+    {
+    private:
+        struct Node
+        {
+            bool exact = false;
+            bool wildcard = false;
+            std::vector<std::pair<WCHAR, uint32_t>> children; // Sorted by character
+        };
+
+        std::vector<Node> _prefixes;
+        std::vector<Node> _suffixes;
+
+        static uint32_t AddChild(std::vector<Node>& nodes, uint32_t node, WCHAR c);
+        static int64_t GetChild(const std::vector<Node>& nodes, uint32_t node, WCHAR c);
+
+    public:
+        explicit FilterMatcher(const std::vector<WSTRING>& filters);
+
+        // Same result (and match length) as IsMatch(filters, value, pMatchLen)
+        MatchResult Match(const WSTRING& value, unsigned int* pMatchLen = nullptr) const;
+    };
+
+    bool IsExcluded(const FilterMatcher& includeFilters, const FilterMatcher& excludeFilters, const WSTRING& value,
+                    MatchResult* includedMatch = nullptr, MatchResult* excludedMatch = nullptr);
+}
@@ -48,7 +48,7 @@ namespace iast
         {
             //Compare endings
             auto expr = exp.substr(1, exp.length() - 1);
-            if (value.rfind(expr) == value.length() - expr.length())
+            if (value.length() >= expr.length() && value.rfind(expr) == value.length() - expr.length())
             {
                 return MatchResult::Wildcard;
             }
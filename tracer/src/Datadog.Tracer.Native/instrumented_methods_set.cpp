@@ -0,0 +1,162 @@
+#include "instrumented_methods_set.h"
+
+namespace trace
+{
+
+InstrumentedMethodsSet::MethodsBitset::~MethodsBitset()
+{
+    for (auto& chunk : chunks)
+    {
+        delete chunk.load();
+    }
+}
+
+InstrumentedMethodsSet::InstrumentedMethodsSet() : m_modules(InitialCapacity)
+{
+}
+
+bool InstrumentedMethodsSet::MayContainModule(uint64_t hash) const
+{
+    const auto bit1 = (hash >> 52) & (FilterWords * 64 - 1);
+    const auto bit2 = (hash >> 40) & (FilterWords * 64 - 1);
+
+    return ((m_modulesFilter[bit1 / 64].load(std::memory_order_acquire) >> (bit1 % 64)) & 1) != 0 &&
+           ((m_modulesFilter[bit2 / 64].load(std::memory_order_acquire) >> (bit2 % 64)) & 1) != 0;
+}
+
+void InstrumentedMethodsSet::RebuildFilter()
+{
+    uint64_t filter[FilterWords] = {};
+
+    m_modules.ForEachLive([&filter](const ModuleSlot& slot) {
+        const auto hash = ModuleIdTable<ModuleSlot>::Hash(slot.moduleId.load(std::memory_order_relaxed));
+        const auto bit1 = (hash >> 52) & (FilterWords * 64 - 1);
+        const auto bit2 = (hash >> 40) & (FilterWords * 64 - 1);
+        filter[bit1 / 64] |= uint64_t{1} << (bit1 % 64);
+        filter[bit2 / 64] |= uint64_t{1} << (bit2 % 64);
+    });
+
+    // Each word keeps the bits of the remaining modules: a lookup never misses one of them
+    for (size_t i = 0; i < FilterWords; i++)
+    {
+        m_modulesFilter[i].store(filter[i], std::memory_order_release);
+    }
+}
+
+void InstrumentedMethodsSet::Add(ModuleID moduleId, mdMethodDef methodDef)
+{
+    if (TypeFromToken(methodDef) != mdtMethodDef)
+    {
+        return;
+    }
+
+    const auto hash = ModuleIdTable<ModuleSlot>::Hash(moduleId);
+    const auto rid = RidFromToken(methodDef);
+
+    std::lock_guard<std::mutex> guard(m_lock);
+
+    const auto slot = m_modules.GetOrAdd(moduleId, hash);
+    auto methods = slot->methods.load(std::memory_order_relaxed);
+    if (methods == nullptr)
+    {
+        if (!m_freeBitsets.empty())
+        {
+            methods = m_freeBitsets.back();
+            m_freeBitsets.pop_back();
+        }
+        else
+        {
+            m_bitsets.push_back(std::make_unique<MethodsBitset>());
+            methods = m_bitsets.back().get();
+        }
+
+        slot->methods.store(methods, std::memory_order_release);
+    }
+
+    auto& chunkRef = methods->chunks[rid / ChunkBits];
+    auto chunk = chunkRef.load(std::memory_order_relaxed);
+    if (chunk == nullptr)
+    {
+        chunk = new MethodsChunk();
+        chunkRef.store(chunk, std::memory_order_release);
+    }
+
+    const auto bit = rid % ChunkBits;
+    chunk->words[bit / 64].fetch_or(uint64_t{1} << (bit % 64), std::memory_order_release);
+
+    const auto bit1 = (hash >> 52) & (FilterWords * 64 - 1);
+    const auto bit2 = (hash >> 40) & (FilterWords * 64 - 1);
+    m_modulesFilter[bit1 / 64].fetch_or(uint64_t{1} << (bit1 % 64), std::memory_order_release);
+    m_modulesFilter[bit2 / 64].fetch_or(uint64_t{1} << (bit2 % 64), std::memory_order_release);
+}
+
+void InstrumentedMethodsSet::RemoveModule(ModuleID moduleId)
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+
+    const auto slot = m_modules.Find(moduleId);
+    if (slot == nullptr)
+    {
+        return;
+    }
+
+    const auto methods = slot->methods.exchange(nullptr, std::memory_order_acq_rel);
+    if (methods == nullptr)
+    {
+        return;
+    }
+
+    // The bitset is cleared and reused for the next module (the ModuleID could be reused by the runtime too)
+    for (auto& chunkRef : methods->chunks)
+    {
+        const auto chunk = chunkRef.load(std::memory_order_relaxed);
+        if (chunk != nullptr)
+        {
+            for (auto& word : chunk->words)
+            {
+                word.store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+    m_freeBitsets.push_back(methods);
+
+    RebuildFilter();
+}
+
+bool InstrumentedMethodsSet::Contains(ModuleID moduleId, mdMethodDef methodDef) const
+{
+    if (TypeFromToken(methodDef) != mdtMethodDef)
+    {
+        return false;
+    }
+
+    const auto hash = ModuleIdTable<ModuleSlot>::Hash(moduleId);
+    if (!MayContainModule(hash))
+    {
+        return false;
+    }
+
+    const auto slot = m_modules.Find(moduleId, hash);
+    if (slot == nullptr)
+    {
+        return false;
+    }
+
+    const auto methods = slot->methods.load(std::memory_order_acquire);
+    if (methods == nullptr)
+    {
+        return false;
+    }
+
+    const auto rid = RidFromToken(methodDef);
+    const auto chunk = methods->chunks[rid / ChunkBits].load(std::memory_order_acquire);
+    if (chunk == nullptr)
+    {
+        return false;
+    }
+
+    const auto bit = rid % ChunkBits;
+    return ((chunk->words[bit / 64].load(std::memory_order_acquire) >> (bit % 64)) & 1) != 0;
+}
+
+} // namespace trace
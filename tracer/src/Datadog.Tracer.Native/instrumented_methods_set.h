@@ -0,0 +1,85 @@
+#ifndef DD_CLR_PROFILER_INSTRUMENTED_METHODS_SET_H_
+#define DD_CLR_PROFILER_INSTRUMENTED_METHODS_SET_H_
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "cor.h"
+#include "corprof.h"
+#include "module_id_table.h"
+
+namespace trace
+{
+
+/// <summary>
+/// Set of the (module, methodDef) instrumented by the rejitters and the IAST dataflow, read by the
+/// JITInlining callback for every inlining decision of the JIT.
+/// Lookups are lock free:
+/// - a bloom filter of the module ids rejects the modules without instrumented methods (most of them)
+/// - an open addressing table maps the module id to a bitset indexed by the methodDef RID
+/// Writers are serialized. The memory read by the lookups is never freed before the set is destroyed:
+/// grown tables are kept and the bitsets of the removed modules are cleared and reused.
+/// </summary>
+class InstrumentedMethodsSet
+{
+private:
+    static constexpr size_t FilterWords = 64;
+    static constexpr size_t ChunkBits = 65536;
+    static constexpr size_t ChunkWords = ChunkBits / 64;
+    static constexpr size_t ChunksCount = (0x00FFFFFF / ChunkBits) + 1;
+    static constexpr size_t InitialCapacity = 64;
+
+    struct MethodsChunk
+    {
+        std::atomic<uint64_t> words[ChunkWords] = {};
+    };
+
+    struct MethodsBitset
+    {
+        std::atomic<MethodsChunk*> chunks[ChunksCount] = {};
+
+        ~MethodsBitset();
+    };
+
+    struct ModuleSlot
+    {
+        // a removed module keeps its slot with no bitset
+        std::atomic<ModuleID> moduleId = {0};
+        std::atomic<MethodsBitset*> methods = {nullptr};
+
+        bool IsLive() const
+        {
+            return methods.load(std::memory_order_relaxed) != nullptr;
+        }
+
+        void CopyTo(ModuleSlot& target) const
+        {
+            target.methods.store(methods.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+    };
+
+    std::atomic<uint64_t> m_modulesFilter[FilterWords] = {};
+    ModuleIdTable<ModuleSlot> m_modules;
+
+    std::mutex m_lock;
+    std::vector<std::unique_ptr<MethodsBitset>> m_bitsets;
+    std::vector<MethodsBitset*> m_freeBitsets;
+
+    bool MayContainModule(uint64_t hash) const;
+    void RebuildFilter();
+
+public:
+    InstrumentedMethodsSet();
+
+    void Add(ModuleID moduleId, mdMethodDef methodDef);
+    void RemoveModule(ModuleID moduleId);
+
+    bool Contains(ModuleID moduleId, mdMethodDef methodDef) const;
+};
+
+} // namespace trace
+
+#endif // DD_CLR_PROFILER_INSTRUMENTED_METHODS_SET_H_
@@ -0,0 +1,196 @@
+#ifndef DD_CLR_PROFILER_MODULE_ID_TABLE_H_
+#define DD_CLR_PROFILER_MODULE_ID_TABLE_H_
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "cor.h"
+#include "corprof.h"
+
+namespace trace
+{
+
+/// <summary>
+/// Open addressing table of slots indexed by ModuleID, read without lock by the callbacks called for every
+/// method (or inlining decision) of the JIT.
+/// The slot type must have a std::atomic&lt;ModuleID&gt; moduleId field and:
+/// - bool IsLive() const: false once the module is removed (its slot is kept as a tombstone)
+/// - void CopyTo(TSlot&amp; target) const: copies the payload when the table grows
+/// The ModuleID of a slot is never reset: a module removed then added again gets its slot back.
+/// Writers must be serialized by the caller. The grown tables are kept until the table is destroyed because
+/// a lookup could still be reading them: the doubled tables cost less than the current one and a table rehashed
+/// at the same capacity is only replaced after a quarter of its slots were used by new modules, so the retained
+/// tables cost at most 4 slots per module added.
+/// </summary>
+template <typename TSlot>
+class ModuleIdTable
+{
+private:
+    struct Table
+    {
+        size_t capacity;
+        std::unique_ptr<TSlot[]> slots;
+
+        explicit Table(size_t capacity) : capacity(capacity), slots(std::make_unique<TSlot[]>(capacity))
+        {
+        }
+    };
+
+    std::atomic<Table*> m_table = {nullptr};
+
+    size_t m_usedSlots = 0;
+    std::vector<std::unique_ptr<Table>> m_tables;
+
+    static size_t FindFreeIndex(const Table* table, uint64_t hash)
+    {
+        const auto mask = table->capacity - 1;
+        auto index = hash & mask;
+        while (table->slots[index].moduleId.load(std::memory_order_relaxed) != 0)
+        {
+            index = (index + 1) & mask;
+        }
+
+        return index;
+    }
+
+    void Grow()
+    {
+        const auto current = m_table.load(std::memory_order_relaxed);
+
+        // The removed modules are not copied
+        size_t liveModules = 0;
+        for (size_t i = 0; i < current->capacity; i++)
+        {
+            if (current->slots[i].IsLive())
+            {
+                liveModules++;
+            }
+        }
+
+        // Mostly tombstones (modules loaded then unloaded): dropping them is enough to make room
+        auto capacity = current->capacity;
+        if ((liveModules + 1) * 4 > capacity)
+        {
+            capacity *= 2;
+            while ((liveModules + 1) * 2 > capacity)
+            {
+                capacity *= 2;
+            }
+        }
+
+        auto table = std::make_unique<Table>(capacity);
+        for (size_t i = 0; i < current->capacity; i++)
+        {
+            const auto& slot = current->slots[i];
+            if (!slot.IsLive())
+            {
+                continue;
+            }
+
+            const auto moduleId = slot.moduleId.load(std::memory_order_relaxed);
+            auto& newSlot = table->slots[FindFreeIndex(table.get(), Hash(moduleId))];
+            slot.CopyTo(newSlot);
+            newSlot.moduleId.store(moduleId, std::memory_order_relaxed);
+        }
+
+        m_usedSlots = liveModules;
+        m_table.store(table.get(), std::memory_order_release);
+        m_tables.push_back(std::move(table));
+    }
+
+public:
+    explicit ModuleIdTable(size_t initialCapacity)
+    {
+        m_tables.push_back(std::make_unique<Table>(initialCapacity));
+        m_table.store(m_tables.back().get());
+    }
+
+    static uint64_t Hash(ModuleID moduleId)
+    {
+        // ModuleIDs are pointers: mix all the bits (splitmix64 finalizer)
+        uint64_t hash = static_cast<uint64_t>(moduleId);
+        hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebULL;
+        return hash ^ (hash >> 31);
+    }
+
+    // Lock free: returns nullptr if the module never had a slot
+    TSlot* Find(ModuleID moduleId, uint64_t hash) const
+    {
+        const auto table = m_table.load(std::memory_order_acquire);
+        const auto mask = table->capacity - 1;
+        auto index = hash & mask;
+        for (size_t i = 0; i < table->capacity; i++)
+        {
+            auto& slot = table->slots[index];
+            const auto slotModuleId = slot.moduleId.load(std::memory_order_acquire);
+            if (slotModuleId == moduleId)
+            {
+                return &slot;
+            }
+
+            if (slotModuleId == 0)
+            {
+                return nullptr;
+            }
+
+            index = (index + 1) & mask;
+        }
+
+        return nullptr;
+    }
+
+    TSlot* Find(ModuleID moduleId) const
+    {
+        return Find(moduleId, Hash(moduleId));
+    }
+
+    // Writers only: the payload of a new slot must be set with release stores since the slot is visible
+    // to the lookups as soon as it is returned
+    TSlot* GetOrAdd(ModuleID moduleId, uint64_t hash)
+    {
+        auto slot = Find(moduleId, hash);
+        if (slot != nullptr)
+        {
+            return slot;
+        }
+
+        // Keep the load factor under 50% so that the probing sequences stay short
+        if ((m_usedSlots + 1) * 2 > m_table.load(std::memory_order_relaxed)->capacity)
+        {
+            Grow();
+        }
+
+        const auto table = m_table.load(std::memory_order_relaxed);
+        slot = &table->slots[FindFreeIndex(table, hash)];
+        slot->moduleId.store(moduleId, std::memory_order_release);
+        m_usedSlots++;
+        return slot;
+    }
+
+    // Writers only: calls func for the slots of the live modules
+    template <typename TFunc>
+    void ForEachLive(TFunc func) const
+    {
+        const auto table = m_table.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < table->capacity; i++)
+        {
+            const auto& slot = table->slots[i];
+            if (slot.IsLive())
+            {
+                func(slot);
+            }
+        }
+    }
+
+    size_t GetCapacity() const
+    {
+        return m_table.load(std::memory_order_acquire)->capacity;
+    }
+};
+
+} // namespace trace
+
+#endif // DD_CLR_PROFILER_MODULE_ID_TABLE_H_
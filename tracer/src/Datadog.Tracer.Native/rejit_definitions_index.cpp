@@ -0,0 +1,55 @@
+#include "rejit_definitions_index.h"
+
+#include <algorithm>
+
+namespace trace
+{
+
+void RejitDefinitionsIndex::Reserve(size_t count)
+{
+    m_byAssembly.reserve(count);
+}
+
+void RejitDefinitionsIndex::AddAnyAssembly()
+{
+    m_anyAssembly.push_back(m_count++);
+}
+
+void RejitDefinitionsIndex::Add(const shared::WSTRING& targetAssembly)
+{
+    m_byAssembly[targetAssembly].push_back(m_count++);
+}
+
+void RejitDefinitionsIndex::AddAbstract(const shared::WSTRING& targetAssembly)
+{
+    m_abstractByAssembly[targetAssembly].push_back(m_count++);
+}
+
+void RejitDefinitionsIndex::GetCandidates(const shared::WSTRING& assemblyName, std::vector<size_t>& candidates) const
+{
+    candidates.insert(candidates.end(), m_anyAssembly.begin(), m_anyAssembly.end());
+
+    const auto it = m_byAssembly.find(assemblyName);
+    if (it != m_byAssembly.end())
+    {
+        candidates.insert(candidates.end(), it->second.begin(), it->second.end());
+    }
+}
+
+void RejitDefinitionsIndex::GetAbstractCandidates(const shared::WSTRING& assemblyName,
+                                                  std::vector<size_t>& candidates) const
+{
+    const auto it = m_abstractByAssembly.find(assemblyName);
+    if (it != m_abstractByAssembly.end())
+    {
+        candidates.insert(candidates.end(), it->second.begin(), it->second.end());
+    }
+}
+
+void RejitDefinitionsIndex::Normalize(std::vector<size_t>& candidates)
+{
+    std::sort(candidates.begin(), candidates.end());
+    candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+}
+
+} // namespace trace
@@ -0,0 +1,62 @@
+#ifndef DD_CLR_PROFILER_REJIT_DEFINITIONS_INDEX_H_
+#define DD_CLR_PROFILER_REJIT_DEFINITIONS_INDEX_H_
+
+#include <unordered_map>
+#include <vector>
+
+#include "../../../shared/src/native-src/string.h"
+
+namespace trace
+{
+
+/// <summary>
+/// Positions of the rejit request definitions grouped by the assembly they target, so that each module
+/// is only matched against the definitions that could apply to it instead of all of them.
+/// - the definitions of a method in a specific assembly are only candidates for the modules of that assembly
+/// - the definitions that are not tied to an assembly (e.g. trace methods) are candidates for every module
+/// - the derived/interface definitions are candidates for the modules of their target assembly or the
+///   modules referencing it (the types implementing them are found in those modules only)
+/// The candidates are always returned in the order of the definitions.
+/// </summary>
+class RejitDefinitionsIndex
+{
+private:
+    using Positions = std::vector<size_t>;
+
+    Positions m_anyAssembly;
+    std::unordered_map<shared::WSTRING, Positions> m_byAssembly;
+    std::unordered_map<shared::WSTRING, Positions> m_abstractByAssembly;
+    size_t m_count = 0;
+
+public:
+    void Reserve(size_t count);
+
+    // Definitions must be added in their order
+    void AddAnyAssembly();
+    void Add(const shared::WSTRING& targetAssembly);
+    void AddAbstract(const shared::WSTRING& targetAssembly);
+
+    bool HasAbstractDefinitions() const
+    {
+        return !m_abstractByAssembly.empty();
+    }
+
+    size_t Count() const
+    {
+        return m_count;
+    }
+
+    // Appends the positions of the definitions (not derived/interface) that could match a module of the given assembly
+    void GetCandidates(const shared::WSTRING& assemblyName, std::vector<size_t>& candidates) const;
+
+    // Appends the positions of the derived/interface definitions targeting the given assembly.
+    // Must be called for the assembly of the module and each assembly it references.
+    void GetAbstractCandidates(const shared::WSTRING& assemblyName, std::vector<size_t>& candidates) const;
+
+    // Sorts the candidates in the definitions order and removes the duplicates
+    static void Normalize(std::vector<size_t>& candidates);
+};
+
+} // namespace trace
+
+#endif // DD_CLR_PROFILER_REJIT_DEFINITIONS_INDEX_H_
@@ -186,6 +186,7 @@ bool RejitHandlerModule::CreateMethodIfNotExists(const mdMethodDef methodDef,
     auto newModuleInfo = creator(methodDef, this);
     updater(newModuleInfo.get());
     m_methods[methodDef] = std::move(newModuleInfo);
+    m_handler->AddInstrumentedMethod(m_moduleId, methodDef);
     return true;
 }
 
@@ -475,24 +476,21 @@ bool RejitHandler::GetEnableByRefInstrumentation()
     return enable_by_ref_instrumentation;
 }
 
+void RejitHandler::AddInstrumentedMethod(ModuleID moduleId, mdMethodDef methodDef)
+{
+    m_instrumentedMethods.Add(moduleId, methodDef);
+}
+
 bool RejitHandler::HasModuleAndMethod(ModuleID moduleId, mdMethodDef methodDef)
 {
-    if (IsShutdownRequested())
+    // Called for every inlining decision of the JIT: no lock is taken here (not even the shutdown one),
+    // the methods of all the rejitters are published in m_instrumentedMethods when they are created.
+    if (m_shutdown.load(std::memory_order_acquire))
     {
         return false;
     }
 
-    Rejitter* prev = nullptr;
-    for (size_t x = 0; x < m_rejittersCount; x++)
-    {
-        const auto current = m_rejitters[x];
-        if (current != prev && current->HasModuleAndMethod(moduleId, methodDef))
-        {
-            return true;
-        }
-    }
-
-    return false;
+    return m_instrumentedMethods.Contains(moduleId, methodDef);
 }
 
 void RejitHandler::RemoveModule(ModuleID moduleId)
@@ -512,6 +510,8 @@ void RejitHandler::RemoveModule(ModuleID moduleId)
             current->RemoveModule(moduleId);
         }
     }
+
+    m_instrumentedMethods.RemoveModule(moduleId);
 }
 
 void RejitHandler::AddNGenInlinerModule(ModuleID moduleId)
@@ -9,6 +9,7 @@
 
 #include "cor.h"
 #include "corprof.h"
+#include "instrumented_methods_set.h"
 #include "method_rewriter.h"
 #include "module_metadata.h"
 #include "rejit_work_offloader.h"
@@ -116,6 +117,9 @@ private:
     Rejitter* m_rejitters[MAX_REJITTERS];
     size_t m_rejittersCount = 0;
 
+    // Methods of all the rejitters (and IAST dataflow) that must not be inlined, read by JITInlining
+    InstrumentedMethodsSet m_instrumentedMethods;
+
     Lock m_rejit_history_lock;
     std::vector<std::tuple<ModuleID, mdMethodDef>> m_rejit_history;
     bool enable_rejit_tracking = false;
@@ -145,6 +149,7 @@ public:
     void SetCorAssemblyProfiler(AssemblyProperty* pCorAssemblyProfiler);
     AssemblyProperty* GetCorAssemblyProperty();
 
+    void AddInstrumentedMethod(ModuleID moduleId, mdMethodDef methodDef);
     bool HasModuleAndMethod(ModuleID moduleId, mdMethodDef methodDef);
     void RemoveModule(ModuleID moduleId);
     void AddNGenInlinerModule(ModuleID moduleId);
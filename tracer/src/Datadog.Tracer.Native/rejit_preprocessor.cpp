@@ -547,6 +547,33 @@ void RejitPreprocessor<RejitRequestDefinition>::EnqueueRequestRejitForLoadedModu
     m_work_offloader->Enqueue(std::make_unique<RejitWorkItem>(std::move(action)));
 }
 
+template <class RejitRequestDefinition>
+RejitDefinitionsIndex
+RejitPreprocessor<RejitRequestDefinition>::BuildDefinitionsIndex(const std::vector<RejitRequestDefinition>& definitions)
+{
+    RejitDefinitionsIndex index;
+    index.Reserve(definitions.size());
+
+    for (const RejitRequestDefinition& definition : definitions)
+    {
+        const auto& targetAssembly = GetTargetMethod(definition).type.assembly.name;
+        if (GetIsDerived(definition) || GetIsInterface(definition))
+        {
+            index.AddAbstract(targetAssembly);
+        }
+        else if (GetIsTargetAssemblySpecific(definition))
+        {
+            index.Add(targetAssembly);
+        }
+        else
+        {
+            index.AddAnyAssembly();
+        }
+    }
+
+    return index;
+}
+
 template <class RejitRequestDefinition>
 ULONG RejitPreprocessor<RejitRequestDefinition>::PreprocessRejitRequests(
     const std::vector<ModuleID>& modules, const std::vector<RejitRequestDefinition>& definitions,
@@ -559,6 +586,11 @@ ULONG RejitPreprocessor<RejitRequestDefinition>::PreprocessRejitRequests(
 
     auto corProfilerInfo = m_rejit_handler->GetCorProfilerInfo();
 
+    // Group the definitions by target assembly once for all the modules
+    const auto definitionsIndex = BuildDefinitionsIndex(definitions);
+    std::vector<size_t> candidates;
+    std::vector<AssemblyMetadata> assemblyRefs;
+
     for (const auto& module : modules)
     {
         auto _ = trace::Stats::Instance()->CallTargetRequestRejitMeasure();
@@ -577,9 +609,63 @@ ULONG RejitPreprocessor<RejitRequestDefinition>::PreprocessRejitRequests(
         ComPtr<IMetaDataAssemblyEmit> assemblyEmit;
         std::unique_ptr<AssemblyMetadata> assemblyMetadata = nullptr;
 
-        for (const RejitRequestDefinition& definition : definitions)
+        auto loadAssemblyMetadata = [&]() {
+            if (assemblyMetadata != nullptr)
+            {
+                return true;
+            }
+
+            DBG("  Loading Assembly Metadata...");
+            auto hr = corProfilerInfo->GetModuleMetaData(moduleInfo.id, ofRead | ofWrite, IID_IMetaDataImport2,
+                                                         metadataInterfaces.GetAddressOf());
+            if (hr != S_OK)
+            {
+                Logger::Warn("CallTarget_RequestRejitForModule failed to get metadata interface for ",
+                             moduleInfo.id, " ", moduleInfo.assembly.name);
+                return false;
+            }
+
+            metadataImport = metadataInterfaces.As<IMetaDataImport2>(IID_IMetaDataImport);
+            metadataEmit = metadataInterfaces.As<IMetaDataEmit2>(IID_IMetaDataEmit);
+            assemblyImport = metadataInterfaces.As<IMetaDataAssemblyImport>(IID_IMetaDataAssemblyImport);
+            assemblyEmit = metadataInterfaces.As<IMetaDataAssemblyEmit>(IID_IMetaDataAssemblyEmit);
+            assemblyMetadata = std::make_unique<AssemblyMetadata>(GetAssemblyImportMetadata(assemblyImport));
+            DBG("  Assembly Metadata loaded for: ", assemblyMetadata->name, "(", assemblyMetadata->version.str(), ").");
+            return true;
+        };
+
+        candidates.clear();
+        definitionsIndex.GetCandidates(moduleInfo.assembly.name, candidates);
+
+        assemblyRefs.clear();
+        if (definitionsIndex.HasAbstractDefinitions())
         {
-            const auto target_method = GetTargetMethod(definition);
+            // The types implementing the derived/interface definitions can only be found in the modules
+            // of the target assembly or the modules referencing it
+            if (!loadAssemblyMetadata())
+            {
+                continue;
+            }
+
+            definitionsIndex.GetAbstractCandidates(assemblyMetadata->name, candidates);
+
+            auto assemblyRefEnum = EnumAssemblyRefs(assemblyImport);
+            auto assemblyRefIterator = assemblyRefEnum.begin();
+            for (; assemblyRefIterator != assemblyRefEnum.end(); assemblyRefIterator = ++assemblyRefIterator)
+            {
+                const auto& assemblyRefMetadata = GetReferencedAssemblyMetadata(assemblyImport, *assemblyRefIterator);
+                definitionsIndex.GetAbstractCandidates(assemblyRefMetadata.name, candidates);
+                assemblyRefs.push_back(assemblyRefMetadata);
+            }
+        }
+
+        RejitDefinitionsIndex::Normalize(candidates);
+        DBG("  ", candidates.size(), " candidate definitions out of ", definitions.size());
+
+        for (const auto position : candidates)
+        {
+            const RejitRequestDefinition& definition = definitions[position];
+            const auto& target_method = GetTargetMethod(definition);
             const auto is_derived = GetIsDerived(definition);
             const auto is_interface = GetIsInterface(definition);
             const auto is_enabled = GetIsEnabled(definition);
@@ -587,38 +673,13 @@ ULONG RejitPreprocessor<RejitRequestDefinition>::PreprocessRejitRequests(
             if (is_derived || is_interface)
             {
                 // Abstract methods handling.
-                if (assemblyMetadata == nullptr)
-                {
-                    DBG("  Loading Assembly Metadata...");
-                    auto hr = corProfilerInfo->GetModuleMetaData(moduleInfo.id, ofRead | ofWrite, IID_IMetaDataImport2,
-                                                                 metadataInterfaces.GetAddressOf());
-                    if (hr != S_OK)
-                    {
-                        Logger::Warn("CallTarget_RequestRejitForModule failed to get metadata interface for ",
-                                     moduleInfo.id, " ", moduleInfo.assembly.name);
-                        break;
-                    }
-
-                    metadataImport = metadataInterfaces.As<IMetaDataImport2>(IID_IMetaDataImport);
-                    metadataEmit = metadataInterfaces.As<IMetaDataEmit2>(IID_IMetaDataEmit);
-                    assemblyImport = metadataInterfaces.As<IMetaDataAssemblyImport>(IID_IMetaDataAssemblyImport);
-                    assemblyEmit = metadataInterfaces.As<IMetaDataAssemblyEmit>(IID_IMetaDataAssemblyEmit);
-                    assemblyMetadata = std::make_unique<AssemblyMetadata>(GetAssemblyImportMetadata(assemblyImport));
-                    DBG("  Assembly Metadata loaded for: ", assemblyMetadata->name, "(", assemblyMetadata->version.str(), ").");
-                }
-
                 // If the integration is in a different assembly than the target method
                 if (assemblyMetadata->name != target_method.type.assembly.name)
                 {
                     // Check if the current module contains a reference to the assembly of the integration
-                    auto assemblyRefEnum = EnumAssemblyRefs(assemblyImport);
-                    auto assemblyRefIterator = assemblyRefEnum.begin();
                     bool assemblyRefFound = false;
-                    for (; assemblyRefIterator != assemblyRefEnum.end(); assemblyRefIterator = ++assemblyRefIterator)
+                    for (const auto& assemblyRefMetadata : assemblyRefs)
                     {
-                        auto assemblyRef = *assemblyRefIterator;
-                        const auto& assemblyRefMetadata = GetReferencedAssemblyMetadata(assemblyImport, assemblyRef);
-
                         if (assemblyRefMetadata.name == target_method.type.assembly.name &&
                             target_method.type.min_version <= assemblyRefMetadata.version &&
                             target_method.type.max_version >= assemblyRefMetadata.version)
@@ -809,24 +870,9 @@ ULONG RejitPreprocessor<RejitRequestDefinition>::PreprocessRejitRequests(
                     continue;
                 }
 
-                if (assemblyMetadata == nullptr)
+                if (!loadAssemblyMetadata())
                 {
-                    DBG("  Loading Assembly Metadata...");
-                    auto hr = corProfilerInfo->GetModuleMetaData(moduleInfo.id, ofRead | ofWrite, IID_IMetaDataImport2,
-                                                                 metadataInterfaces.GetAddressOf());
-                    if (hr != S_OK)
-                    {
-                        Logger::Warn("CallTarget_RequestRejitForModule failed to get metadata interface for ",
-                                     moduleInfo.id, " ", moduleInfo.assembly.name);
-                        break;
-                    }
-
-                    metadataImport = metadataInterfaces.As<IMetaDataImport2>(IID_IMetaDataImport);
-                    metadataEmit = metadataInterfaces.As<IMetaDataEmit2>(IID_IMetaDataEmit);
-                    assemblyImport = metadataInterfaces.As<IMetaDataAssemblyImport>(IID_IMetaDataAssemblyImport);
-                    assemblyEmit = metadataInterfaces.As<IMetaDataAssemblyEmit>(IID_IMetaDataAssemblyEmit);
-                    assemblyMetadata = std::make_unique<AssemblyMetadata>(GetAssemblyImportMetadata(assemblyImport));
-                    DBG("  Assembly Metadata loaded for: ", assemblyMetadata->name, "(", assemblyMetadata->version.str(), ").");
+                    break;
                 }
 
                 // Check min version
@@ -6,6 +6,7 @@
 #include "cor.h"
 #include "corprof.h"
 #include "module_metadata.h"
+#include "rejit_definitions_index.h"
 
 namespace trace
 {
@@ -79,6 +80,8 @@ protected:
                                           const MethodReference& targetMethod);
 
     virtual bool ShouldSkipModule(const ModuleInfo& moduleInfo, const RejitRequestDefinition& definition) = 0;
+    // True if ShouldSkipModule skips every module that is not part of the target assembly of the definition
+    virtual bool GetIsTargetAssemblySpecific(const RejitRequestDefinition& definition) = 0;
 
     virtual const std::unique_ptr<RejitHandlerModuleMethod> CreateMethod(mdMethodDef methodDef,
                                                                          RejitHandlerModule* module,
@@ -91,6 +94,8 @@ protected:
                           std::vector<MethodIdentifier>& rejitRequests, unsigned methodDef,
                           const FunctionInfo& functionInfo, RejitHandlerModule* moduleHandler);
 
+    RejitDefinitionsIndex BuildDefinitionsIndex(const std::vector<RejitRequestDefinition>& definitions);
+
     ULONG PreprocessRejitRequests(const std::vector<ModuleID>& modules,
                                   const std::vector<RejitRequestDefinition>& definitions,
                                   std::vector<MethodIdentifier>& rejitRequests);
@@ -75,4 +75,10 @@ bool TracerRejitPreprocessor::ShouldSkipModule(const ModuleInfo& moduleInfo,
            target_method.type.assembly.name != moduleInfo.assembly.name;
 }
 
+bool TracerRejitPreprocessor::GetIsTargetAssemblySpecific(const IntegrationDefinition& integrationDefinition)
+{
+    // Same condition as ShouldSkipModule: only the trace method integrations apply to any assembly
+    return GetTargetMethod(integrationDefinition).type.assembly.name != tracemethodintegration_assemblyname;
+}
+
 } // namespace trace
\ No newline at end of file
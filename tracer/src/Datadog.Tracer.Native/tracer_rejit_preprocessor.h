@@ -41,6 +41,7 @@ protected:
                  const IntegrationDefinition& integrationDefinition) final;
     void UpdateMethod(RejitHandlerModuleMethod* method, const IntegrationDefinition& definition) final;
     bool ShouldSkipModule(const ModuleInfo& moduleInfo, const IntegrationDefinition& integrationDefinition) final;
+    bool GetIsTargetAssemblySpecific(const IntegrationDefinition& integrationDefinition) final;
 };
 
 } // namespace trace
@@ -0,0 +1,63 @@
+#include "tracked_modules.h"
+
+namespace trace
+{
+
+TrackedModules::TrackedModules() : m_modules(InitialCapacity)
+{
+}
+
+void TrackedModules::Add(ModuleID moduleId, uint8_t flags)
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+
+    const auto slot = m_modules.GetOrAdd(moduleId, ModuleIdTable<ModuleSlot>::Hash(moduleId));
+    slot->flags.fetch_or(flags, std::memory_order_release);
+}
+
+void TrackedModules::Remove(ModuleID moduleId)
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+
+    const auto slot = m_modules.Find(moduleId);
+    if (slot != nullptr)
+    {
+        slot->flags.store(None, std::memory_order_release);
+        slot->appDomainId.store(0, std::memory_order_release);
+    }
+}
+
+void TrackedModules::SetAppDomain(ModuleID moduleId, AppDomainID appDomainId)
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+
+    const auto slot = m_modules.Find(moduleId);
+    if (slot != nullptr && slot->flags.load(std::memory_order_relaxed) != None)
+    {
+        slot->appDomainId.store(appDomainId, std::memory_order_release);
+    }
+}
+
+uint8_t TrackedModules::GetFlags(ModuleID moduleId) const
+{
+    const auto slot = m_modules.Find(moduleId);
+    if (slot == nullptr)
+    {
+        return None;
+    }
+
+    return slot->flags.load(std::memory_order_acquire);
+}
+
+AppDomainID TrackedModules::GetAppDomain(ModuleID moduleId) const
+{
+    const auto slot = m_modules.Find(moduleId);
+    if (slot == nullptr)
+    {
+        return 0;
+    }
+
+    return slot->appDomainId.load(std::memory_order_acquire);
+}
+
+} // namespace trace
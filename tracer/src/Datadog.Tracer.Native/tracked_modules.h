@@ -0,0 +1,68 @@
+#ifndef DD_CLR_PROFILER_TRACKED_MODULES_H_
+#define DD_CLR_PROFILER_TRACKED_MODULES_H_
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+
+#include "cor.h"
+#include "corprof.h"
+#include "module_id_table.h"
+
+namespace trace
+{
+
+/// <summary>
+/// Lock free view of the modules tracked by the CorProfiler (module_ids and managedInternalModules_) for
+/// the callbacks called for every method like JITCachedFunctionSearchStarted: most of the methods are not
+/// in a tracked module and the answer is a single lookup without taking the module_ids lock.
+/// The AppDomain of a module can be cached with it to avoid querying the module and assembly info again.
+/// Writers are serialized (they are also holding the module_ids lock).
+/// </summary>
+class TrackedModules
+{
+public:
+    static constexpr uint8_t None = 0;
+    static constexpr uint8_t HasMetadata = 1; // in module_ids
+    static constexpr uint8_t Internal = 2;    // in managedInternalModules_
+
+private:
+    static constexpr size_t InitialCapacity = 256;
+
+    struct ModuleSlot
+    {
+        // a removed module keeps its slot with no flags
+        std::atomic<ModuleID> moduleId = {0};
+        std::atomic<uint8_t> flags = {None};
+        std::atomic<AppDomainID> appDomainId = {0};
+
+        bool IsLive() const
+        {
+            return flags.load(std::memory_order_relaxed) != None;
+        }
+
+        void CopyTo(ModuleSlot& target) const
+        {
+            target.flags.store(flags.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            target.appDomainId.store(appDomainId.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+    };
+
+    ModuleIdTable<ModuleSlot> m_modules;
+    std::mutex m_lock;
+
+public:
+    TrackedModules();
+
+    void Add(ModuleID moduleId, uint8_t flags);
+    void Remove(ModuleID moduleId);
+    void SetAppDomain(ModuleID moduleId, AppDomainID appDomainId);
+
+    uint8_t GetFlags(ModuleID moduleId) const;
+    // Returns 0 if the module is not tracked or its AppDomain was not cached yet
+    AppDomainID GetAppDomain(ModuleID moduleId) const;
+};
+
+} // namespace trace
+
+#endif // DD_CLR_PROFILER_TRACKED_MODULES_H_
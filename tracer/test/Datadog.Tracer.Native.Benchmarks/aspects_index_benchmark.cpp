@@ -0,0 +1,106 @@
+#include "benchmark/benchmark.h"
+
+#include "../../src/Datadog.Tracer.Native/iast/aspects_index.h"
+
+#include <vector>
+
+using namespace iast;
+
+namespace
+{
+
+// A large method calls many different methods: only a few of them are the target of an aspect
+constexpr size_t InstructionsCount = 20000;
+constexpr mdToken FirstMemberRef = 0x0A000001;
+constexpr size_t CalledMethodsCount = 3000;
+
+struct SyntheticAspect
+{
+    mdToken targetMethodRef;
+};
+
+std::vector<SyntheticAspect> CreateAspects(size_t count)
+{
+    std::vector<SyntheticAspect> aspects;
+    aspects.reserve(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        // Several aspects per target (overloads instrumented by different aspects)
+        aspects.push_back({static_cast<mdToken>(FirstMemberRef + (i / 2) * 7)});
+    }
+    return aspects;
+}
+
+std::vector<mdToken> CreateCallOperands()
+{
+    std::vector<mdToken> operands;
+    operands.reserve(InstructionsCount);
+    for (size_t i = 0; i < InstructionsCount; i++)
+    {
+        operands.push_back(static_cast<mdToken>(FirstMemberRef + (i * 7919) % CalledMethodsCount));
+    }
+    return operands;
+}
+
+} // namespace
+
+// Previous dispatch of Dataflow::InstrumentInstruction: every aspect of the module is tried for every call
+static void BM_AspectsDispatch_LinearScan(benchmark::State& state)
+{
+    const auto aspects = CreateAspects(static_cast<size_t>(state.range(0)));
+    const auto operands = CreateCallOperands();
+
+    for (auto _ : state)
+    {
+        size_t matches = 0;
+        for (auto operand : operands)
+        {
+            for (auto const& aspect : aspects)
+            {
+                if (aspect.targetMethodRef == operand)
+                {
+                    matches++;
+                }
+            }
+        }
+        benchmark::DoNotOptimize(matches);
+    }
+
+    state.SetItemsProcessed(state.iterations() * InstructionsCount);
+}
+BENCHMARK(BM_AspectsDispatch_LinearScan)->Arg(50)->Arg(200)->Arg(800);
+
+static void BM_AspectsDispatch_Index(benchmark::State& state)
+{
+    const auto aspects = CreateAspects(static_cast<size_t>(state.range(0)));
+    const auto operands = CreateCallOperands();
+
+    AspectsIndex index;
+    for (size_t x = 0; x < aspects.size(); x++)
+    {
+        index.Add(aspects[x].targetMethodRef, x);
+    }
+
+    std::vector<size_t> candidates;
+    for (auto _ : state)
+    {
+        size_t matches = 0;
+        for (auto operand : operands)
+        {
+            candidates.clear();
+            index.GetCandidates(operand, candidates);
+            AspectsIndex::Normalize(candidates);
+            for (auto position : candidates)
+            {
+                if (aspects[position].targetMethodRef == operand)
+                {
+                    matches++;
+                }
+            }
+        }
+        benchmark::DoNotOptimize(matches);
+    }
+
+    state.SetItemsProcessed(state.iterations() * InstructionsCount);
+}
+BENCHMARK(BM_AspectsDispatch_Index)->Arg(50)->Arg(200)->Arg(800);
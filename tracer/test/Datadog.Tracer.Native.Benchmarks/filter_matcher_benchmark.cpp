@@ -0,0 +1,83 @@
+#include "benchmark/benchmark.h"
+
+#include "../../src/Datadog.Tracer.Native/iast/filter_matcher.h"
+
+#include <vector>
+
+using namespace iast;
+
+namespace
+{
+
+// Same shape as the default method filters of the dataflow
+const std::vector<shared::WSTRING> MethodIncludeFilters = {
+    WStr("System.Web.Mvc.ControllerActionInvoker::InvokeAction*"),
+    WStr("System.Web.Mvc.Async.AsyncControllerActionInvoker*"),
+    WStr("System.Web.Http.Controllers.ReflectedHttpActionDescriptor::ExecuteAsync*"),
+    WStr("System.Net.Http.HttpRequestMessage*"),
+    WStr("System.ServiceModel.Dispatcher*"),
+    WStr("MongoDB.Bson.Serialization.Serializers.StringSerializer*"),
+};
+const std::vector<shared::WSTRING> MethodExcludeFilters = {
+    WStr("DataDog*"),
+    WStr("System.Web.Mvc*"),
+    WStr("System.Web.PrefixContainer*"),
+    WStr("Microsoft.ClearScript*"),
+    WStr("JavaScriptEngineSwitcher*"),
+    WStr("IBM.Tivoli*"),
+    WStr("Dynatrace*"),
+    WStr("Microsoft.AspNetCore.Razor.Tools*"),
+    WStr("Microsoft.Extensions.CommandLineUtils*"),
+    WStr("System.Net.Http*"),
+    WStr("System.ServiceModel*"),
+    WStr("System.Web.Http*"),
+    WStr("MongoDB.*"),
+    WStr("JetBrains*"),
+    WStr("RestSharp.Extensions.StringExtensions::UrlEncode*"),
+};
+
+// Most of the JIT compiled methods are not excluded: every filter is checked for them
+const std::vector<shared::WSTRING> MethodSignatures = {
+    WStr("MyApp.Controllers.HomeController::Index(System.String,System.Int32)"),
+    WStr("MyApp.Services.OrderService::GetOrders(System.Guid)"),
+    WStr("System.Web.Mvc.ControllerActionInvoker::InvokeAction(System.Web.Mvc.ControllerContext,System.String)"),
+    WStr("System.Web.Http.Controllers.ApiControllerActionInvoker::InvokeActionAsync()"),
+    WStr("MongoDB.Driver.MongoCollectionImpl`1::Find()"),
+    WStr("Microsoft.Extensions.DependencyInjection.ServiceProvider::GetService(System.Type)"),
+    WStr("MyApp.Data.Repository`1::Save(!0)"),
+    WStr("DataDog.Trace.Tracer::StartSpan()"),
+};
+
+} // namespace
+
+// Previous matching of Dataflow::IsMethodExcluded: the filters are trimmed and compared one by one
+static void BM_FilterMatcher_Vectors(benchmark::State& state)
+{
+    size_t current = 0;
+    for (auto _ : state)
+    {
+        auto excluded = IsExcluded(MethodIncludeFilters, MethodExcludeFilters, MethodSignatures[current]);
+        benchmark::DoNotOptimize(excluded);
+        current = (current + 1) % MethodSignatures.size();
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FilterMatcher_Vectors);
+
+static void BM_FilterMatcher_Compiled(benchmark::State& state)
+{
+    const FilterMatcher includeMatcher(MethodIncludeFilters);
+    const FilterMatcher excludeMatcher(MethodExcludeFilters);
+
+    size_t current = 0;
+    for (auto _ : state)
+    {
+        auto excluded = IsExcluded(includeMatcher, excludeMatcher, MethodSignatures[current]);
+        benchmark::DoNotOptimize(excluded);
+        current = (current + 1) % MethodSignatures.size();
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FilterMatcher_Compiled);
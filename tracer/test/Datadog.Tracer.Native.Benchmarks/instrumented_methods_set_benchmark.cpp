@@ -0,0 +1,120 @@
+#include "benchmark/benchmark.h"
+
+#include "../../src/Datadog.Tracer.Native/instrumented_methods_set.h"
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+using namespace trace;
+
+namespace
+{
+
+constexpr ModuleID FirstModule = 0x7f0000000000;
+constexpr size_t ModulesCount = 600;
+constexpr size_t InstrumentedModulesCount = 40;
+constexpr size_t MethodsPerModule = 50;
+constexpr size_t LookupsCount = 4096;
+
+struct Lookup
+{
+    ModuleID moduleId;
+    mdMethodDef methodDef;
+};
+
+// Most of the inlining decisions are for methods that are not instrumented
+std::vector<Lookup> CreateLookups()
+{
+    std::vector<Lookup> lookups;
+    lookups.reserve(LookupsCount);
+    for (size_t i = 0; i < LookupsCount; i++)
+    {
+        const auto module = (i * 7919) % ModulesCount;
+        lookups.push_back({FirstModule + module * 0x10000, static_cast<mdMethodDef>(0x06000001 + (i * 31) % 2000)});
+    }
+    return lookups;
+}
+
+// Previous implementation: one map of methods per module in each rejitter, behind mutexes
+class LockedModulesMap
+{
+private:
+    std::mutex m_modules_lock;
+    std::unordered_map<ModuleID, std::unique_ptr<std::pair<std::mutex, std::unordered_map<mdMethodDef, bool>>>> m_modules;
+
+public:
+    void Add(ModuleID moduleId, mdMethodDef methodDef)
+    {
+        std::lock_guard<std::mutex> guard(m_modules_lock);
+        auto& module = m_modules[moduleId];
+        if (module == nullptr)
+        {
+            module = std::make_unique<std::pair<std::mutex, std::unordered_map<mdMethodDef, bool>>>();
+        }
+        module->second[methodDef] = true;
+    }
+
+    bool Contains(ModuleID moduleId, mdMethodDef methodDef)
+    {
+        std::lock_guard<std::mutex> guard(m_modules_lock);
+        auto it = m_modules.find(moduleId);
+        if (it == m_modules.end())
+        {
+            return false;
+        }
+
+        std::lock_guard<std::mutex> methodsGuard(it->second->first);
+        return it->second->second.find(methodDef) != it->second->second.end();
+    }
+};
+
+template <class TSet>
+void AddInstrumentedMethods(TSet& set)
+{
+    for (size_t module = 0; module < InstrumentedModulesCount; module++)
+    {
+        for (size_t method = 0; method < MethodsPerModule; method++)
+        {
+            set.Add(FirstModule + module * 0x10000, static_cast<mdMethodDef>(0x06000001 + method * 37));
+        }
+    }
+}
+
+LockedModulesMap LockedSet;
+InstrumentedMethodsSet LockFreeSet;
+
+template <class TSet>
+void RunLookups(benchmark::State& state, TSet& set)
+{
+    if (state.thread_index() == 0)
+    {
+        AddInstrumentedMethods(set);
+    }
+
+    const auto lookups = CreateLookups();
+    size_t current = state.thread_index() * 97;
+    for (auto _ : state)
+    {
+        const auto& lookup = lookups[current];
+        benchmark::DoNotOptimize(set.Contains(lookup.moduleId, lookup.methodDef));
+        current = (current + 1) % LookupsCount;
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+} // namespace
+
+// JITInlining is called concurrently by all the threads compiling methods
+static void BM_InstrumentedMethods_LockedMaps(benchmark::State& state)
+{
+    RunLookups(state, LockedSet);
+}
+BENCHMARK(BM_InstrumentedMethods_LockedMaps)->ThreadRange(1, 8)->UseRealTime();
+
+static void BM_InstrumentedMethods_LockFree(benchmark::State& state)
+{
+    RunLookups(state, LockFreeSet);
+}
+BENCHMARK(BM_InstrumentedMethods_LockFree)->ThreadRange(1, 8)->UseRealTime();
@@ -0,0 +1,161 @@
+#include "benchmark/benchmark.h"
+
+#include "../../src/Datadog.Tracer.Native/rejit_definitions_index.h"
+
+#include <string>
+#include <vector>
+
+using namespace trace;
+
+namespace
+{
+
+constexpr size_t ModulesCount = 600;
+constexpr size_t ReferencesPerModule = 20;
+constexpr size_t TargetAssembliesCount = 150;
+
+// Subset of an integration definition used to match a module
+struct Definition
+{
+    shared::WSTRING assembly;
+    bool isAbstract;
+    bool isAnyAssembly;
+};
+
+struct Module
+{
+    shared::WSTRING assembly;
+    std::vector<shared::WSTRING> references;
+};
+
+shared::WSTRING AssemblyName(const char* prefix, size_t index)
+{
+    return shared::ToWSTRING(std::string(prefix) + std::to_string(index));
+}
+
+// Like the CallTarget integrations: a few trace method definitions, ~5% of derived/interface
+// definitions and the others spread over the target assemblies
+std::vector<Definition> CreateDefinitions(size_t count)
+{
+    std::vector<Definition> definitions;
+    definitions.reserve(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        definitions.push_back({AssemblyName("Integration.Target.", i % TargetAssembliesCount), i % 20 == 0, i % 100 == 1});
+    }
+    return definitions;
+}
+
+// Most of the loaded modules (application, framework, ...) are not targeted by an integration
+std::vector<Module> CreateModules()
+{
+    std::vector<Module> modules;
+    modules.reserve(ModulesCount);
+    for (size_t i = 0; i < ModulesCount; i++)
+    {
+        Module module;
+        module.assembly = (i % 8 == 0) ? AssemblyName("Integration.Target.", i % TargetAssembliesCount)
+                                       : AssemblyName("Application.Module.", i);
+        for (size_t j = 0; j < ReferencesPerModule; j++)
+        {
+            module.references.push_back((j == 0) ? AssemblyName("Integration.Target.", (i + j) % TargetAssembliesCount)
+                                                 : AssemblyName("Application.Module.", (i * 31 + j) % ModulesCount));
+        }
+        modules.push_back(std::move(module));
+    }
+    return modules;
+}
+
+} // namespace
+
+// Previous matching: every module is compared against every definition and the references of the module
+// are scanned again for each derived/interface definition
+static void BM_RejitDefinitions_LinearScan(benchmark::State& state)
+{
+    const auto definitions = CreateDefinitions(state.range(0));
+    const auto modules = CreateModules();
+
+    for (auto _ : state)
+    {
+        size_t matches = 0;
+        for (const auto& module : modules)
+        {
+            for (const auto& definition : definitions)
+            {
+                if (definition.isAbstract)
+                {
+                    if (definition.assembly == module.assembly)
+                    {
+                        matches++;
+                        continue;
+                    }
+
+                    for (const auto& reference : module.references)
+                    {
+                        if (reference == definition.assembly)
+                        {
+                            matches++;
+                            break;
+                        }
+                    }
+                }
+                else if (definition.isAnyAssembly || definition.assembly == module.assembly)
+                {
+                    matches++;
+                }
+            }
+        }
+        benchmark::DoNotOptimize(matches);
+    }
+
+    state.SetItemsProcessed(state.iterations() * ModulesCount);
+}
+BENCHMARK(BM_RejitDefinitions_LinearScan)->ArgName("definitions")->Arg(100)->Arg(400)->Arg(1000);
+
+// The index is built once for all the modules (as for a batch of loaded modules) and each module only
+// visits its candidates
+static void BM_RejitDefinitions_Index(benchmark::State& state)
+{
+    const auto definitions = CreateDefinitions(state.range(0));
+    const auto modules = CreateModules();
+
+    std::vector<size_t> candidates;
+    for (auto _ : state)
+    {
+        RejitDefinitionsIndex index;
+        index.Reserve(definitions.size());
+        for (const auto& definition : definitions)
+        {
+            if (definition.isAbstract)
+            {
+                index.AddAbstract(definition.assembly);
+            }
+            else if (definition.isAnyAssembly)
+            {
+                index.AddAnyAssembly();
+            }
+            else
+            {
+                index.Add(definition.assembly);
+            }
+        }
+
+        size_t matches = 0;
+        for (const auto& module : modules)
+        {
+            candidates.clear();
+            index.GetCandidates(module.assembly, candidates);
+            index.GetAbstractCandidates(module.assembly, candidates);
+            for (const auto& reference : module.references)
+            {
+                index.GetAbstractCandidates(reference, candidates);
+            }
+            RejitDefinitionsIndex::Normalize(candidates);
+            matches += candidates.size();
+        }
+        benchmark::DoNotOptimize(matches);
+    }
+
+    state.SetItemsProcessed(state.iterations() * ModulesCount);
+}
+BENCHMARK(BM_RejitDefinitions_Index)->ArgName("definitions")->Arg(100)->Arg(400)->Arg(1000);
@@ -0,0 +1,80 @@
+#include "benchmark/benchmark.h"
+
+#include "../../src/Datadog.Tracer.Native/tracked_modules.h"
+
+#include <algorithm>
+#include <mutex>
+#include <vector>
+
+using namespace trace;
+
+namespace
+{
+
+constexpr ModuleID FirstModule = 0x7f0000000000;
+constexpr size_t LookupsCount = 4096;
+
+// The modules with metadata (integrations targets, Datadog.Trace, ...) are a small part of the loaded modules
+constexpr size_t TrackedModulesCount = 60;
+constexpr size_t LoadedModulesCount = 800;
+
+std::vector<ModuleID> CreateLookups()
+{
+    std::vector<ModuleID> lookups;
+    lookups.reserve(LookupsCount);
+    for (size_t i = 0; i < LookupsCount; i++)
+    {
+        lookups.push_back(FirstModule + ((i * 7919) % LoadedModulesCount) * 0x10000);
+    }
+    return lookups;
+}
+
+} // namespace
+
+// Previous lookup of JITCachedFunctionSearchStarted: module_ids lock and linear scans of the vectors
+static void BM_TrackedModules_LockedVectors(benchmark::State& state)
+{
+    std::mutex moduleIdsLock;
+    std::vector<ModuleID> moduleIds;
+    std::vector<ModuleID> internalModules = {FirstModule + LoadedModulesCount * 0x10000};
+    for (size_t i = 0; i < TrackedModulesCount; i++)
+    {
+        moduleIds.push_back(FirstModule + i * 13 * 0x10000);
+    }
+
+    const auto lookups = CreateLookups();
+    size_t current = 0;
+    for (auto _ : state)
+    {
+        std::lock_guard<std::mutex> guard(moduleIdsLock);
+        const auto moduleId = lookups[current];
+        const auto tracked = std::find(moduleIds.begin(), moduleIds.end(), moduleId) != moduleIds.end() ||
+                             std::find(internalModules.begin(), internalModules.end(), moduleId) != internalModules.end();
+        benchmark::DoNotOptimize(tracked);
+        current = (current + 1) % LookupsCount;
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TrackedModules_LockedVectors);
+
+static void BM_TrackedModules_Registry(benchmark::State& state)
+{
+    TrackedModules modules;
+    modules.Add(FirstModule + LoadedModulesCount * 0x10000, TrackedModules::Internal);
+    for (size_t i = 0; i < TrackedModulesCount; i++)
+    {
+        modules.Add(FirstModule + i * 13 * 0x10000, TrackedModules::HasMetadata);
+    }
+
+    const auto lookups = CreateLookups();
+    size_t current = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(modules.GetFlags(lookups[current]));
+        current = (current + 1) % LookupsCount;
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TrackedModules_Registry);
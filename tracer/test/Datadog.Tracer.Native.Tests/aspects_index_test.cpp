@@ -0,0 +1,216 @@
+#include "pch.h"
+
+#include "mock_cor_profiler_info.h"
+#include "mock_metadata_import.h"
+#include "../../src/Datadog.Tracer.Native/clr_helpers.h"
+#include "../../src/Datadog.Tracer.Native/iast/aspects_index.h"
+#include "../../src/Datadog.Tracer.Native/iast/dataflow.h"
+#include "../../src/Datadog.Tracer.Native/iast/dataflow_aspects.h"
+#include "../../src/Datadog.Tracer.Native/iast/module_info.h"
+
+using namespace iast;
+
+namespace
+{
+
+class TestAspectClass : public DataflowAspectClass
+{
+public:
+    explicit TestAspectClass(Dataflow* dataflow) : DataflowAspectClass(dataflow)
+    {
+    }
+};
+
+class TestAspect : public DataflowAspect
+{
+public:
+    explicit TestAspect(DataflowAspectClass* aspectClass) : DataflowAspect(aspectClass)
+    {
+    }
+};
+
+// Module whose metadata is read from a MockMetaDataImport
+class TestModuleInfo : public iast::ModuleInfo
+{
+public:
+    TestModuleInfo(Dataflow* dataflow, AppDomainInfo* appDomain, IMetaDataImport2* metadataImport) :
+        iast::ModuleInfo(dataflow, appDomain, 42, WStr("Test.dll"), 1, WStr("Test"))
+    {
+        _metadataImport = metadataImport;
+    }
+};
+
+// The aspects of a module calling two methods: the second aspect targets a generic method
+class ModuleAspectsTest : public ::testing::Test
+{
+protected:
+    static constexpr mdTypeRef TargetType = 0x01000001;
+    static constexpr mdMemberRef TargetMethod = 0x0A000001;
+    static constexpr mdMemberRef GenericTargetMethod = 0x0A000002;
+    static constexpr mdMethodSpec GenericTargetMethodSpec = 0x2B000001;
+    static constexpr mdMethodSpec OtherMethodSpec = 0x2B000002;
+
+    MockCorProfilerInfo _profiler;
+    MockMetaDataImport _metadataImport;
+    AppDomainInfo _appDomain;
+    Dataflow* _dataflow = nullptr;
+    TestModuleInfo* _module = nullptr;
+    ModuleAspects* _moduleAspects = nullptr;
+
+    TestAspectClass* _aspectClass = nullptr;
+    TestAspect* _aspect = nullptr;
+    TestAspect* _genericAspect = nullptr;
+    DataflowAspectReference* _aspectReference = nullptr;
+    DataflowAspectReference* _genericAspectReference = nullptr;
+
+    void SetUp() override
+    {
+        _metadataImport.memberRefs[TargetMethod] = {TargetType, WStr("Concat")};
+        _metadataImport.memberRefs[GenericTargetMethod] = {TargetType, WStr("Join")};
+        _metadataImport.memberRefs[0x0A000003] = {TargetType, WStr("Other")};
+        _metadataImport.methodSpecs[GenericTargetMethodSpec] = GenericTargetMethod;
+        _metadataImport.methodSpecs[OtherMethodSpec] = 0x0A000003;
+
+        _dataflow = new Dataflow(&_profiler, nullptr, {}, RuntimeInformation(COR_PRF_DESKTOP_CLR, 4, 0, 0, 0));
+        _module = new TestModuleInfo(_dataflow, &_appDomain, &_metadataImport);
+        _moduleAspects = new ModuleAspects(_dataflow, _module);
+
+        _aspectClass = new TestAspectClass(_dataflow);
+        _aspect = new TestAspect(_aspectClass);
+        _genericAspect = new TestAspect(_aspectClass);
+        _aspectReference = new DataflowAspectReference(_moduleAspects, _aspect, TargetMethod, TargetType, {});
+        _genericAspectReference =
+            new DataflowAspectReference(_moduleAspects, _genericAspect, GenericTargetMethod, TargetType, {});
+        _moduleAspects->AddAspect(_aspectReference);
+        _moduleAspects->AddAspect(_genericAspectReference);
+    }
+
+    void TearDown() override
+    {
+        // the aspect references are owned by the module aspects
+        delete _moduleAspects;
+        delete _module;
+        delete _genericAspect;
+        delete _aspect;
+        delete _aspectClass;
+        delete _dataflow;
+    }
+
+    std::vector<DataflowAspectReference*> GetCandidateAspects(mdToken operand)
+    {
+        std::vector<DataflowAspectReference*> aspects;
+        _moduleAspects->GetCandidateAspects(operand, aspects);
+        return aspects;
+    }
+};
+
+} // namespace
+
+TEST(AspectsIndexTest, UnknownTokenHasNoCandidates)
+{
+    AspectsIndex index;
+    index.Add(0x0A000001, 0);
+
+    std::vector<size_t> candidates;
+    index.GetCandidates(0x0A000002, candidates);
+    index.GetCandidates(0x06000001, candidates);
+    EXPECT_TRUE(candidates.empty());
+}
+
+TEST(AspectsIndexTest, CandidatesAreInTheAspectsOrder)
+{
+    AspectsIndex index;
+    index.Add(0x0A000001, 5);
+    index.Add(0x0A000001, 1);
+    index.Add(0x0A000001, 3);
+    index.Add(0x0A000001, 3);
+    index.Add(0x0A000002, 2);
+
+    std::vector<size_t> candidates;
+    index.GetCandidates(0x0A000001, candidates);
+    EXPECT_EQ((std::vector<size_t>{1, 3, 5}), candidates);
+}
+
+TEST(AspectsIndexTest, NormalizeMergesTheCandidatesOfSeveralTokens)
+{
+    AspectsIndex index;
+    // Aspect 2 targets both the generic method and the instrumentation method token
+    index.Add(0x0A000001, 2);
+    index.Add(0x0A000001, 4);
+    index.Add(0x2B000001, 0);
+    index.Add(0x2B000001, 2);
+
+    std::vector<size_t> candidates;
+    index.GetCandidates(0x2B000001, candidates);
+    index.GetCandidates(0x0A000001, candidates);
+    AspectsIndex::Normalize(candidates);
+    EXPECT_EQ((std::vector<size_t>{0, 2, 4}), candidates);
+}
+
+TEST(AspectsIndexTest, IndexMatchesLinearScan)
+{
+    // Each aspect targets one of a few tokens, as in the aspects of a module calling String methods
+    const std::vector<mdToken> targets = {0x0A000010, 0x0A000011, 0x0A000010, 0x06000003,
+                                          0x0A000012, 0x0A000011, 0x0A000010, 0x06000003};
+    AspectsIndex index;
+    for (size_t x = 0; x < targets.size(); x++)
+    {
+        index.Add(targets[x], x);
+    }
+
+    for (mdToken token : {0x0A000010, 0x0A000011, 0x0A000012, 0x0A000013, 0x06000003, 0x06000004})
+    {
+        std::vector<size_t> expected;
+        for (size_t x = 0; x < targets.size(); x++)
+        {
+            if (targets[x] == static_cast<mdToken>(token))
+            {
+                expected.push_back(x);
+            }
+        }
+
+        std::vector<size_t> candidates;
+        index.GetCandidates(token, candidates);
+        AspectsIndex::Normalize(candidates);
+        EXPECT_EQ(expected, candidates);
+    }
+}
+
+TEST_F(ModuleAspectsTest, CallsReachTheAspectsOfTheirTarget)
+{
+    EXPECT_EQ((std::vector<DataflowAspectReference*>{_aspectReference}), GetCandidateAspects(TargetMethod));
+    EXPECT_EQ((std::vector<DataflowAspectReference*>{_genericAspectReference}), GetCandidateAspects(GenericTargetMethod));
+    EXPECT_TRUE(GetCandidateAspects(0x0A000003).empty());
+    EXPECT_TRUE(GetCandidateAspects(0x06000001).empty());
+}
+
+TEST_F(ModuleAspectsTest, MethodSpecReachesTheAspectOfItsGenericMethod)
+{
+    // a call to an instantiation of the generic method has the MethodSpec as operand
+    EXPECT_EQ((std::vector<DataflowAspectReference*>{_genericAspectReference}),
+              GetCandidateAspects(GenericTargetMethodSpec));
+
+    // instantiation of a method without aspect
+    EXPECT_TRUE(GetCandidateAspects(OtherMethodSpec).empty());
+}
+
+TEST_F(ModuleAspectsTest, ImportedAspectMemberRefReachesItsAspect)
+{
+    // once the aspect method is imported in the module, the calls already rewritten to it
+    // (when the method is instrumented again) must still reach the aspect
+    const mdMemberRef aspectMemberRef = 0x0A000010;
+    EXPECT_TRUE(GetCandidateAspects(aspectMemberRef).empty());
+
+    _moduleAspects->IndexAspectToken(aspectMemberRef, _genericAspectReference);
+    EXPECT_EQ((std::vector<DataflowAspectReference*>{_genericAspectReference}), GetCandidateAspects(aspectMemberRef));
+
+    // the target of the aspect is still indexed, in the aspects order
+    _moduleAspects->IndexAspectToken(TargetMethod, _genericAspectReference);
+    EXPECT_EQ((std::vector<DataflowAspectReference*>{_aspectReference, _genericAspectReference}),
+              GetCandidateAspects(TargetMethod));
+
+    // an aspect reference that does not apply to this module is not indexed
+    DataflowAspectReference otherAspect(_moduleAspects, _aspect, 0x0A000020, TargetType, {});
+    _moduleAspects->IndexAspectToken(0x0A000021, &otherAspect);
+    EXPECT_TRUE(GetCandidateAspects(0x0A000021).empty());
+}
@@ -0,0 +1,132 @@
+#include "pch.h"
+
+#include "../../src/Datadog.Tracer.Native/iast/filter_matcher.h"
+
+#include <random>
+
+using namespace iast;
+
+namespace
+{
+
+void ExpectSameMatch(const std::vector<shared::WSTRING>& filters, const FilterMatcher& matcher,
+                     const shared::WSTRING& value)
+{
+    unsigned int expectedLen = 1000;
+    unsigned int matchLen = 1000;
+    auto expected = IsMatch(filters, value, &expectedLen);
+    EXPECT_EQ(expected, matcher.Match(value, &matchLen)) << shared::ToString(value);
+    EXPECT_EQ(expectedLen, matchLen) << shared::ToString(value);
+}
+
+void ExpectSameExclusion(const std::vector<shared::WSTRING>& include, const std::vector<shared::WSTRING>& exclude,
+                         const shared::WSTRING& value)
+{
+    MatchResult expectedIncluded, expectedExcluded, included, excluded;
+    auto expected = IsExcluded(include, exclude, value, &expectedIncluded, &expectedExcluded);
+    EXPECT_EQ(expected, IsExcluded(FilterMatcher(include), FilterMatcher(exclude), value, &included, &excluded))
+        << shared::ToString(value);
+    EXPECT_EQ(expectedIncluded, included) << shared::ToString(value);
+    EXPECT_EQ(expectedExcluded, excluded) << shared::ToString(value);
+}
+
+} // namespace
+
+TEST(FilterMatcherTest, Match)
+{
+    const std::vector<shared::WSTRING> include = {
+        WStr("Match11*"),
+        WStr("Match2*"),
+        WStr("Match3.Match3"),
+    };
+    FilterMatcher matcher(include);
+    EXPECT_EQ(MatchResult::NoMatch, matcher.Match(WStr("Match")));
+    EXPECT_EQ(MatchResult::Wildcard, matcher.Match(WStr("Match112")));
+    EXPECT_EQ(MatchResult::Wildcard, matcher.Match(WStr("Match20")));
+    EXPECT_EQ(MatchResult::Exact, matcher.Match(WStr("Match3.Match3")));
+    EXPECT_EQ(MatchResult::NoMatch, matcher.Match(WStr("Match3.Match")));
+
+    const std::vector<shared::WSTRING> exclude = {
+        WStr("Match22*"),
+        WStr("Match112"),
+        WStr("Match3*"),
+    };
+    FilterMatcher excludeMatcher(exclude);
+    EXPECT_TRUE(IsExcluded(matcher, excludeMatcher, WStr("Match112")));
+    EXPECT_TRUE(IsExcluded(matcher, excludeMatcher, WStr("Match220")));
+    EXPECT_FALSE(IsExcluded(matcher, excludeMatcher, WStr("Match20")));
+    EXPECT_FALSE(IsExcluded(matcher, excludeMatcher, WStr("Match210")));
+    EXPECT_TRUE(IsExcluded(matcher, excludeMatcher, WStr("Match33.Match3")));
+    EXPECT_FALSE(IsExcluded(matcher, excludeMatcher, WStr("Match3.Match3")));
+}
+
+TEST(FilterMatcherTest, SameMatchAsIsMatch)
+{
+    const std::vector<shared::WSTRING> filters = {
+        WStr("System*"), WStr("Datadog.*"), WStr("MSBuild"), WStr(" dotnet "), WStr("*Tests"),
+        WStr("*.Resources"), WStr("Mid*dle"), WStr("*Both*"), WStr("Lit*eral*"),
+    };
+    FilterMatcher matcher(filters);
+
+    for (auto value : {WStr(""), WStr(" "), WStr("  \t"), WStr("System"), WStr("Systen"), WStr("System.Web"),
+                       WStr(" System.Web\r\n"), WStr("Syst"), WStr("Datadog"), WStr("Datadog.Trace"), WStr("MSBuild"),
+                       WStr("MSBuild2"), WStr("MSBuil"), WStr("dotnet"), WStr("\tdotnet"), WStr("App.Tests"),
+                       WStr("Tests"), WStr("ests"), WStr("App.Tests.Other"), WStr("App.Resources"),
+                       WStr("Middle"), WStr("Mid*dle"), WStr("*Both"), WStr("*Both*"), WStr("Both"),
+                       WStr("Lit*eral"), WStr("Lit*eral.X"), WStr("Literal")})
+    {
+        ExpectSameMatch(filters, matcher, value);
+    }
+}
+
+TEST(FilterMatcherTest, SpecialFilters)
+{
+    // A lone wildcard matches everything, an empty filter is also an empty prefix
+    for (auto const& filters : std::vector<std::vector<shared::WSTRING>>{
+             {WStr("*")}, {WStr("")}, {WStr("  ")}, {WStr("**")}, {WStr("*a*")}, {WStr("a*b")}, {}})
+    {
+        FilterMatcher matcher(filters);
+        for (auto value : {WStr(""), WStr(" "), WStr("a"), WStr("ab"), WStr("*"), WStr("*a"), WStr("*ab"), WStr("b")})
+        {
+            ExpectSameMatch(filters, matcher, value);
+        }
+    }
+}
+
+TEST(FilterMatcherTest, SameExclusionAsIsExcluded)
+{
+    // Random filters and values on a small alphabet so that they overlap often
+    std::mt19937 random(42);
+    const WCHAR alphabet[] = {'a', 'b', '.', '*', ' '};
+    auto randomString = [&](size_t maxLength) {
+        shared::WSTRING res;
+        auto length = random() % (maxLength + 1);
+        for (size_t x = 0; x < length; x++)
+        {
+            res.push_back(alphabet[random() % (sizeof(alphabet) / sizeof(alphabet[0]))]);
+        }
+        return res;
+    };
+
+    for (int test = 0; test < 300; test++)
+    {
+        std::vector<shared::WSTRING> include;
+        std::vector<shared::WSTRING> exclude;
+        for (auto x = random() % 4; x > 0; x--)
+        {
+            include.push_back(randomString(5));
+        }
+        for (auto x = random() % 6; x > 0; x--)
+        {
+            exclude.push_back(randomString(5));
+        }
+
+        FilterMatcher includeMatcher(include);
+        for (int value = 0; value < 50; value++)
+        {
+            auto valueStr = randomString(6);
+            ExpectSameMatch(include, includeMatcher, valueStr);
+            ExpectSameExclusion(include, exclude, valueStr);
+        }
+    }
+}
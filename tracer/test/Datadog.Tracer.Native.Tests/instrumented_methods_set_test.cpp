@@ -0,0 +1,124 @@
+#include "pch.h"
+
+#include "../../src/Datadog.Tracer.Native/instrumented_methods_set.h"
+
+#include <atomic>
+#include <thread>
+
+using namespace trace;
+
+TEST(InstrumentedMethodsSetTest, ContainsTheAddedMethods)
+{
+    InstrumentedMethodsSet set;
+    const ModuleID module = 0x7f0012345670;
+
+    ASSERT_FALSE(set.Contains(module, 0x06000001));
+
+    set.Add(module, 0x06000001);
+    set.Add(module, 0x06012345);
+    set.Add(module, 0x06FFFFFF);
+
+    ASSERT_TRUE(set.Contains(module, 0x06000001));
+    ASSERT_TRUE(set.Contains(module, 0x06012345));
+    ASSERT_TRUE(set.Contains(module, 0x06FFFFFF));
+    ASSERT_FALSE(set.Contains(module, 0x06000002));
+    ASSERT_FALSE(set.Contains(module + 0x10, 0x06000001));
+}
+
+TEST(InstrumentedMethodsSetTest, OnlyMethodDefsAreContained)
+{
+    InstrumentedMethodsSet set;
+    const ModuleID module = 0x7f0012345670;
+
+    set.Add(module, 0x06000010);
+    set.Add(module, 0x0A000020);
+
+    ASSERT_FALSE(set.Contains(module, 0x0A000010));
+    ASSERT_FALSE(set.Contains(module, 0x0A000020));
+    ASSERT_FALSE(set.Contains(module, 0x06000020));
+}
+
+TEST(InstrumentedMethodsSetTest, RemovedModuleDoesNotContainItsMethods)
+{
+    InstrumentedMethodsSet set;
+    const ModuleID module1 = 0x7f0012345670;
+    const ModuleID module2 = 0x7f0012345700;
+
+    set.Add(module1, 0x06000001);
+    set.Add(module2, 0x06000002);
+    set.RemoveModule(module1);
+
+    ASSERT_FALSE(set.Contains(module1, 0x06000001));
+    ASSERT_TRUE(set.Contains(module2, 0x06000002));
+
+    // the ModuleID can be reused by the runtime for another module
+    set.Add(module1, 0x06000003);
+    ASSERT_FALSE(set.Contains(module1, 0x06000001));
+    ASSERT_TRUE(set.Contains(module1, 0x06000003));
+}
+
+TEST(InstrumentedMethodsSetTest, ManyModules)
+{
+    InstrumentedMethodsSet set;
+    const ModuleID firstModule = 0x7f0000000000;
+
+    for (ModuleID i = 0; i < 1000; i++)
+    {
+        set.Add(firstModule + i * 0x1000, 0x06000000 + static_cast<mdMethodDef>(i + 1));
+        if (i % 3 == 0)
+        {
+            set.RemoveModule(firstModule + i * 0x1000);
+        }
+    }
+
+    for (ModuleID i = 0; i < 1000; i++)
+    {
+        const auto methodDef = 0x06000000 + static_cast<mdMethodDef>(i + 1);
+        ASSERT_EQ(i % 3 != 0, set.Contains(firstModule + i * 0x1000, methodDef)) << "module #" << i;
+        ASSERT_FALSE(set.Contains(firstModule + i * 0x1000, methodDef + 1)) << "module #" << i;
+    }
+}
+
+TEST(InstrumentedMethodsSetTest, LookupsWhileMethodsAreAdded)
+{
+    InstrumentedMethodsSet set;
+    const ModuleID firstModule = 0x7f0000000000;
+    std::atomic<bool> done = {false};
+
+    // A method seen once must be seen by the next lookups
+    std::vector<std::thread> readers;
+    std::atomic<int> errors = {0};
+    for (int r = 0; r < 4; r++)
+    {
+        readers.emplace_back([&]() {
+            while (!done)
+            {
+                for (ModuleID i = 0; i < 200; i++)
+                {
+                    const auto module = firstModule + i * 0x1000;
+                    if (set.Contains(module, 0x06000001) && !set.Contains(module, 0x06000001))
+                    {
+                        errors++;
+                    }
+                }
+            }
+        });
+    }
+
+    for (ModuleID i = 0; i < 200; i++)
+    {
+        set.Add(firstModule + i * 0x1000, 0x06000001);
+    }
+
+    done = true;
+    for (auto& reader : readers)
+    {
+        reader.join();
+    }
+
+    ASSERT_EQ(0, errors);
+    for (ModuleID i = 0; i < 200; i++)
+    {
+        ASSERT_TRUE(set.Contains(firstModule + i * 0x1000, 0x06000001));
+    }
+}
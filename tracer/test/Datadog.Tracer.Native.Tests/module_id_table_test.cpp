@@ -0,0 +1,161 @@
+#include "pch.h"
+
+#include "../../src/Datadog.Tracer.Native/module_id_table.h"
+
+#include <thread>
+
+using namespace trace;
+
+namespace
+{
+
+struct TestSlot
+{
+    std::atomic<ModuleID> moduleId = {0};
+    std::atomic<uint64_t> value = {0};
+
+    bool IsLive() const
+    {
+        return value.load(std::memory_order_relaxed) != 0;
+    }
+
+    void CopyTo(TestSlot& target) const
+    {
+        target.value.store(value.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+};
+
+using TestTable = ModuleIdTable<TestSlot>;
+
+constexpr ModuleID FirstModule = 0x7f0000000000;
+
+} // namespace
+
+TEST(ModuleIdTableTest, UnknownModuleHasNoSlot)
+{
+    TestTable table(16);
+
+    ASSERT_EQ(nullptr, table.Find(FirstModule));
+}
+
+TEST(ModuleIdTableTest, GetOrAddReturnsTheSameSlot)
+{
+    TestTable table(16);
+
+    auto slot = table.GetOrAdd(FirstModule, TestTable::Hash(FirstModule));
+    ASSERT_NE(nullptr, slot);
+    ASSERT_EQ(FirstModule, slot->moduleId.load());
+    slot->value = 42;
+
+    ASSERT_EQ(slot, table.GetOrAdd(FirstModule, TestTable::Hash(FirstModule)));
+    ASSERT_EQ(slot, table.Find(FirstModule));
+    ASSERT_EQ(nullptr, table.Find(FirstModule + 0x1000));
+}
+
+TEST(ModuleIdTableTest, RemovedModuleKeepsItsSlot)
+{
+    TestTable table(16);
+
+    auto slot = table.GetOrAdd(FirstModule, TestTable::Hash(FirstModule));
+    slot->value = 42;
+
+    // the slot of a removed module is a tombstone: the ModuleID can be added again by the runtime
+    slot->value = 0;
+    ASSERT_EQ(slot, table.Find(FirstModule));
+    ASSERT_EQ(slot, table.GetOrAdd(FirstModule, TestTable::Hash(FirstModule)));
+}
+
+TEST(ModuleIdTableTest, GrowKeepsOnlyTheLiveModules)
+{
+    TestTable table(16);
+
+    for (ModuleID i = 0; i < 5000; i++)
+    {
+        const auto module = FirstModule + i * 0x1000;
+        table.GetOrAdd(module, TestTable::Hash(module))->value = i + 1;
+        if (i % 4 == 0)
+        {
+            table.Find(module)->value = 0;
+        }
+    }
+
+    ASSERT_GE(table.GetCapacity(), 2 * 3750u);
+
+    size_t liveModules = 0;
+    table.ForEachLive([&liveModules](const TestSlot& slot) {
+        ASSERT_EQ(slot.value.load(), (slot.moduleId.load() - FirstModule) / 0x1000 + 1);
+        liveModules++;
+    });
+    ASSERT_EQ(3750u, liveModules);
+
+    for (ModuleID i = 0; i < 5000; i++)
+    {
+        const auto module = FirstModule + i * 0x1000;
+        const auto slot = table.Find(module);
+        if (slot != nullptr)
+        {
+            ASSERT_EQ(i % 4 == 0 ? 0 : i + 1, slot->value.load());
+        }
+        else
+        {
+            // the removed modules are not copied into the grown tables
+            ASSERT_EQ(0u, i % 4);
+        }
+        ASSERT_EQ(nullptr, table.Find(module + 0x10));
+    }
+}
+
+TEST(ModuleIdTableTest, TombstonesAreDroppedWithoutGrowing)
+{
+    TestTable table(16);
+
+    // modules loaded then unloaded: only the last two are alive
+    for (ModuleID i = 0; i < 10000; i++)
+    {
+        const auto module = FirstModule + i * 0x1000;
+        table.GetOrAdd(module, TestTable::Hash(module))->value = i + 1;
+        if (i >= 2)
+        {
+            table.Find(module - 2 * 0x1000)->value = 0;
+        }
+    }
+
+    ASSERT_EQ(16u, table.GetCapacity());
+
+    size_t liveModules = 0;
+    table.ForEachLive([&liveModules](const TestSlot&) { liveModules++; });
+    ASSERT_EQ(2u, liveModules);
+    ASSERT_EQ(9999u, table.Find(FirstModule + 9998 * 0x1000)->value.load());
+    ASSERT_EQ(10000u, table.Find(FirstModule + 9999 * 0x1000)->value.load());
+}
+
+TEST(ModuleIdTableTest, LookupsWhileGrowing)
+{
+    TestTable table(16);
+    const auto module = FirstModule - 0x1000;
+    table.GetOrAdd(module, TestTable::Hash(module))->value = 42;
+
+    std::atomic<bool> stop = {false};
+    std::atomic<size_t> misses = {0};
+    std::thread reader([&]() {
+        while (!stop.load())
+        {
+            const auto slot = table.Find(module);
+            if (slot == nullptr || slot->value.load(std::memory_order_acquire) != 42)
+            {
+                misses++;
+            }
+        }
+    });
+
+    // the writers are serialized by the caller: a single writer here
+    for (ModuleID i = 0; i < 20000; i++)
+    {
+        const auto added = FirstModule + i * 0x1000;
+        table.GetOrAdd(added, TestTable::Hash(added))->value.store(i + 1, std::memory_order_release);
+    }
+
+    stop = true;
+    reader.join();
+    ASSERT_EQ(0u, misses.load());
+}
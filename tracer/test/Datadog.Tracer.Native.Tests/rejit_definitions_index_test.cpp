@@ -0,0 +1,69 @@
+#include "pch.h"
+
+#include "../../src/Datadog.Tracer.Native/rejit_definitions_index.h"
+
+using namespace trace;
+
+namespace
+{
+std::vector<size_t> GetCandidates(const RejitDefinitionsIndex& index, const shared::WSTRING& assemblyName,
+                                  const std::vector<shared::WSTRING>& references = {})
+{
+    std::vector<size_t> candidates;
+    index.GetCandidates(assemblyName, candidates);
+    index.GetAbstractCandidates(assemblyName, candidates);
+    for (const auto& reference : references)
+    {
+        index.GetAbstractCandidates(reference, candidates);
+    }
+    RejitDefinitionsIndex::Normalize(candidates);
+    return candidates;
+}
+} // namespace
+
+TEST(RejitDefinitionsIndexTest, CandidatesAreInDefinitionsOrder)
+{
+    RejitDefinitionsIndex index;
+    index.Add(WStr("System.Net.Http"));
+    index.Add(WStr("System.Data"));
+    index.AddAnyAssembly();
+    index.Add(WStr("System.Net.Http"));
+
+    ASSERT_EQ(4, index.Count());
+    ASSERT_FALSE(index.HasAbstractDefinitions());
+    ASSERT_EQ((std::vector<size_t>{0, 2, 3}), GetCandidates(index, WStr("System.Net.Http")));
+    ASSERT_EQ((std::vector<size_t>{1, 2}), GetCandidates(index, WStr("System.Data")));
+}
+
+TEST(RejitDefinitionsIndexTest, AnyAssemblyDefinitionsAreCandidatesForEveryModule)
+{
+    RejitDefinitionsIndex index;
+    index.Add(WStr("System.Net.Http"));
+    index.AddAnyAssembly();
+
+    ASSERT_EQ((std::vector<size_t>{1}), GetCandidates(index, WStr("MyApp")));
+}
+
+TEST(RejitDefinitionsIndexTest, AbstractDefinitionsAreCandidatesForTheReferencingModules)
+{
+    RejitDefinitionsIndex index;
+    index.AddAbstract(WStr("Microsoft.Extensions.Logging.Abstractions"));
+    index.Add(WStr("MyApp"));
+    index.AddAbstract(WStr("System.Data.Common"));
+
+    ASSERT_TRUE(index.HasAbstractDefinitions());
+    ASSERT_EQ((std::vector<size_t>{1}), GetCandidates(index, WStr("MyApp"), {WStr("System.Runtime")}));
+    ASSERT_EQ((std::vector<size_t>{1, 2}), GetCandidates(index, WStr("MyApp"), {WStr("System.Data.Common")}));
+    ASSERT_EQ((std::vector<size_t>{2}), GetCandidates(index, WStr("System.Data.Common")));
+}
+
+TEST(RejitDefinitionsIndexTest, DuplicatedCandidatesAreRemoved)
+{
+    RejitDefinitionsIndex index;
+    index.AddAbstract(WStr("System.Data.Common"));
+    index.AddAnyAssembly();
+
+    // the module of the target assembly referencing itself (or listed twice) must not duplicate the candidates
+    ASSERT_EQ((std::vector<size_t>{0, 1}),
+              GetCandidates(index, WStr("System.Data.Common"), {WStr("System.Data.Common"), WStr("System.Data.Common")}));
+}
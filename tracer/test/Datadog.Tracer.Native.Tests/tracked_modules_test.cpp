@@ -0,0 +1,72 @@
+#include "pch.h"
+
+#include "../../src/Datadog.Tracer.Native/tracked_modules.h"
+
+using namespace trace;
+
+TEST(TrackedModulesTest, UnknownModuleIsNotTracked)
+{
+    TrackedModules modules;
+
+    ASSERT_EQ(TrackedModules::None, modules.GetFlags(0x7f0012345670));
+    ASSERT_EQ(0, modules.GetAppDomain(0x7f0012345670));
+}
+
+TEST(TrackedModulesTest, FlagsAreCombined)
+{
+    TrackedModules modules;
+    const ModuleID module = 0x7f0012345670;
+
+    modules.Add(module, TrackedModules::Internal);
+    ASSERT_EQ(TrackedModules::Internal, modules.GetFlags(module));
+
+    modules.Add(module, TrackedModules::HasMetadata);
+    ASSERT_EQ(TrackedModules::Internal | TrackedModules::HasMetadata, modules.GetFlags(module));
+}
+
+TEST(TrackedModulesTest, RemovedModuleIsNotTracked)
+{
+    TrackedModules modules;
+    const ModuleID module = 0x7f0012345670;
+
+    modules.Add(module, TrackedModules::HasMetadata);
+    modules.SetAppDomain(module, 0x1234);
+    ASSERT_EQ(0x1234, modules.GetAppDomain(module));
+
+    modules.Remove(module);
+    ASSERT_EQ(TrackedModules::None, modules.GetFlags(module));
+    ASSERT_EQ(0, modules.GetAppDomain(module));
+
+    // the AppDomain of a module that is not tracked is not cached
+    modules.SetAppDomain(module, 0x1234);
+    ASSERT_EQ(0, modules.GetAppDomain(module));
+
+    // the ModuleID can be reused by the runtime for another module
+    modules.Add(module, TrackedModules::Internal);
+    ASSERT_EQ(TrackedModules::Internal, modules.GetFlags(module));
+    ASSERT_EQ(0, modules.GetAppDomain(module));
+}
+
+TEST(TrackedModulesTest, ManyModules)
+{
+    TrackedModules modules;
+    const ModuleID firstModule = 0x7f0000000000;
+
+    for (ModuleID i = 0; i < 5000; i++)
+    {
+        modules.Add(firstModule + i * 0x1000, TrackedModules::HasMetadata);
+        modules.SetAppDomain(firstModule + i * 0x1000, i + 1);
+        if (i % 4 == 0)
+        {
+            modules.Remove(firstModule + i * 0x1000);
+        }
+    }
+
+    for (ModuleID i = 0; i < 5000; i++)
+    {
+        const auto module = firstModule + i * 0x1000;
+        ASSERT_EQ(i % 4 == 0 ? TrackedModules::None : TrackedModules::HasMetadata, modules.GetFlags(module));
+        ASSERT_EQ(i % 4 == 0 ? 0 : i + 1, modules.GetAppDomain(module));
+        ASSERT_EQ(TrackedModules::None, modules.GetFlags(module + 0x10));
+    }
+}